@@ -91,6 +91,9 @@ namespace Doremi
 
         const DoremiEngine::Core::SharedContext* m_sharedContext;
 
+        // Telemetry of every frame, the time spent updating and drawing and the number of entities
+        uint32_t m_frameTelemetrySchema;
+
     protected:
         void AddToManagerList(Core::Manager* p_manager);
         void AddToServerBrowserList(Core::Manager* p_manager);
@@ -12,6 +12,7 @@
 #include <DoremiEngine/Physics/Include/RigidBodyManager.hpp>
 #include <DoremiEngine/Physics/Include/FluidManager.hpp>
 // AI
+#include <DoremiEngine/Configuration/Include/ConfigurationModule.hpp>
 #include <DoremiEngine/AI/Include/AIModule.hpp>
 #include <DoremiEngine/AI/Include/Interface/SubModule/PotentialFieldSubModule.hpp>
 #include <DoremiEngine/AI/Include/Interface/PotentialField/PotentialFieldActor.hpp>
@@ -99,7 +100,7 @@ namespace Doremi
 {
     using namespace Utilities::Logging;
     using namespace Core;
-    GameMain::GameMain() : m_sharedContext(nullptr), m_gameRunning(true) {}
+    GameMain::GameMain() : m_sharedContext(nullptr), m_frameTelemetrySchema(0), m_gameRunning(true) {}
 
     GameMain::~GameMain()
     {
@@ -133,6 +134,18 @@ namespace Doremi
         AudioHandler::StartAudioHandler(sharedContext); // Needs to be stareted after event handler
         StateHandler::StartStateHandler(sharedContext);
         CameraHandler::StartCameraHandler(sharedContext);
+        const DoremiEngine::Configuration::ConfiguartionInfo& t_configuration = sharedContext.GetConfigurationModule().GetAllConfigurationValues();
+        if(t_configuration.TraceCaptureSeconds > 0)
+        {
+            TimerManager::GetInstance().StartTraceCapture(t_configuration.TraceCaptureSeconds, t_configuration.TraceSpikeThreshold);
+        }
+        {
+            using namespace Utilities::Logging;
+            m_frameTelemetrySchema = m_logger->RegisterDataSchema("ClientFrame", {{"updateTime", TelemetryFieldType::DOUBLE},
+                                                                                  {"updateSteps", TelemetryFieldType::UINT32},
+                                                                                  {"drawTime", TelemetryFieldType::DOUBLE},
+                                                                                  {"entityCount", TelemetryFieldType::INT32}});
+        }
         PositionCorrectionHandler::StartPositionCorrectionHandler(sharedContext);
         EntityFactory::StartupEntityFactory(sharedContext);
         PlayerSpawnerHandler::StartupPlayerSpawnerHandler(sharedContext);
@@ -227,14 +240,19 @@ namespace Doremi
 
         t_timeHandler->PreviousClock = std::chrono::high_resolution_clock::now();
 
+        Utilities::Chrono::Timer t_frameTimer;
         while(m_gameRunning)
         {
             // Tick time
             t_timeHandler->Tick();
+            t_frameTimer.Reset();
+            uint32_t t_updateSteps = 0;
 
             // Loop as many update-steps we will take this frame
             while(m_gameRunning && t_timeHandler->ShouldUpdateFrame())
             {
+                ++t_updateSteps;
+
                 // Update game based on state
                 Update(t_timeHandler->UpdateStepLen);
 
@@ -246,8 +264,13 @@ namespace Doremi
 
                 // Update accumulator and gametime
                 t_timeHandler->UpdateAccumulatorAndGameTime();
+
+                // Temporaries of the managers from the update before this one are freed
+                Core::Manager::GetFrameArena().SwapFrames();
             }
 
+            const double t_updateTime = t_frameTimer.Tick().GetElapsedTimeInSeconds();
+
             // Update alpha usd for inteprolation
             double alpha = t_timeHandler->GetFrameAlpha();
 
@@ -257,6 +280,12 @@ namespace Doremi
             // Update camera after we update positions
             CameraHandler::GetInstance()->UpdateDraw(alpha);
             Draw(t_timeHandler->Frame);
+
+            m_logger->LogData(m_frameTelemetrySchema, t_updateTime, t_updateSteps, t_frameTimer.Tick().GetElapsedTimeInSeconds(),
+                              Core::EntityHandler::GetInstance().GetLastEntityIndex());
+
+            // One call tree per drawn frame
+            Doremi::Core::TimerManager::GetInstance().EndFrame();
         }
     }
 
@@ -270,8 +299,7 @@ namespace Doremi
         const size_t length = m_managers.size();
         for(size_t i = 0; i < length; i++)
         {
-            const std::string& name = m_managers.at(i)->GetName();
-            NAMED_TIMER(name);
+            ID_TIMER(m_managers.at(i)->GetTimerID());
             m_managers.at(i)->Update(p_deltaTime);
         }
 
@@ -289,8 +317,7 @@ namespace Doremi
         using namespace Utilities::Logging;
         for(size_t i = 0; i < length; i++)
         {
-            const std::string& name = m_serverBrowserManagers.at(i)->GetName();
-            NAMED_TIMER(name);
+            ID_TIMER(m_serverBrowserManagers.at(i)->GetTimerID());
             m_serverBrowserManagers.at(i)->Update(p_deltaTime);
         }
     }
@@ -368,8 +395,7 @@ namespace Doremi
         using namespace Utilities::Logging;
         for(size_t i = 0; i < length; i++)
         {
-            const std::string& name = m_graphicalManagers.at(i)->GetName();
-            NAMED_TIMER(name);
+            ID_TIMER(m_graphicalManagers.at(i)->GetTimerID());
             m_graphicalManagers.at(i)->Update(p_deltaTime);
         }
         SkyBoxHandler::GetInstance()->Draw();
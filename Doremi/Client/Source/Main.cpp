@@ -11,6 +11,7 @@
 
 // Project specific
 #include <Game.hpp>
+#include <Doremi/Core/Include/Timing/TimerManager.hpp>
 
 // Third party
 
@@ -155,6 +156,9 @@ BOOL CtrlHandler(DWORD fdwCtrlType)
             attemptGracefulShutdown();
             Sleep(10000); // Sleep until 10 seconds, if process has been shutof during this time, this will exit correctly
             return TRUE;
+        case CTRL_BREAK_EVENT: // Write the timers of the last seconds, if they are captured
+            Doremi::Core::TimerManager::GetInstance().RequestTraceDump();
+            return TRUE;
         default:
             return FALSE;
     }
@@ -0,0 +1,110 @@
+#pragma once
+// Standard
+#include <DirectXMath.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace DoremiEngine
+{
+    namespace Core
+    {
+        class SharedContext;
+    }
+}
+
+namespace Doremi
+{
+    namespace Core
+    {
+        /**
+        Level of detail tiers for AI agents, decided by the distance to the closest player
+        */
+        enum class AILevelOfDetailTier
+        {
+            Near,
+            Medium,
+            Far,
+            Distant,
+            NumberOfTiers,
+        };
+
+        /**
+        Decides which AI agents should do their expensive updates (pathing, line of sight) each update.
+        Agents are put in tiers by their distance to the closest player, every tier has an update interval in updates.
+        The agents of a tier are spread evenly over the updates of the interval so the cost is the same every update.
+        */
+        class AILevelOfDetailHandler
+        {
+        public:
+            static AILevelOfDetailHandler* GetInstance();
+
+            static void StartupAILevelOfDetailHandler(const DoremiEngine::Core::SharedContext& p_sharedContext);
+
+            /**
+            Puts every AI agent in a tier and schedules the agents that should be updated this update.
+            Call once per update before the AI managers
+            */
+            void Update();
+
+            /**
+            Returns the agents of the given tier that should be updated this update
+            */
+            const std::vector<uint32_t>& GetScheduledAgents(const AILevelOfDetailTier& p_tier) const;
+
+            /**
+            Returns true if the agent should be updated this update
+            */
+            bool ShouldUpdate(const size_t& p_entityID) const;
+
+            /**
+            Returns the tier of the agent, Distant if the entity isn't an agent
+            */
+            AILevelOfDetailTier GetTier(const size_t& p_entityID) const;
+
+            /**
+            Returns the number of agents in the tier
+            */
+            size_t GetAgentCount(const AILevelOfDetailTier& p_tier) const { return m_agentCounts[static_cast<size_t>(p_tier)]; }
+
+            /**
+            Returns the name of the tier, used when timing the tiers
+            */
+            static const std::string& GetTierName(const AILevelOfDetailTier& p_tier);
+
+        private:
+            explicit AILevelOfDetailHandler(const DoremiEngine::Core::SharedContext& p_sharedContext);
+
+            ~AILevelOfDetailHandler();
+
+            struct AgentLevelOfDetail
+            {
+                AILevelOfDetailTier tier = AILevelOfDetailTier::Distant;
+                // Which update in the tier's interval the agent is updated on
+                uint32_t phase = 0;
+                bool active = false;
+                bool scheduled = false;
+            };
+
+            static AILevelOfDetailHandler* m_singleton;
+
+            const DoremiEngine::Core::SharedContext& m_sharedContext;
+
+            // The distance where each tier ends, the last tier has no end
+            float m_tierDistances[static_cast<size_t>(AILevelOfDetailTier::NumberOfTiers) - 1];
+            uint32_t m_tierIntervals[static_cast<size_t>(AILevelOfDetailTier::NumberOfTiers)];
+
+            // Indexed with entity id
+            std::vector<AgentLevelOfDetail> m_agents;
+            std::vector<uint32_t> m_scheduledAgents[static_cast<size_t>(AILevelOfDetailTier::NumberOfTiers)];
+            // Number of agents on each phase of each tier
+            std::vector<uint32_t> m_phaseLoads[static_cast<size_t>(AILevelOfDetailTier::NumberOfTiers)];
+            size_t m_agentCounts[static_cast<size_t>(AILevelOfDetailTier::NumberOfTiers)];
+
+            // Agents that changed tier this update and need a new phase, kept to avoid allocating every update
+            std::vector<uint32_t> m_changedAgents;
+            std::vector<DirectX::XMFLOAT3> m_playerPositions;
+            uint64_t m_updateCount;
+        };
+    }
+}
@@ -0,0 +1,68 @@
+#pragma once
+// Standard
+#include <DirectXMath.h>
+#include <cstdint>
+#include <vector>
+
+namespace DoremiEngine
+{
+    namespace Core
+    {
+        class SharedContext;
+    }
+}
+
+namespace Doremi
+{
+    namespace Core
+    {
+        /**
+        Positions the AI reads. When double buffered the AI sees the positions of the last finished update, written to a back buffer
+        and swapped in by Capture. This way the AI doesn't depend on which managers have moved things earlier in the update, and can run
+        while physics steps. When not double buffered the positions are read directly from the transform components.
+        */
+        class AITransformSnapshotHandler
+        {
+        public:
+            static AITransformSnapshotHandler* GetInstance();
+
+            /**
+            Double buffered if AsynchronousPhysics is set in the configuration
+            */
+            static void StartupAITransformSnapshotHandler(const DoremiEngine::Core::SharedContext& p_sharedContext);
+
+            /**
+            Copies the positions of all entities with a transform to the back buffer and swaps the buffers.
+            Call at the end of the update when all transforms are written. Does nothing when not double buffered
+            */
+            void Capture();
+
+            /**
+            Returns the position of the entity at the last capture. Entities created since then are read from their transform component
+            */
+            const DirectX::XMFLOAT3& GetPosition(const size_t& p_entityID) const;
+
+            bool IsDoubleBuffered() const { return m_doubleBuffered; }
+
+        private:
+            explicit AITransformSnapshotHandler(const DoremiEngine::Core::SharedContext& p_sharedContext);
+
+            ~AITransformSnapshotHandler();
+
+            struct Snapshot
+            {
+                std::vector<DirectX::XMFLOAT3> positions;
+                // If the entity had a transform when captured
+                std::vector<uint8_t> captured;
+            };
+
+            static AITransformSnapshotHandler* m_singleton;
+
+            const DoremiEngine::Core::SharedContext& m_sharedContext;
+
+            Snapshot m_snapshots[2];
+            uint32_t m_frontSnapshot;
+            bool m_doubleBuffered;
+        };
+    }
+}
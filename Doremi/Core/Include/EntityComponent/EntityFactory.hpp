@@ -69,6 +69,10 @@ namespace Doremi
             handler*/
             void ScrapEntity(int p_entityID);
 
+            /**
+            Number of entities alive that were created from each blueprint*/
+            const std::map<Blueprints, uint32_t>& GetEntityCounts() const { return m_entityCounts; }
+
 
         private:
             EntityFactory(const DoremiEngine::Core::SharedContext& p_sharedContext);
@@ -83,6 +87,11 @@ namespace Doremi
             const DoremiEngine::Core::SharedContext& m_sharedContext;
 
             std::map<Blueprints, EntityBlueprint> mEntityBlueprints;
+
+            // Blueprint each entity was created from, indexed by entity id
+            std::vector<Blueprints> m_entityBlueprints;
+            std::vector<uint8_t> m_entityCounted;
+            std::map<Blueprints, uint32_t> m_entityCounts;
         };
     }
 }
\ No newline at end of file
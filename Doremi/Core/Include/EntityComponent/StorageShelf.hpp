@@ -4,6 +4,8 @@
 #include <type_traits>
 #include <Doremi/Core/Include/EntityComponent/Components/LowerSkeletalAnimationComponent.hpp>
 #include <Doremi/Core/Include/EntityComponent/Components/SkeletalAnimationComponent.hpp>
+#include <Utility/Utilities/Include/Memory/MemoryAllocator.hpp>
+#include <new>
 
 // where we store the actual components/data
 template <typename T> class StorageShelf
@@ -15,13 +17,32 @@ public:
     T* GetPointerToArray() { return mItems; }
 
 private:
-    StorageShelf() : mItems(nullptr) { mItems = new T[MAX_NUM_ENTITIES](); }
+    // Straight from the system, so a big shelf can get large pages on the NUMA node of the server
+    StorageShelf() : mItems(nullptr)
+    {
+        using namespace Doremi::Utilities::Memory;
+        mPages = MemoryAllocator::AllocatePages(sizeof(T) * MAX_NUM_ENTITIES, MemoryAllocator::GetDefaultPageOptions());
+        mItems = static_cast<T*>(mPages.memory);
+        for(size_t i = 0; i < MAX_NUM_ENTITIES; ++i)
+        {
+            new(&mItems[i]) T();
+        }
+    }
 
     StorageShelf(const StorageShelf& t_item) = delete;
 
     ~StorageShelf() { FreeHelper(); }
 
-    void FreeHelper() { delete[] mItems; }
+    void FreeHelper()
+    {
+        for(size_t i = 0; i < MAX_NUM_ENTITIES; ++i)
+        {
+            mItems[i].~T();
+        }
+        Doremi::Utilities::Memory::MemoryAllocator::FreePages(mPages);
+    }
+
+    Doremi::Utilities::Memory::PageAllocation mPages;
 };
 
 // Temporary fix, when FreeHelper is called and the Template is LowerSkeletalAnimationComponent, do nothing, as the usual destruction crashes, TODOXX,
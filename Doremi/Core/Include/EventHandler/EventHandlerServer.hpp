@@ -31,6 +31,16 @@ namespace Doremi
             */
             void DeliverRemoveEvents();
 
+            /**
+                Events waiting for the next DeliverBasicEvents
+            */
+            size_t GetBasicEventCount() const { return m_basicEventBox.size(); }
+
+            /**
+                Events waiting for the next DeliverRemoveEvents
+            */
+            size_t GetRemoveEventCount() const { return m_removeEventBox.size(); }
+
         private:
             // Private constructors because Singleton
             EventHandlerServer();
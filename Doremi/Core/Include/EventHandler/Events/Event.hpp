@@ -39,6 +39,17 @@ namespace Doremi
         {
         public:
             explicit Event(EventType p_eventType) : eventType(p_eventType) {}
+
+            /**
+                Virtual so deleting an event through this struct destroys all of it and frees it with its real size
+            */
+            virtual ~Event() {}
+
+            /**
+                Events are created and deleted every update, they come from a thread safe pool instead of the heap
+            */
+            static void* operator new(size_t p_size);
+            static void operator delete(void* p_event, size_t p_size);
             /**
                 Write object to stream
             */
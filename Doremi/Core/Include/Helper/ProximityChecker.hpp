@@ -1,9 +1,19 @@
 #pragma once
 // Project specific
+#include <Doremi/Core/Include/Helper/SpatialHash.hpp>
 
 // Standard
 #include <vector>
 #include <DirectXMath.h>
+
+namespace DoremiEngine
+{
+    namespace Core
+    {
+        class SharedContext;
+    }
+}
+
 namespace Doremi
 {
     namespace Core
@@ -15,15 +25,50 @@ namespace Doremi
         {
         public:
             static ProximityChecker& GetInstance();
+
+            /**
+            Creates the checker with the spatial hash settings of the configuration. Without it GetInstance uses the default settings
+            */
+            static void StartupProximityChecker(const DoremiEngine::Core::SharedContext& p_sharedContext);
             virtual ~ProximityChecker();
             /**
             Returns true if the entity to check is in the proximity of entity
             */
             bool CheckProximityToEntity(size_t p_entityID, size_t p_entityToCheckID);
             /**
-            Returns a list of all entitys that are in proximity
+            Returns a list of all entitys that are in proximity, using the range component of the entity as proximity. Uses the spatial hash
             */
             std::vector<size_t> GetAllEntitysInProximity(size_t p_entityID);
+
+            /**
+            Syncs the spatial hash with the transform components of all entities. Call once per update before any of the spatial queries
+            */
+            void UpdateSpatialHash();
+
+            /**
+            Updates one entity in the spatial hash, use this if an entity has been moved (teleported etc.) after UpdateSpatialHash this update
+            */
+            void UpdateSpatialHashEntity(size_t p_entityID);
+
+            /**
+            Adds all entities within p_radius of p_center to o_entities
+            */
+            void GetEntitiesInRadius(const DirectX::XMFLOAT3& p_center, float p_radius, std::vector<uint32_t>& o_entities);
+
+            /**
+            Adds all entities inside the box to o_entities
+            */
+            void GetEntitiesInBox(const DirectX::XMFLOAT3& p_min, const DirectX::XMFLOAT3& p_max, std::vector<uint32_t>& o_entities);
+
+            /**
+            Adds the p_count entities closest to p_center, but not further away than p_maxRadius, to o_entities. Closest first
+            */
+            void GetClosestEntities(const DirectX::XMFLOAT3& p_center, size_t p_count, float p_maxRadius, std::vector<uint32_t>& o_entities);
+
+            /**
+            Returns the spatial hash, used for the batched queries
+            */
+            const SpatialHash& GetSpatialHash() const { return m_spatialHash; }
             /**
             Returns the distance between 2 entities
             */
@@ -35,10 +80,12 @@ namespace Doremi
 
         protected:
             static ProximityChecker* m_singleton;
-            ProximityChecker();
+            ProximityChecker(float p_cellSize, float p_looseMargin);
 
             // Help functions
             bool IsInProximity(const DirectX::XMFLOAT3& p_position1, const DirectX::XMFLOAT3& p_position2, const float& p_range);
+
+            SpatialHash m_spatialHash;
         };
     }
 }
@@ -0,0 +1,113 @@
+#pragma once
+// Standard
+#include <DirectXMath.h>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace Doremi
+{
+    namespace Core
+    {
+        /**
+        A loose uniform grid over entity positions. The grid cells are stored in a hash map so the level can be of any size.
+        An entity is put in the cell its position is in and stays there until it has left the cell by more than the loose margin.
+        Queries grow their search area by the same margin, this way fast moving entities don't have to change cell every update.
+        */
+        class SpatialHash
+        {
+        public:
+            /**
+            p_cellSize should be around the most common query radius, p_looseMargin is how far outside its cell an entity may be
+            */
+            SpatialHash(float p_cellSize, float p_looseMargin);
+            virtual ~SpatialHash();
+
+            /**
+            Inserts the entity, or updates the position if it is already in the hash
+            */
+            void UpdateEntity(uint32_t p_entityID, const DirectX::XMFLOAT3& p_position);
+
+            /**
+            Removes the entity from the hash. Does nothing if it isn't in the hash
+            */
+            void RemoveEntity(uint32_t p_entityID);
+
+            /**
+            Removes all entities
+            */
+            void Clear();
+
+            /**
+            Returns true if the entity is in the hash
+            */
+            bool Contains(uint32_t p_entityID) const;
+
+            /**
+            Returns the number of entities in the hash
+            */
+            size_t GetEntityCount() const { return m_entityCount; }
+
+            /**
+            Adds every entity within p_radius of p_center to o_entities
+            */
+            void QueryRadius(const DirectX::XMFLOAT3& p_center, float p_radius, std::vector<uint32_t>& o_entities) const;
+
+            /**
+            Adds every entity inside the box to o_entities
+            */
+            void QueryAABB(const DirectX::XMFLOAT3& p_min, const DirectX::XMFLOAT3& p_max, std::vector<uint32_t>& o_entities) const;
+
+            /**
+            Adds the p_count entities closest to p_center to o_entities, closest first. Entities further away than p_maxRadius are never returned,
+            which means fewer than p_count entities might be returned
+            */
+            void QueryKNearest(const DirectX::XMFLOAT3& p_center, size_t p_count, float p_maxRadius, std::vector<uint32_t>& o_entities) const;
+
+            /**
+            Batched version of QueryRadius. o_entities is resized to the number of centers and o_entities[i] gets the result for p_centers[i]
+            */
+            void QueryRadius(const std::vector<DirectX::XMFLOAT3>& p_centers, float p_radius, std::vector<std::vector<uint32_t>>& o_entities) const;
+
+            /**
+            Batched version of QueryKNearest. o_entities is resized to the number of centers and o_entities[i] gets the result for p_centers[i]
+            */
+            void QueryKNearest(const std::vector<DirectX::XMFLOAT3>& p_centers, size_t p_count, float p_maxRadius,
+                               std::vector<std::vector<uint32_t>>& o_entities) const;
+
+        private:
+            struct Entry
+            {
+                DirectX::XMFLOAT3 position;
+                int32_t cellX;
+                int32_t cellY;
+                int32_t cellZ;
+                uint32_t indexInCell;
+                bool active = false;
+            };
+
+            int32_t ToCellCoordinate(float p_value) const;
+            static uint64_t ToCellKey(int32_t p_x, int32_t p_y, int32_t p_z);
+            // Returns true if the position is still inside the cell grown by the loose margin
+            bool IsInsideLooseCell(const Entry& p_entry, const DirectX::XMFLOAT3& p_position) const;
+            void InsertIntoCell(uint32_t p_entityID, Entry& p_entry);
+            void RemoveFromCell(Entry& p_entry);
+
+            /**
+            Calls p_function with the id and entry of every entity in the cells overlapping the given box grown by the loose margin.
+            The entities still have to be tested against the actual query
+            */
+            template <typename Function> void ForEachCandidate(const DirectX::XMFLOAT3& p_min, const DirectX::XMFLOAT3& p_max, Function p_function) const;
+
+            float m_cellSize;
+            float m_inverseCellSize;
+            float m_looseMargin;
+
+            // Indexed with entity id
+            std::vector<Entry> m_entries;
+            std::unordered_map<uint64_t, std::vector<uint32_t>> m_cells;
+            size_t m_entityCount;
+        };
+    }
+}
@@ -23,6 +23,10 @@ namespace DoremiEngine
         class MeshInfo;
         class SkeletalInformation;
     }
+    namespace Physics
+    {
+        struct MeshBodyDescription;
+    }
 }
 
 namespace Doremi
@@ -101,14 +105,19 @@ namespace Doremi
             void LoadTransformsCharacter(std::ifstream& ifs, int nrTransforms); // TODOKO Remove and replase when cahracte have own format
             void LoadMeshes(std::ifstream& ifs, int nrMeshes);
             void LoadLights(std::ifstream& ifs, int nrLights);
-            void BuildEntities();
+            /**
+                Creates the entities of the level. The cooked physics meshes of the level are kept in p_cookedMeshFile
+            */
+            void BuildEntities(const std::string& p_cookedMeshFile);
             virtual bool BuildComponents(int p_entityId, int p_meshCouplingID, std::vector<DoremiEngine::Graphic::Vertex>& p_vertexBuffer) = 0;
 
             void LoadTriggers();
             std::vector<DoremiEngine::Graphic::Vertex>
             ComputeVertexAndPositionAndIndex(const DoremiEditor::Core::MeshData& p_data, const DirectX::XMFLOAT3& p_scale,
                                              std::vector<DirectX::XMFLOAT3>& o_positionPX, std::vector<int>& o_indexPX);
-            void SetPhysicalAttributesOnMesh(int p_entityID, std::vector<DirectX::XMFLOAT3>& p_positionPX, std::vector<int>& p_indexPX);
+            void SetPhysicalAttributesOnMeshes(std::vector<DoremiEngine::Physics::MeshBodyDescription>& p_meshBodies,
+                                               const std::string& p_cookedMeshFile);
+            void SetPhysicalAttributesOnMesh(int p_entityID);
             void CalculateAABBBoundingBox(const std::vector<DoremiEngine::Graphic::Vertex>& p_vertexBuffer, const DoremiEditor::Core::TransformData& p_transformationData,
                                           DirectX::XMFLOAT3& o_max, DirectX::XMFLOAT3& o_min, DirectX::XMFLOAT3& o_center);
             void CalculateOBBoundingBox(std::vector<DoremiEngine::Graphic::Vertex>& p_vertexBuffer, const DoremiEditor::Core::TransformData& p_transformationData,
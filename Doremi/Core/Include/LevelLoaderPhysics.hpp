@@ -0,0 +1,33 @@
+#pragma once
+#include <Doremi/Core/Include/LevelLoader.hpp>
+#include <DirectXMath.h>
+
+namespace Doremi
+{
+    namespace Core
+    {
+        /**
+            Loads only the static collision meshes of a level into the physics module, no entities or components are created.
+            Used to run the physics of a level on its own. Bodies get the IDs 0 and up in the order the level lists them
+        */
+        class LevelLoaderPhysics : public LevelLoader
+        {
+        public:
+            explicit LevelLoaderPhysics(const DoremiEngine::Core::SharedContext& p_sharedContext);
+
+            virtual ~LevelLoaderPhysics();
+
+            /**
+                Loads the level and returns the number of bodies created. o_min and o_max bound every body created.
+                Throws if the file can't be opened
+            */
+            int LoadLevel(const std::string& p_fileName, DirectX::XMFLOAT3& o_min, DirectX::XMFLOAT3& o_max);
+
+        protected:
+            /**
+                Not used, there are no entities to build components for
+            */
+            bool BuildComponents(int p_entityId, int p_meshCouplingID, std::vector<DoremiEngine::Graphic::Vertex>& p_vertexBuffer) override;
+        };
+    }
+}
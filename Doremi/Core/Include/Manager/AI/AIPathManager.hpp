@@ -4,6 +4,7 @@
 #include <Doremi/Core/Include/EventHandler/Subscriber.hpp>
 
 // Standard
+#include <string>
 #include <vector>
 
 namespace DoremiEngine
@@ -42,7 +43,8 @@ namespace Doremi
             void PerformJump(const int32_t& p_entityID);
 
             int m_maxActorsUpdated;
-            int m_actorToUpdate;
+            // Timers of each level of detail tier
+            std::vector<uint32_t> m_tierTimerIDs;
         };
     }
 }
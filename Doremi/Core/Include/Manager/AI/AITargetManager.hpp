@@ -1,5 +1,9 @@
 #pragma once
 #include <Doremi/Core/Include/Manager/Manager.hpp>
+#include <DoremiEngine/Physics/Include/RayCastManager.hpp>
+
+#include <string>
+#include <vector>
 namespace Doremi
 {
     namespace Core
@@ -15,12 +19,41 @@ namespace Doremi
             void Update(double p_dt) override;
 
         private:
+            /**
+            The targeting state of one AI agent during an update
+            */
+            struct AgentTargetState
+            {
+                size_t entityID;
+                bool shouldFire;
+                int closestVisiblePlayer;
+                float closestDistance;
+            };
+
+            /**
+            One line of sight check between an agent and a player, matched by index with the rays sent to physics
+            */
+            struct LineOfSightCheck
+            {
+                size_t agentStateIndex;
+                int playerID;
+                float distance;
+                DirectX::XMFLOAT3 direction;
+            };
+
             // Helper functions
             void FireAtEntity(const size_t& p_entityID, const size_t& p_enemyID, const float& p_distance);
 
             float m_playerMovementImpact;
             int m_maxActorsUpdated;
-            int m_actorToUpdate;
+            // Timers of each level of detail tier
+            std::vector<uint32_t> m_tierTimerIDs;
+
+            // Kept between updates to avoid allocating every update
+            std::vector<AgentTargetState> m_agentStates;
+            std::vector<LineOfSightCheck> m_lineOfSightChecks;
+            std::vector<DoremiEngine::Physics::RayCastQuery> m_rays;
+            std::vector<int> m_rayHits;
         };
     }
-}
\ No newline at end of file
+}
@@ -1,6 +1,8 @@
 #pragma once
 // Project specific
 #include <DoremiEngine/Core/Include/SharedContext.hpp>
+#include <Utility/Utilities/Include/Memory/Frame/FrameAllocator.hpp>
+#include <cstdint>
 #include <string>
 
 namespace Doremi
@@ -22,10 +24,18 @@ namespace Doremi
 
             const std::string& GetName() const { return m_name; }
 
+            /** Timer of the manager, for ID_TIMER around its update*/
+            uint32_t GetTimerID() const { return m_timerID; }
+
+            /** Arena for temporaries of one update, e.g. a FrameMap built and consumed in Update. Only valid on the update
+            thread and until the update after the next, the game loop calls SwapFrames once per update*/
+            static Utilities::Memory::FrameArena& GetFrameArena();
+
         protected:
             /** Engine-context form which specific interfaces can be accessed*/
             const DoremiEngine::Core::SharedContext& m_sharedContext;
             std::string m_name;
+            uint32_t m_timerID;
         };
     }
 }
\ No newline at end of file
@@ -3,6 +3,12 @@
 #include <Doremi/Core/Include/Manager/Manager.hpp>
 #include <Doremi/Core/Include/EventHandler/Subscriber.hpp>
 
+// Engine
+#include <DoremiEngine/Physics/Include/CharacterControlManager.hpp>
+
+// Standard
+#include <vector>
+
 namespace Doremi
 {
     namespace Core
@@ -20,6 +26,9 @@ namespace Doremi
             void OnEvent(Event* p_event) override;
 
         private:
+            // All controllers are moved in one batch. Kept between updates to not allocate every update
+            std::vector<DoremiEngine::Physics::ControllerMove> m_moves;
+            std::vector<DoremiEngine::Physics::ControllerCollisionFlags> m_collisionFlags;
         };
     }
 }
@@ -111,7 +111,10 @@ namespace Doremi
                   ConnectedSocketHandle(0),
                   MyPlayerID(0),
                   LastSequenceUpdate(SEQUENCE_TIMER_START),
-                  LastResponse(0)
+                  LastResponse(0),
+                  BytesSent(0),
+                  PayloadBytesSent(0),
+                  BytesReceived(0)
             {
             }
             ClientConnectionStateFromServer ConnectionState;
@@ -120,6 +123,14 @@ namespace Doremi
 
             double LastSequenceUpdate;
             double LastResponse;
+
+            /**
+                Traffic since it was last logged as telemetry. Messages have a fixed size, the payload is the part of them
+                actually written to
+            */
+            uint32_t BytesSent;
+            uint32_t PayloadBytesSent;
+            uint32_t BytesReceived;
         };
 
         struct MasterConnectionFromServer
@@ -14,6 +14,10 @@ namespace DoremiEngine
     {
         class Adress;
     }
+    namespace Logging
+    {
+        class Logger;
+    }
 }
 
 namespace Doremi
@@ -67,6 +71,11 @@ namespace Doremi
             */
             void SendConnectedMessages();
 
+            /**
+                Logs the traffic of every connected client since the last update as telemetry
+            */
+            void LogConnectionTelemetry();
+
             void SendMasterMessages(double p_dt);
 
             /**
@@ -109,6 +118,10 @@ namespace Doremi
             uint8_t m_maxConnectedMessagesPerFrame;
 
             uint8_t m_maxAcceptConnectionsPerFrame;
+
+            DoremiEngine::Logging::Logger* m_logger;
+
+            uint32_t m_connectionTelemetrySchema;
         };
     }
 }
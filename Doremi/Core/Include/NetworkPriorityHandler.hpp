@@ -2,6 +2,7 @@
 #include <Doremi/Core/Include/EntityComponent/Components/NetworkObjectComponent.hpp>
 #include <Doremi/Core/Include/EntityComponent/Constants.hpp>
 #include <Doremi/Core/Include/Streamers/NetworkStreamer.hpp>
+#include <Utility/Utilities/Include/Memory/PageSpecification.hpp>
 #include <list>
 #include <vector>
 
@@ -55,6 +56,8 @@ namespace Doremi
 
             ~NetworkPriorityHandler();
 
+            NetworkPriorityHandler(const NetworkPriorityHandler&) = delete;
+
             /**
                 Update all priorities and check if relevant or not
             */
@@ -84,7 +87,12 @@ namespace Doremi
             /**
                 Component per object, per player, contains priority and timers
             */
-            NetworkObjectComponent m_netPriorityObjects[MAX_NUM_ENTITIES];
+            NetworkObjectComponent* m_netPriorityObjects;
+
+            /**
+                Pages of m_netPriorityObjects, one array per client so it gets large pages on the NUMA node of the server
+            */
+            Utilities::Memory::PageAllocation m_netPriorityPages;
 
             /**
                 List of IDs that will be sorted by priority
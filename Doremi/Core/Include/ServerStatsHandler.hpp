@@ -0,0 +1,80 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace DoremiEngine
+{
+    namespace Core
+    {
+        class SharedContext;
+    }
+    namespace Network
+    {
+        class Adress;
+    }
+}
+
+namespace Doremi
+{
+    namespace Core
+    {
+        struct FrameProfile;
+
+        /**
+        Statistics of a running server for anything polling it locally, e.g. a scraper in the same container. Connecting to StatsPort on
+        localhost gives a snapshot in the Prometheus text format, after which the connection is closed. The snapshot has tick time
+        percentiles, the timers of the TimerManager, the connections with their traffic, entities by blueprint and waiting events.
+        */
+        class ServerStatsHandler
+        {
+        public:
+            static ServerStatsHandler* GetInstance();
+
+            /**
+            Listens on StatsPort from the configuration, 0 doesn't listen
+            */
+            static void StartupServerStatsHandler(const DoremiEngine::Core::SharedContext& p_sharedContext);
+
+            /**
+            Call once per update with the seconds it took. Sends a snapshot to the connections waiting
+            */
+            void Update(const double& p_updateTime);
+
+            /**
+            The snapshot sent to a connection
+            */
+            std::string BuildSnapshot();
+
+            /**
+            Smallest sample which at least p_fraction of the samples are less than or equal to. Reorders p_samples
+            */
+            static double GetPercentile(std::vector<double>& p_samples, const double& p_fraction);
+
+            // Updates the tick time percentiles are taken over
+            static const uint32_t UPDATE_WINDOW = 1024;
+
+        private:
+            explicit ServerStatsHandler(const DoremiEngine::Core::SharedContext& p_sharedContext);
+
+            ~ServerStatsHandler();
+
+            void WriteTimers(std::string& o_snapshot, const FrameProfile& p_profile);
+
+            static ServerStatsHandler* m_singleton;
+
+            const DoremiEngine::Core::SharedContext& m_sharedContext;
+
+            // Last UPDATE_WINDOW update times, written in a circle
+            std::vector<double> m_updateTimes;
+            std::vector<double> m_sortedUpdateTimes;
+            uint64_t m_updateCount;
+
+            bool m_listening;
+            size_t m_listenSocketHandle;
+            DoremiEngine::Network::Adress* m_acceptedAdress;
+            // Snapshots are built on the update thread, this limits the time a burst of connections can take
+            uint32_t m_maxSnapshotsPerUpdate;
+        };
+    }
+}
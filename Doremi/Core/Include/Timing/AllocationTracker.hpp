@@ -0,0 +1,105 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+namespace DoremiEngine
+{
+    namespace Core
+    {
+        class SharedContext;
+    }
+}
+
+namespace Doremi
+{
+    namespace Core
+    {
+        /**
+        Allocations made inside one timer, by the innermost FUNCTION_TIMER, NAMED_TIMER or ID_TIMER running at the time
+        */
+        struct ScopeAllocations
+        {
+            uint32_t timerID;
+            // Allocated in the scope and not yet freed
+            int64_t liveBytes;
+            int64_t liveAllocations;
+            // Allocations since tracking started
+            uint64_t allocations;
+        };
+
+        /**
+        Finds what is leaking on a long running server. When built with BUILD_ALLOCATION_TRACKING the global operator new and
+        delete are replaced, and with AllocationTracking in the configuration every allocation is counted for the timer
+        running on the allocating thread. A report of the timers whose live bytes grew the most is logged every
+        AllocationReportSeconds.
+        Only allocations of this executable are seen, the engine modules are separate dlls with their own operator new. A
+        block allocated here and freed by a module is never subtracted, so it shows as live.
+        */
+        class AllocationTracker
+        {
+        public:
+            static AllocationTracker* GetInstance();
+
+            /**
+            Starts tracking if the configuration asks for it and it is built in
+            */
+            static void StartupAllocationTracker(const DoremiEngine::Core::SharedContext& p_sharedContext);
+
+            /**
+            Makes p_timerID the scope of allocations on the calling thread. Returns the scope it replaces, for LeaveScope
+            */
+            static uint32_t EnterScope(const uint32_t& p_timerID);
+
+            static void LeaveScope(const uint32_t& p_outerScope);
+
+            /**
+            True if built with BUILD_ALLOCATION_TRACKING
+            */
+            static bool IsBuiltIn();
+
+            /**
+            True if allocations are being counted
+            */
+            static bool IsTracking();
+
+            /**
+            Starts or stops counting allocations. Blocks allocated while counting are subtracted when freed either way
+            */
+            static void SetTracking(const bool& p_tracking);
+
+            /**
+            Scopes which have allocated anything
+            */
+            static std::vector<ScopeAllocations> GetScopes();
+
+            /**
+            Call once per update, logs the report when it is time
+            */
+            void Update(const double& p_deltaTime);
+
+            /**
+            Logs the scopes whose live bytes grew the most since the last report
+            */
+            void LogReport();
+
+            // Timers with a higher id are counted as outside any timer
+            static const uint32_t MAX_SCOPES = 4096;
+            // Scopes in each report
+            static const uint32_t REPORTED_SCOPES = 10;
+
+        private:
+            explicit AllocationTracker(const DoremiEngine::Core::SharedContext& p_sharedContext);
+
+            ~AllocationTracker();
+
+            static AllocationTracker* m_singleton;
+
+            const DoremiEngine::Core::SharedContext& m_sharedContext;
+
+            double m_reportSeconds;
+            double m_timeSinceReport;
+            // Live bytes of each scope at the last report
+            std::vector<int64_t> m_reportedLiveBytes;
+        };
+    }
+}
@@ -1,23 +1,13 @@
 #pragma once
 #include <Doremi/Core/Include/Timing/TimerManager.hpp>
-#include <string>
-
-namespace Doremi
-{
-    namespace Core
-    {
-        struct NamedTimerRAII
-        {
-            explicit NamedTimerRAII(const std::string& p_name) : name(p_name) { TimerManager::GetInstance().StartTimer(name); }
-
-            ~NamedTimerRAII() { TimerManager::GetInstance().StopTimer(name); }
-            std::string name;
-        };
-    }
-}
 
 #ifdef USE_CUSTOM_TIMER
-#define NAMED_TIMER(X) Doremi::Core::NamedTimerRAII namedTimer = Doremi::Core::NamedTimerRAII(X);
+/*
+X has to be a string literal, use TimerManager::RegisterTimer and ID_TIMER for names built at runtime.
+*/
+#define NAMED_TIMER(X) Doremi::Core::TimerRAII namedTimer(DOREMI_TIMER_SITE_ID("" X ""));
+#define ID_TIMER(X) Doremi::Core::TimerRAII idTimer(X);
 #else
 #define NAMED_TIMER(X) ;
-#endif
\ No newline at end of file
+#define ID_TIMER(X) ;
+#endif
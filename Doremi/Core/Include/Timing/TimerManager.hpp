@@ -1,7 +1,11 @@
 #pragma once
-#include <unordered_map>
-#include <Utility/Utilities/Include/Chrono/Timer.hpp>
+#include <Doremi/Core/Include/Timing/AllocationTracker.hpp>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace DoremiEngine
 {
@@ -15,85 +19,274 @@ namespace Doremi
 {
     namespace Core
     {
-        struct TimerData
+        /**
+        One FUNCTION_TIMER or NAMED_TIMER. Lives as a static at the call site, so its name is never copied and it is only
+        looked up the first time it runs.
+        */
+        struct TimerSite
         {
-            explicit TimerData(uint32_t p_startLine) : data(0), startLine(p_startLine) {}
-
-            ~TimerData() {}
-
-            Utilities::Chrono::Timer timer;
-            double data;
-            uint32_t startLine;
+            TimerSite(const char* p_name, const char* p_file, const uint32_t& p_line) : name(p_name), file(p_file), line(p_line), id(0) {}
+            const char* name;
+            const char* file;
+            uint32_t line;
+            // Given by the TimerManager the first time the timer starts, zero until then
+            std::atomic<uint32_t> id;
         };
 
-        struct TimerKey
+        /**
+        Time spent in one timer when called from one particular chain of timers
+        */
+        struct TimerNode
         {
-            TimerKey(const std::string& p_file, const std::string& p_function, const uint32_t& p_line)
-                : file(p_file), function(p_function), line(p_line)
-            {
-            }
-
-            ~TimerKey() {}
-
-            bool operator==(const TimerKey& rhs) const { return (rhs.file == file && rhs.function == function && rhs.line == line); }
-
-            std::string file;
-            std::string function;
-            uint32_t line;
+            // Zero for the root of a thread
+            uint32_t timerID;
+            // Index of the parent in the same profile, NO_PARENT for the root of a thread
+            uint32_t parent;
+            uint32_t thread;
+            // Children of the same parent are linked in the order they first ran, NO_PARENT ends the list
+            uint32_t firstChild;
+            uint32_t nextSibling;
+            uint32_t calls;
+            uint64_t ticks;
         };
 
-        struct TimerKeyHasher
+        /**
+        Call tree of one frame or of all frames. The roots are the threads which have used a timer, nodes always come after
+        their parent.
+        */
+        struct FrameProfile
         {
-            std::size_t operator()(const TimerKey& key) const
-            {
-                std::hash<std::string> hasher;
-                return hasher(key.file + key.function + std::to_string(key.line));
-            }
+            static const uint32_t NO_PARENT = 0xffffffff;
+
+            std::vector<TimerNode> nodes;
+            // First root, the roots are linked like children
+            uint32_t firstRoot = NO_PARENT;
+            // Ticks from the end of the previous frame to the end of this one, summed for all frames
+            uint64_t frameTicks = 0;
+            uint32_t frameCount = 0;
+            double ticksPerSecond = 1;
+
+            double GetSeconds(const uint64_t& p_ticks) const { return static_cast<double>(p_ticks) / ticksPerSecond; }
         };
 
+        /**
+        Hierarchical profiler behind FUNCTION_TIMER and NAMED_TIMER. Starting and stopping a timer writes a timestamp to a
+        ring of the calling thread, nothing is looked up or allocated. EndFrame turns the rings into the call tree of the
+        frame and adds it to the call tree of the whole run, which DumpData logs.
+        If a ring is full, timers started on that thread are not recorded until the next EndFrame has emptied it.
+        */
         class TimerManager
         {
         public:
+            TimerManager();
+            virtual ~TimerManager();
+
             TimerManager(const TimerManager& p_timerManager) = delete;
             void operator=(const TimerManager&) = delete;
 
             /**
-            TODO docs
+            Profiler used by the timer macros
             */
             static TimerManager& GetInstance();
 
             /**
-            TODO docs
+            Returns the id of a call site, registering it the first time
             */
-            const TimerData* const StartTimer(const std::string& p_file, const std::string& p_function, const uint32_t& p_lineNumber);
+            uint32_t GetTimerID(TimerSite& p_site)
+            {
+                const uint32_t id = p_site.id.load(std::memory_order_acquire);
+                return id != 0 ? id : RegisterSite(p_site);
+            }
 
             /**
-            TODO docs
+            Returns the id of a timer with a name built at runtime, e.g. from the name of a manager. The same name gives the
+            same id. Meant to be called once and the id kept, use it with ID_TIMER
             */
-            void TimerManager::StopTimer(const TimerData* const p_timer);
+            uint32_t RegisterTimer(const std::string& p_name);
+
+            void StartTimer(const uint32_t& p_timerID);
+
+            void StopTimer(const uint32_t& p_timerID);
 
             /**
-            TODO docs
+            Ends the frame of the calling thread. Collects the timers of every thread since the last call into the call tree
+            of the frame, timers still running are split at the end of the frame. Call once per game loop.
             */
-            void StartTimer(const std::string& p_name);
+            void EndFrame();
 
             /**
-            TODO docs
+            Call tree of the last frame. Only valid on the thread calling EndFrame
             */
-            void StopTimer(const std::string& p_name);
+            const FrameProfile& GetLastFrame() const { return m_lastFrame; }
 
+            /**
+            Call tree of the longest frame so far. Only valid on the thread calling EndFrame
+            */
+            const FrameProfile& GetSlowestFrame() const { return m_slowestFrame; }
+
+            /**
+            Call tree of all frames. Only valid on the thread calling EndFrame
+            */
+            const FrameProfile& GetTotal() const { return m_total; }
 
             /**
-            TODO docs
+            Name of a timer, "Thread" for the root of a thread
+            */
+            std::string GetTimerName(const uint32_t& p_timerID);
+
+            /**
+            Ends the current frame and logs the call tree of all frames and of the slowest frame
             */
             void DumpData(const DoremiEngine::Core::SharedContext& p_sharedContext);
 
+            /**
+            Starts keeping every timer of the last p_seconds, at most TRACE_MAX_EVENTS, for WriteTrace. If a frame takes longer
+            than p_spikeThreshold seconds the trace is written by EndFrame, 0 doesn't look for spikes.
+            */
+            void StartTraceCapture(const double& p_seconds, const double& p_spikeThreshold);
+
+            void StopTraceCapture();
+
+            /**
+            Makes the next EndFrame write the trace. Safe to call from any thread, e.g. a console control handler
+            */
+            void RequestTraceDump() { m_traceRequested.store(true, std::memory_order_relaxed); }
+
+            /**
+            Writes the captured timers up to the last EndFrame as Chrome trace event JSON, which opens in Perfetto or
+            chrome://tracing. Returns false if nothing is captured or the file can't be written.
+            */
+            bool WriteTrace(const std::string& p_fileName);
+
+            // Events a thread can keep between two EndFrame
+            static const uint32_t THREAD_RING_SIZE = 16384;
+            // Events the trace capture can keep, 16 bytes each
+            static const uint32_t TRACE_MAX_EVENTS = 1 << 20;
+
         private:
-            TimerManager();
-            virtual ~TimerManager();
+            struct TimerEvent
+            {
+                uint64_t timestamp;
+                uint32_t timerID;
+                uint32_t isStart;
+            };
+
+            struct OpenTimer
+            {
+                uint32_t timerID;
+                uint32_t node;
+                uint64_t start;
+            };
+
+            /**
+            Ring written by one thread and read by EndFrame
+            */
+            struct ThreadTimers
+            {
+                // Padded rather than aligned since the rings are allocated with new, which may not align them
+                std::atomic<uint64_t> head;
+                char headPadding[64 - sizeof(std::atomic<uint64_t>)];
+                std::atomic<uint64_t> tail;
+                char tailPadding[64 - sizeof(std::atomic<uint64_t>)];
+                // Owning thread only: timers recorded and not stopped, and timers not recorded since the ring was full
+                uint32_t depth;
+                uint32_t skippedDepth;
+                // EndFrame only
+                uint32_t index;
+                std::vector<OpenTimer> openTimers;
+                TimerEvent events[THREAD_RING_SIZE];
+            };
+
+            struct TraceEvent
+            {
+                uint64_t timestamp;
+                uint32_t timerID;
+                // Index of the thread, the highest bit is set for a start
+                uint32_t threadAndStart;
+            };
 
-            std::unordered_map<TimerKey, TimerData, TimerKeyHasher> m_timers;
-            std::unordered_map<std::string, TimerData> m_namedTimers;
+            struct SiteInfo
+            {
+                std::string name;
+                std::string file;
+                uint32_t line;
+            };
+
+            uint32_t RegisterSite(TimerSite& p_site);
+            ThreadTimers& GetThreadTimers();
+
+            // Pushes if at least p_requiredSpace events are free
+            bool Push(ThreadTimers& p_thread, const TimerEvent& p_event, const uint32_t& p_requiredSpace);
+
+            void CollectThread(ThreadTimers& p_thread);
+            // Finds or adds the node of a timer under p_parent, or the root of p_thread if p_parent is NO_PARENT
+            static uint32_t GetChild(FrameProfile& p_profile, const uint32_t& p_parent, const uint32_t& p_timerID, const uint32_t& p_thread);
+            void AddToTotal(const FrameProfile& p_frame);
+            void LogProfile(const std::string& p_title, const FrameProfile& p_profile, const DoremiEngine::Core::SharedContext& p_sharedContext);
+            // Called with m_frameLock held
+            bool WriteTraceFile(const std::string& p_fileName);
+
+            // Indexed by timer id, zero is the root of a thread
+            std::vector<SiteInfo> m_sites;
+            std::unordered_map<std::string, uint32_t> m_namedTimers;
+            std::mutex m_sitesLock;
+
+            std::vector<ThreadTimers*> m_threads;
+            std::mutex m_threadsLock;
+            // Tells the thread_local ring of a destroyed TimerManager from the ring of one created at the same address
+            const uint64_t m_instance;
+
+            // Only used by EndFrame
+            std::mutex m_frameLock;
+            std::vector<ThreadTimers*> m_frameThreads;
+            std::vector<uint32_t> m_totalIndices;
+            FrameProfile m_frame;
+            FrameProfile m_lastFrame;
+            FrameProfile m_slowestFrame;
+            FrameProfile m_total;
+            uint64_t m_frameStart;
+            // Clock calibration, rdtsc ticks are converted to seconds by comparing them to the steady clock
+            uint64_t m_calibrationTicks;
+            double m_calibrationSeconds;
+            double m_ticksPerSecond;
+
+            // Trace capture, a ring of the last events collected by EndFrame. Empty when not capturing
+            std::vector<TraceEvent> m_traceEvents;
+            uint64_t m_traceEventCount;
+            double m_traceSeconds;
+            double m_traceSpikeThreshold;
+            // End of the last written trace, a spike doesn't write another trace of the same frames
+            uint64_t m_lastTraceEnd;
+            uint32_t m_traceCount;
+            std::atomic<bool> m_traceRequested;
+        };
+
+        /**
+        Starts a timer and stops it when leaving the scope
+        */
+        struct TimerRAII
+        {
+            explicit TimerRAII(const uint32_t& p_timerID) : timerID(p_timerID), outerScope(AllocationTracker::EnterScope(p_timerID))
+            {
+                TimerManager::GetInstance().StartTimer(timerID);
+            }
+            ~TimerRAII()
+            {
+                TimerManager::GetInstance().StopTimer(timerID);
+                AllocationTracker::LeaveScope(outerScope);
+            }
+            const uint32_t timerID;
+            // Allocation scope of the enclosing timer
+            const uint32_t outerScope;
         };
     }
-}
\ No newline at end of file
+}
+
+/*
+Every call site gets a static TimerSite, so a running game only passes its id.
+*/
+#define DOREMI_TIMER_SITE_ID(p_name)                                                                                                                 \
+    [](const char* p_siteName) -> uint32_t {                                                                                                         \
+        static Doremi::Core::TimerSite site(p_siteName, __FILE__, __LINE__);                                                                         \
+        return Doremi::Core::TimerManager::GetInstance().GetTimerID(site);                                                                           \
+    }(p_name)
@@ -0,0 +1,187 @@
+// Project specific
+#include <Doremi/Core/Include/AIHelper/AILevelOfDetailHandler.hpp>
+#include <Doremi/Core/Include/AIHelper/AITransformSnapshotHandler.hpp>
+#include <Doremi/Core/Include/PlayerHandlerServer.hpp>
+#include <EntityComponent/EntityHandler.hpp>
+#include <EntityComponent/Components/TransformComponent.hpp>
+
+// Engine
+#include <DoremiEngine/Core/Include/SharedContext.hpp>
+#include <DoremiEngine/Configuration/Include/ConfigurationModule.hpp>
+
+// Standard
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace Doremi
+{
+    namespace Core
+    {
+        AILevelOfDetailHandler* AILevelOfDetailHandler::m_singleton = nullptr;
+
+        AILevelOfDetailHandler* AILevelOfDetailHandler::GetInstance()
+        {
+            if(m_singleton == nullptr)
+            {
+                throw std::runtime_error("GetInstance called before StartupAILevelOfDetailHandler");
+            }
+            return m_singleton;
+        }
+
+        void AILevelOfDetailHandler::StartupAILevelOfDetailHandler(const DoremiEngine::Core::SharedContext& p_sharedContext)
+        {
+            if(m_singleton != nullptr)
+            {
+                throw std::runtime_error("StartupAILevelOfDetailHandler called multiple times.");
+            }
+            m_singleton = new AILevelOfDetailHandler(p_sharedContext);
+        }
+
+        AILevelOfDetailHandler::AILevelOfDetailHandler(const DoremiEngine::Core::SharedContext& p_sharedContext)
+            : m_sharedContext(p_sharedContext), m_updateCount(0)
+        {
+            const DoremiEngine::Configuration::ConfiguartionInfo& t_configInfo = p_sharedContext.GetConfigurationModule().GetAllConfigurationValues();
+            m_tierDistances[static_cast<size_t>(AILevelOfDetailTier::Near)] = t_configInfo.AILODNearDistance;
+            m_tierDistances[static_cast<size_t>(AILevelOfDetailTier::Medium)] = t_configInfo.AILODMediumDistance;
+            m_tierDistances[static_cast<size_t>(AILevelOfDetailTier::Far)] = t_configInfo.AILODFarDistance;
+            m_tierIntervals[static_cast<size_t>(AILevelOfDetailTier::Near)] = std::max(1, t_configInfo.AILODNearInterval);
+            m_tierIntervals[static_cast<size_t>(AILevelOfDetailTier::Medium)] = std::max(1, t_configInfo.AILODMediumInterval);
+            m_tierIntervals[static_cast<size_t>(AILevelOfDetailTier::Far)] = std::max(1, t_configInfo.AILODFarInterval);
+            m_tierIntervals[static_cast<size_t>(AILevelOfDetailTier::Distant)] = std::max(1, t_configInfo.AILODDistantInterval);
+
+            const size_t numberOfTiers = static_cast<size_t>(AILevelOfDetailTier::NumberOfTiers);
+            for(size_t i = 0; i < numberOfTiers; ++i)
+            {
+                m_phaseLoads[i].resize(m_tierIntervals[i], 0);
+                m_agentCounts[i] = 0;
+            }
+        }
+
+        AILevelOfDetailHandler::~AILevelOfDetailHandler() {}
+
+        void AILevelOfDetailHandler::Update()
+        {
+            using namespace DirectX;
+            EntityHandler& t_entityHandler = EntityHandler::GetInstance();
+            AITransformSnapshotHandler* t_snapshot = AITransformSnapshotHandler::GetInstance();
+            const size_t numberOfTiers = static_cast<size_t>(AILevelOfDetailTier::NumberOfTiers);
+
+            // Get the positions of all players once
+            m_playerPositions.clear();
+            std::map<uint32_t, PlayerServer*>& t_players = static_cast<PlayerHandlerServer*>(PlayerHandler::GetInstance())->GetPlayerMap();
+            for(auto& pairs : t_players)
+            {
+                EntityID playerID = pairs.second->m_playerEntityID;
+                if(t_entityHandler.HasComponents(playerID, (int)ComponentType::Transform))
+                {
+                    m_playerPositions.push_back(t_snapshot->GetPosition(playerID));
+                }
+            }
+
+            for(size_t i = 0; i < numberOfTiers; ++i)
+            {
+                m_scheduledAgents[i].clear();
+                std::fill(m_phaseLoads[i].begin(), m_phaseLoads[i].end(), 0);
+                m_agentCounts[i] = 0;
+            }
+            m_changedAgents.clear();
+
+            /// First pass, put every agent in the tier of its closest player. Agents keeping their tier keep their phase
+            const size_t length = t_entityHandler.GetLastEntityIndex();
+            if(m_agents.size() < length)
+            {
+                m_agents.resize(length);
+            }
+            const size_t numberOfPlayers = m_playerPositions.size();
+            for(size_t i = 0; i < length; ++i)
+            {
+                AgentLevelOfDetail& agent = m_agents[i];
+                agent.scheduled = false;
+                if(!t_entityHandler.HasComponents(i, (int)ComponentType::AIAgent | (int)ComponentType::Transform))
+                {
+                    agent.active = false;
+                    continue;
+                }
+
+                const XMFLOAT3& position = t_snapshot->GetPosition(i);
+                float closestDistanceSquared = std::numeric_limits<float>::max();
+                for(size_t j = 0; j < numberOfPlayers; ++j)
+                {
+                    float x = m_playerPositions[j].x - position.x;
+                    float y = m_playerPositions[j].y - position.y;
+                    float z = m_playerPositions[j].z - position.z;
+                    closestDistanceSquared = std::min(closestDistanceSquared, x * x + y * y + z * z);
+                }
+
+                // No players means every agent ends up in the last tier
+                size_t tier = 0;
+                while(tier < numberOfTiers - 1 && closestDistanceSquared > m_tierDistances[tier] * m_tierDistances[tier])
+                {
+                    ++tier;
+                }
+
+                const AILevelOfDetailTier newTier = static_cast<AILevelOfDetailTier>(tier);
+                if(agent.active && agent.tier == newTier)
+                {
+                    ++m_phaseLoads[tier][agent.phase];
+                }
+                else
+                {
+                    agent.tier = newTier;
+                    agent.active = true;
+                    m_changedAgents.push_back(static_cast<uint32_t>(i));
+                }
+                ++m_agentCounts[tier];
+            }
+
+            /// Second pass, new agents and agents that changed tier go on the least crowded phase of their tier
+            for(uint32_t entityID : m_changedAgents)
+            {
+                AgentLevelOfDetail& agent = m_agents[entityID];
+                std::vector<uint32_t>& loads = m_phaseLoads[static_cast<size_t>(agent.tier)];
+                agent.phase = static_cast<uint32_t>(std::min_element(loads.begin(), loads.end()) - loads.begin());
+                ++loads[agent.phase];
+            }
+
+            /// Last pass, schedule the agents whose phase is this update
+            for(size_t i = 0; i < length; ++i)
+            {
+                AgentLevelOfDetail& agent = m_agents[i];
+                if(!agent.active)
+                {
+                    continue;
+                }
+                const size_t tier = static_cast<size_t>(agent.tier);
+                if(m_updateCount % m_tierIntervals[tier] == agent.phase)
+                {
+                    agent.scheduled = true;
+                    m_scheduledAgents[tier].push_back(static_cast<uint32_t>(i));
+                }
+            }
+            ++m_updateCount;
+        }
+
+        const std::vector<uint32_t>& AILevelOfDetailHandler::GetScheduledAgents(const AILevelOfDetailTier& p_tier) const
+        {
+            return m_scheduledAgents[static_cast<size_t>(p_tier)];
+        }
+
+        bool AILevelOfDetailHandler::ShouldUpdate(const size_t& p_entityID) const { return p_entityID < m_agents.size() && m_agents[p_entityID].scheduled; }
+
+        AILevelOfDetailTier AILevelOfDetailHandler::GetTier(const size_t& p_entityID) const
+        {
+            if(p_entityID < m_agents.size() && m_agents[p_entityID].active)
+            {
+                return m_agents[p_entityID].tier;
+            }
+            return AILevelOfDetailTier::Distant;
+        }
+
+        const std::string& AILevelOfDetailHandler::GetTierName(const AILevelOfDetailTier& p_tier)
+        {
+            static const std::string names[] = {"Near", "Medium", "Far", "Distant"};
+            return names[static_cast<size_t>(p_tier)];
+        }
+    }
+}
@@ -0,0 +1,83 @@
+// Project specific
+#include <Doremi/Core/Include/AIHelper/AITransformSnapshotHandler.hpp>
+#include <EntityComponent/EntityHandler.hpp>
+#include <EntityComponent/Components/TransformComponent.hpp>
+
+// Engine
+#include <DoremiEngine/Core/Include/SharedContext.hpp>
+#include <DoremiEngine/Configuration/Include/ConfigurationModule.hpp>
+
+// Standard
+#include <stdexcept>
+
+namespace Doremi
+{
+    namespace Core
+    {
+        AITransformSnapshotHandler* AITransformSnapshotHandler::m_singleton = nullptr;
+
+        AITransformSnapshotHandler* AITransformSnapshotHandler::GetInstance()
+        {
+            if(m_singleton == nullptr)
+            {
+                throw std::runtime_error("GetInstance called before StartupAITransformSnapshotHandler");
+            }
+            return m_singleton;
+        }
+
+        void AITransformSnapshotHandler::StartupAITransformSnapshotHandler(const DoremiEngine::Core::SharedContext& p_sharedContext)
+        {
+            if(m_singleton != nullptr)
+            {
+                throw std::runtime_error("StartupAITransformSnapshotHandler called multiple times.");
+            }
+            m_singleton = new AITransformSnapshotHandler(p_sharedContext);
+        }
+
+        AITransformSnapshotHandler::AITransformSnapshotHandler(const DoremiEngine::Core::SharedContext& p_sharedContext)
+            : m_sharedContext(p_sharedContext), m_frontSnapshot(0)
+        {
+            m_doubleBuffered = p_sharedContext.GetConfigurationModule().GetAllConfigurationValues().AsynchronousPhysics != 0;
+        }
+
+        AITransformSnapshotHandler::~AITransformSnapshotHandler() {}
+
+        void AITransformSnapshotHandler::Capture()
+        {
+            if(!m_doubleBuffered)
+            {
+                return;
+            }
+
+            EntityHandler& t_entityHandler = EntityHandler::GetInstance();
+            const size_t length = t_entityHandler.GetLastEntityIndex();
+
+            // Only the back buffer is written, the front buffer stays untouched for anyone reading it
+            Snapshot& t_back = m_snapshots[1 - m_frontSnapshot];
+            t_back.positions.resize(length);
+            t_back.captured.assign(length, 0);
+            for(size_t i = 0; i < length; ++i)
+            {
+                if(t_entityHandler.HasComponents(i, (int)ComponentType::Transform))
+                {
+                    t_back.positions[i] = t_entityHandler.GetComponentFromStorage<TransformComponent>(i)->position;
+                    t_back.captured[i] = 1;
+                }
+            }
+            m_frontSnapshot = 1 - m_frontSnapshot;
+        }
+
+        const DirectX::XMFLOAT3& AITransformSnapshotHandler::GetPosition(const size_t& p_entityID) const
+        {
+            if(m_doubleBuffered)
+            {
+                const Snapshot& t_front = m_snapshots[m_frontSnapshot];
+                if(p_entityID < t_front.captured.size() && t_front.captured[p_entityID])
+                {
+                    return t_front.positions[p_entityID];
+                }
+            }
+            return EntityHandler::GetInstance().GetComponentFromStorage<TransformComponent>(p_entityID)->position;
+        }
+    }
+}
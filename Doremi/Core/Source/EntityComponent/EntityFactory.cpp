@@ -84,6 +84,12 @@ namespace Doremi
 
         void EntityFactory::ScrapEntity(int p_entityID)
         {
+            if(m_entityCounted[p_entityID] != 0)
+            {
+                --m_entityCounts[m_entityBlueprints[p_entityID]];
+                m_entityCounted[p_entityID] = 0;
+            }
+
             DoremiEngine::Physics::PhysicsModule& physicsModule = m_sharedContext.GetPhysicsModule();
             ComponentTable* tComponentTable = ComponentTable::GetInstance();
             if(tComponentTable->HasComponent(p_entityID, (int)ComponentType::RigidBody))
@@ -106,7 +112,10 @@ namespace Doremi
             }
         }
 
-        EntityFactory::EntityFactory(const DoremiEngine::Core::SharedContext& p_sharedContext) : m_sharedContext(p_sharedContext) {}
+        EntityFactory::EntityFactory(const DoremiEngine::Core::SharedContext& p_sharedContext)
+            : m_sharedContext(p_sharedContext), m_entityBlueprints(MAX_NUM_ENTITIES, Blueprints::EmptyEntity), m_entityCounted(MAX_NUM_ENTITIES, 0)
+        {
+        }
 
         EntityFactory::~EntityFactory() {}
 
@@ -115,6 +124,14 @@ namespace Doremi
             EntityBlueprint tComponentMap = mEntityBlueprints[p_blueprintID];
             ComponentTable* tComponentTable = ComponentTable::GetInstance();
 
+            if(m_entityCounted[p_entityID] != 0)
+            {
+                --m_entityCounts[m_entityBlueprints[p_entityID]];
+            }
+            m_entityBlueprints[p_entityID] = p_blueprintID;
+            m_entityCounted[p_entityID] = 1;
+            ++m_entityCounts[p_blueprintID];
+
             for(EntityBlueprint::iterator iter = tComponentMap.begin(); iter != tComponentMap.end(); ++iter)
             {
 
@@ -0,0 +1,25 @@
+#include <EventHandler/Events/Event.hpp>
+#include <Utility/Utilities/Include/Memory/Pool/SlabPoolResource.hpp>
+
+namespace Doremi
+{
+    namespace Core
+    {
+        namespace
+        {
+            // Events of each size a slab holds
+            const size_t EVENTS_PER_SLAB = 256;
+
+            Utilities::Memory::SlabPoolResource& GetEventPool()
+            {
+                // Never deleted, events may be deleted while static objects are destroyed
+                static Utilities::Memory::SlabPoolResource* eventPool = new Utilities::Memory::SlabPoolResource(EVENTS_PER_SLAB);
+                return *eventPool;
+            }
+        }
+
+        void* Event::operator new(size_t p_size) { return GetEventPool().Allocate(p_size); }
+
+        void Event::operator delete(void* p_event, size_t p_size) { GetEventPool().Deallocate(p_event, p_size); }
+    }
+}
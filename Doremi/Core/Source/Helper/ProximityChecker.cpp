@@ -4,8 +4,11 @@
 #include <EntityComponent/EntityHandler.hpp>
 #include <EntityComponent/Components/TransformComponent.hpp>
 #include <EntityComponent/Components/RangeComponent.hpp>
+#include <DoremiEngine/Core/Include/SharedContext.hpp>
+#include <DoremiEngine/Configuration/Include/ConfigurationModule.hpp>
 
 // Standard
+#include <stdexcept>
 
 namespace Doremi
 {
@@ -16,12 +19,24 @@ namespace Doremi
         {
             if(m_singleton == nullptr)
             {
-                m_singleton = new ProximityChecker();
+                const DoremiEngine::Configuration::ConfiguartionInfo t_defaults;
+                m_singleton = new ProximityChecker(t_defaults.SpatialHashCellSize, t_defaults.SpatialHashLooseMargin);
             }
             return *m_singleton;
         }
 
-        ProximityChecker::ProximityChecker() {}
+        void ProximityChecker::StartupProximityChecker(const DoremiEngine::Core::SharedContext& p_sharedContext)
+        {
+            if(m_singleton != nullptr)
+            {
+                throw std::runtime_error("StartupProximityChecker called multiple times or after GetInstance.");
+            }
+            const DoremiEngine::Configuration::ConfiguartionInfo& t_configuration =
+                p_sharedContext.GetConfigurationModule().GetAllConfigurationValues();
+            m_singleton = new ProximityChecker(t_configuration.SpatialHashCellSize, t_configuration.SpatialHashLooseMargin);
+        }
+
+        ProximityChecker::ProximityChecker(float p_cellSize, float p_looseMargin) : m_spatialHash(p_cellSize, p_looseMargin) {}
         ProximityChecker::~ProximityChecker() {}
         bool ProximityChecker::CheckProximityToEntity(size_t p_entityID, size_t p_entityToCheckID)
         {
@@ -50,9 +65,67 @@ namespace Doremi
         std::vector<size_t> ProximityChecker::GetAllEntitysInProximity(size_t p_entityID)
         {
             std::vector<size_t> retVector;
+            int mask = (int)ComponentType::Transform | (int)ComponentType::Range;
+            if(!EntityHandler::GetInstance().HasComponents(p_entityID, mask))
+            {
+                // TODOKO log error
+                return retVector;
+            }
+            RangeComponent* rangeComp = EntityHandler::GetInstance().GetComponentFromStorage<RangeComponent>(p_entityID);
+            TransformComponent* transform = EntityHandler::GetInstance().GetComponentFromStorage<TransformComponent>(p_entityID);
+
+            std::vector<uint32_t> entitiesInRange;
+            m_spatialHash.QueryRadius(transform->position, rangeComp->range, entitiesInRange);
+            for(auto entityID : entitiesInRange)
+            {
+                if(entityID != p_entityID)
+                {
+                    retVector.push_back(entityID);
+                }
+            }
             return retVector;
         }
 
+        void ProximityChecker::UpdateSpatialHash()
+        {
+            EntityHandler& entityHandler = EntityHandler::GetInstance();
+            const size_t length = entityHandler.GetLastEntityIndex();
+            for(size_t i = 0; i < length; i++)
+            {
+                UpdateSpatialHashEntity(i);
+            }
+        }
+
+        void ProximityChecker::UpdateSpatialHashEntity(size_t p_entityID)
+        {
+            EntityHandler& entityHandler = EntityHandler::GetInstance();
+            if(entityHandler.HasComponents(p_entityID, (int)ComponentType::Transform))
+            {
+                TransformComponent* transform = entityHandler.GetComponentFromStorage<TransformComponent>(p_entityID);
+                m_spatialHash.UpdateEntity(static_cast<uint32_t>(p_entityID), transform->position);
+            }
+            else
+            {
+                // Removed entities, and entities that lost their transform, are removed here
+                m_spatialHash.RemoveEntity(static_cast<uint32_t>(p_entityID));
+            }
+        }
+
+        void ProximityChecker::GetEntitiesInRadius(const DirectX::XMFLOAT3& p_center, float p_radius, std::vector<uint32_t>& o_entities)
+        {
+            m_spatialHash.QueryRadius(p_center, p_radius, o_entities);
+        }
+
+        void ProximityChecker::GetEntitiesInBox(const DirectX::XMFLOAT3& p_min, const DirectX::XMFLOAT3& p_max, std::vector<uint32_t>& o_entities)
+        {
+            m_spatialHash.QueryAABB(p_min, p_max, o_entities);
+        }
+
+        void ProximityChecker::GetClosestEntities(const DirectX::XMFLOAT3& p_center, size_t p_count, float p_maxRadius, std::vector<uint32_t>& o_entities)
+        {
+            m_spatialHash.QueryKNearest(p_center, p_count, p_maxRadius, o_entities);
+        }
+
         float ProximityChecker::GetDistanceBetweenEntities(const size_t& p_firstEntityID, const size_t& p_secondEntityID)
         {
             // Make sure both entities have a transform
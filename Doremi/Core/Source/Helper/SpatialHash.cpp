@@ -0,0 +1,270 @@
+// Project specific
+#include <Helper/SpatialHash.hpp>
+
+// Standard
+#include <algorithm>
+#include <cmath>
+
+namespace Doremi
+{
+    namespace Core
+    {
+        namespace
+        {
+            // Each axis gets 21 bits of the cell key
+            const int32_t CELL_COORDINATE_OFFSET = 1 << 20;
+            const uint64_t CELL_COORDINATE_MASK = (1 << 21) - 1;
+
+            float DistanceSquared(const DirectX::XMFLOAT3& p_first, const DirectX::XMFLOAT3& p_second)
+            {
+                float x = p_first.x - p_second.x;
+                float y = p_first.y - p_second.y;
+                float z = p_first.z - p_second.z;
+                return x * x + y * y + z * z;
+            }
+        }
+
+        template <typename Function>
+        void SpatialHash::ForEachCandidate(const DirectX::XMFLOAT3& p_min, const DirectX::XMFLOAT3& p_max, Function p_function) const
+        {
+            // Entities may be up to the loose margin outside their cell
+            const int32_t minX = ToCellCoordinate(p_min.x - m_looseMargin);
+            const int32_t minY = ToCellCoordinate(p_min.y - m_looseMargin);
+            const int32_t minZ = ToCellCoordinate(p_min.z - m_looseMargin);
+            const int32_t maxX = ToCellCoordinate(p_max.x + m_looseMargin);
+            const int32_t maxY = ToCellCoordinate(p_max.y + m_looseMargin);
+            const int32_t maxZ = ToCellCoordinate(p_max.z + m_looseMargin);
+
+            // If the box covers more cells than there are occupied cells it's cheaper to just walk all of them
+            const double cellsInBox = static_cast<double>(maxX - minX + 1) * (maxY - minY + 1) * (maxZ - minZ + 1);
+            if(cellsInBox > static_cast<double>(m_cells.size()))
+            {
+                for(auto& cell : m_cells)
+                {
+                    for(uint32_t entityID : cell.second)
+                    {
+                        const Entry& entry = m_entries[entityID];
+                        if(entry.cellX >= minX && entry.cellX <= maxX && entry.cellY >= minY && entry.cellY <= maxY && entry.cellZ >= minZ &&
+                           entry.cellZ <= maxZ)
+                        {
+                            p_function(entityID, entry);
+                        }
+                    }
+                }
+                return;
+            }
+
+            for(int32_t z = minZ; z <= maxZ; ++z)
+            {
+                for(int32_t y = minY; y <= maxY; ++y)
+                {
+                    for(int32_t x = minX; x <= maxX; ++x)
+                    {
+                        auto cell = m_cells.find(ToCellKey(x, y, z));
+                        if(cell == m_cells.end())
+                        {
+                            continue;
+                        }
+                        for(uint32_t entityID : cell->second)
+                        {
+                            p_function(entityID, m_entries[entityID]);
+                        }
+                    }
+                }
+            }
+        }
+
+        SpatialHash::SpatialHash(float p_cellSize, float p_looseMargin)
+            : m_cellSize(p_cellSize), m_inverseCellSize(1.0f / p_cellSize), m_looseMargin(p_looseMargin), m_entityCount(0)
+        {
+        }
+
+        SpatialHash::~SpatialHash() {}
+
+        void SpatialHash::UpdateEntity(uint32_t p_entityID, const DirectX::XMFLOAT3& p_position)
+        {
+            if(p_entityID >= m_entries.size())
+            {
+                m_entries.resize(p_entityID + 1);
+            }
+            Entry& entry = m_entries[p_entityID];
+            if(!entry.active)
+            {
+                entry.position = p_position;
+                entry.cellX = ToCellCoordinate(p_position.x);
+                entry.cellY = ToCellCoordinate(p_position.y);
+                entry.cellZ = ToCellCoordinate(p_position.z);
+                InsertIntoCell(p_entityID, entry);
+                entry.active = true;
+                ++m_entityCount;
+                return;
+            }
+
+            entry.position = p_position;
+            // Only move the entity to another cell if it has left the loose bounds of its current cell
+            if(!IsInsideLooseCell(entry, p_position))
+            {
+                RemoveFromCell(entry);
+                entry.cellX = ToCellCoordinate(p_position.x);
+                entry.cellY = ToCellCoordinate(p_position.y);
+                entry.cellZ = ToCellCoordinate(p_position.z);
+                InsertIntoCell(p_entityID, entry);
+            }
+        }
+
+        void SpatialHash::RemoveEntity(uint32_t p_entityID)
+        {
+            if(!Contains(p_entityID))
+            {
+                return;
+            }
+            Entry& entry = m_entries[p_entityID];
+            RemoveFromCell(entry);
+            entry.active = false;
+            --m_entityCount;
+        }
+
+        void SpatialHash::Clear()
+        {
+            m_entries.clear();
+            m_cells.clear();
+            m_entityCount = 0;
+        }
+
+        bool SpatialHash::Contains(uint32_t p_entityID) const { return p_entityID < m_entries.size() && m_entries[p_entityID].active; }
+
+        void SpatialHash::QueryRadius(const DirectX::XMFLOAT3& p_center, float p_radius, std::vector<uint32_t>& o_entities) const
+        {
+            using namespace DirectX;
+            const float radiusSquared = p_radius * p_radius;
+            XMFLOAT3 min = XMFLOAT3(p_center.x - p_radius, p_center.y - p_radius, p_center.z - p_radius);
+            XMFLOAT3 max = XMFLOAT3(p_center.x + p_radius, p_center.y + p_radius, p_center.z + p_radius);
+            ForEachCandidate(min, max, [&](uint32_t p_entityID, const Entry& p_entry)
+                             {
+                                 if(DistanceSquared(p_entry.position, p_center) <= radiusSquared)
+                                 {
+                                     o_entities.push_back(p_entityID);
+                                 }
+                             });
+        }
+
+        void SpatialHash::QueryAABB(const DirectX::XMFLOAT3& p_min, const DirectX::XMFLOAT3& p_max, std::vector<uint32_t>& o_entities) const
+        {
+            ForEachCandidate(p_min, p_max, [&](uint32_t p_entityID, const Entry& p_entry)
+                             {
+                                 const DirectX::XMFLOAT3& position = p_entry.position;
+                                 if(position.x >= p_min.x && position.y >= p_min.y && position.z >= p_min.z && position.x <= p_max.x &&
+                                    position.y <= p_max.y && position.z <= p_max.z)
+                                 {
+                                     o_entities.push_back(p_entityID);
+                                 }
+                             });
+        }
+
+        void SpatialHash::QueryKNearest(const DirectX::XMFLOAT3& p_center, size_t p_count, float p_maxRadius, std::vector<uint32_t>& o_entities) const
+        {
+            using namespace DirectX;
+            if(p_count == 0 || m_entityCount == 0)
+            {
+                return;
+            }
+
+            // Search a growing sphere until it holds enough entities. Once it does, the closest ones are guaranteed to be in it
+            std::vector<std::pair<float, uint32_t>> candidates;
+            float radius = std::min(m_cellSize, p_maxRadius);
+            while(true)
+            {
+                candidates.clear();
+                const float radiusSquared = radius * radius;
+                XMFLOAT3 min = XMFLOAT3(p_center.x - radius, p_center.y - radius, p_center.z - radius);
+                XMFLOAT3 max = XMFLOAT3(p_center.x + radius, p_center.y + radius, p_center.z + radius);
+                ForEachCandidate(min, max, [&](uint32_t p_entityID, const Entry& p_entry)
+                                 {
+                                     float distanceSquared = DistanceSquared(p_entry.position, p_center);
+                                     if(distanceSquared <= radiusSquared)
+                                     {
+                                         candidates.push_back(std::make_pair(distanceSquared, p_entityID));
+                                     }
+                                 });
+                if(candidates.size() >= p_count || candidates.size() == m_entityCount || radius >= p_maxRadius)
+                {
+                    break;
+                }
+                radius = std::min(radius * 2.0f, p_maxRadius);
+            }
+
+            const size_t resultCount = std::min(p_count, candidates.size());
+            std::partial_sort(candidates.begin(), candidates.begin() + resultCount, candidates.end());
+            for(size_t i = 0; i < resultCount; ++i)
+            {
+                o_entities.push_back(candidates[i].second);
+            }
+        }
+
+        void SpatialHash::QueryRadius(const std::vector<DirectX::XMFLOAT3>& p_centers, float p_radius, std::vector<std::vector<uint32_t>>& o_entities) const
+        {
+            const size_t length = p_centers.size();
+            o_entities.resize(length);
+            for(size_t i = 0; i < length; ++i)
+            {
+                o_entities[i].clear();
+                QueryRadius(p_centers[i], p_radius, o_entities[i]);
+            }
+        }
+
+        void SpatialHash::QueryKNearest(const std::vector<DirectX::XMFLOAT3>& p_centers, size_t p_count, float p_maxRadius,
+                                        std::vector<std::vector<uint32_t>>& o_entities) const
+        {
+            const size_t length = p_centers.size();
+            o_entities.resize(length);
+            for(size_t i = 0; i < length; ++i)
+            {
+                o_entities[i].clear();
+                QueryKNearest(p_centers[i], p_count, p_maxRadius, o_entities[i]);
+            }
+        }
+
+        int32_t SpatialHash::ToCellCoordinate(float p_value) const { return static_cast<int32_t>(std::floor(p_value * m_inverseCellSize)); }
+
+        uint64_t SpatialHash::ToCellKey(int32_t p_x, int32_t p_y, int32_t p_z)
+        {
+            uint64_t x = static_cast<uint64_t>(p_x + CELL_COORDINATE_OFFSET) & CELL_COORDINATE_MASK;
+            uint64_t y = static_cast<uint64_t>(p_y + CELL_COORDINATE_OFFSET) & CELL_COORDINATE_MASK;
+            uint64_t z = static_cast<uint64_t>(p_z + CELL_COORDINATE_OFFSET) & CELL_COORDINATE_MASK;
+            return x | (y << 21) | (z << 42);
+        }
+
+        bool SpatialHash::IsInsideLooseCell(const Entry& p_entry, const DirectX::XMFLOAT3& p_position) const
+        {
+            float minX = p_entry.cellX * m_cellSize - m_looseMargin;
+            float minY = p_entry.cellY * m_cellSize - m_looseMargin;
+            float minZ = p_entry.cellZ * m_cellSize - m_looseMargin;
+            float size = m_cellSize + 2.0f * m_looseMargin;
+            return p_position.x >= minX && p_position.y >= minY && p_position.z >= minZ && p_position.x < minX + size && p_position.y < minY + size &&
+                   p_position.z < minZ + size;
+        }
+
+        void SpatialHash::InsertIntoCell(uint32_t p_entityID, Entry& p_entry)
+        {
+            std::vector<uint32_t>& cell = m_cells[ToCellKey(p_entry.cellX, p_entry.cellY, p_entry.cellZ)];
+            p_entry.indexInCell = static_cast<uint32_t>(cell.size());
+            cell.push_back(p_entityID);
+        }
+
+        void SpatialHash::RemoveFromCell(Entry& p_entry)
+        {
+            auto cellIterator = m_cells.find(ToCellKey(p_entry.cellX, p_entry.cellY, p_entry.cellZ));
+            std::vector<uint32_t>& cell = cellIterator->second;
+
+            // Swap with the last one in the cell so we don't have to move everything
+            uint32_t lastEntity = cell.back();
+            cell[p_entry.indexInCell] = lastEntity;
+            m_entries[lastEntity].indexInCell = p_entry.indexInCell;
+            cell.pop_back();
+            if(cell.empty())
+            {
+                m_cells.erase(cellIterator);
+            }
+        }
+    }
+}
@@ -328,8 +328,10 @@ namespace Doremi
             }
         }
 
-        void LevelLoader::BuildEntities()
+        void LevelLoader::BuildEntities(const std::string& p_cookedMeshFile)
         {
+            // Mesh bodies are added after all entities are built, so their meshes can be cooked at the same time
+            std::vector<DoremiEngine::Physics::MeshBodyDescription> meshBodies;
             const size_t length = m_meshCoupling.size();
             for(size_t i = 0; i < length; i++)
             {
@@ -351,9 +353,16 @@ namespace Doremi
                 bool shouldBuildPhysics = BuildComponents(entityID, i, vertexBuffer);
                 if(shouldBuildPhysics)
                 {
-                    SetPhysicalAttributesOnMesh(entityID, positionPX, indexPX);
+                    DoremiEngine::Physics::MeshBodyDescription meshBody;
+                    meshBody.id = entityID;
+                    meshBody.position = m_currentPos;
+                    meshBody.orientation = m_currentOrientation;
+                    meshBody.vertexPositions = std::move(positionPX);
+                    meshBody.indices = std::move(indexPX);
+                    meshBodies.push_back(std::move(meshBody));
                 }
             }
+            SetPhysicalAttributesOnMeshes(meshBodies, p_cookedMeshFile);
         }
 
         void LevelLoader::LoadTriggers()
@@ -449,16 +458,31 @@ namespace Doremi
             return vertexBuffer;
         }
 
-        // TODORT Boths vectors should be const
-        void LevelLoader::SetPhysicalAttributesOnMesh(int p_entityID, std::vector<DirectX::XMFLOAT3>& p_positionPX, std::vector<int>& p_indexPX)
+        void LevelLoader::SetPhysicalAttributesOnMeshes(std::vector<DoremiEngine::Physics::MeshBodyDescription>& p_meshBodies,
+                                                        const std::string& p_cookedMeshFile)
         {
             using namespace DoremiEngine::Physics;
             PhysicsModule& physicsModule = m_sharedContext.GetPhysicsModule();
             RigidBodyManager& rigidBodyManager = physicsModule.GetRigidBodyManager();
             PhysicsMaterialManager& physicsMaterialManager = physicsModule.GetPhysicsMaterialManager();
 
-            const int material = physicsMaterialManager.CreateMaterial(0.5, 0.5, 0.5);
-            rigidBodyManager.AddMeshBodyStatic(p_entityID, m_currentPos, m_currentOrientation, p_positionPX, p_indexPX, material);
+            for(auto& meshBody : p_meshBodies)
+            {
+                meshBody.materialID = physicsMaterialManager.CreateMaterial(0.5, 0.5, 0.5);
+            }
+            // Cooks all meshes not in the file at once
+            rigidBodyManager.AddMeshBodiesStatic(p_meshBodies, p_cookedMeshFile);
+
+            for(auto& meshBody : p_meshBodies)
+            {
+                SetPhysicalAttributesOnMesh(meshBody.id);
+            }
+        }
+
+        void LevelLoader::SetPhysicalAttributesOnMesh(int p_entityID)
+        {
+            using namespace DoremiEngine::Physics;
+            RigidBodyManager& rigidBodyManager = m_sharedContext.GetPhysicsModule().GetRigidBodyManager();
             rigidBodyManager.SetDrain(p_entityID, true);
 
             // Add component
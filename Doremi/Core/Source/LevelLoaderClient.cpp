@@ -65,7 +65,8 @@ namespace Doremi
                 LoadTransforms(ifs, nrTransforms);
                 LoadMeshes(ifs, nrMeshes);
                 LoadLights(ifs, nrLights);
-                BuildEntities();
+                // The physics meshes are cooked once and then kept in a file next to the level
+                BuildEntities(fileName + ".cookedmeshes");
                 LoadTriggers();
 
                 BuildLights();
@@ -0,0 +1,110 @@
+/// Game side
+#include <LevelLoaderPhysics.hpp>
+
+/// Engine side
+#include <DoremiEngine/Core/Include/SharedContext.hpp>
+// Physics
+#include <DoremiEngine/Physics/Include/PhysicsModule.hpp>
+#include <DoremiEngine/Physics/Include/PhysicsMaterialManager.hpp>
+#include <DoremiEngine/Physics/Include/RigidBodyManager.hpp>
+
+/// Standard
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+
+namespace Doremi
+{
+    namespace Core
+    {
+        LevelLoaderPhysics::LevelLoaderPhysics(const DoremiEngine::Core::SharedContext& p_sharedContext) : LevelLoader(p_sharedContext) {}
+
+        LevelLoaderPhysics::~LevelLoaderPhysics() {}
+
+        int LevelLoaderPhysics::LoadLevel(const std::string& p_fileName, DirectX::XMFLOAT3& o_min, DirectX::XMFLOAT3& o_max)
+        {
+            using namespace std;
+            using namespace DirectX;
+            const string fileName = m_sharedContext.GetWorkingDirectory() + p_fileName;
+            ifstream ifs;
+            ifs.open(fileName, ifstream::in | ifstream::binary);
+            if(!ifs.is_open())
+            {
+                throw runtime_error("Failed to open level: " + fileName);
+            }
+
+            // scene name
+            int sceneNameSize;
+            ifs.read((char*)&sceneNameSize, sizeof(int));
+            vector<char> sceneName(sceneNameSize);
+            ifs.read(sceneName.data(), sizeof(char) * sceneNameSize);
+            m_sceneName = string(sceneName.data(), strnlen(sceneName.data(), sceneName.size()));
+
+            // how much different stuff there is
+            int nrMats, nrTransforms, nrMeshes, nrLights;
+            ifs.read((char*)&nrMats, sizeof(int));
+            ifs.read((char*)&nrTransforms, sizeof(int));
+            ifs.read((char*)&nrMeshes, sizeof(int));
+            ifs.read((char*)&nrLights, sizeof(int));
+
+            LoadMaterial(ifs, nrMats);
+            LoadTransforms(ifs, nrTransforms);
+            LoadMeshes(ifs, nrMeshes);
+            LoadLights(ifs, nrLights);
+
+            // Same selection as the server, colliders except checkpoints. Moving platforms and other bodies with components are left out
+            const float maxFloat = numeric_limits<float>::max();
+            o_min = XMFLOAT3(maxFloat, maxFloat, maxFloat);
+            o_max = XMFLOAT3(-maxFloat, -maxFloat, -maxFloat);
+            vector<DoremiEngine::Physics::MeshBodyDescription> meshBodies;
+            const size_t length = m_meshCoupling.size();
+            for(size_t i = 0; i < length; i++)
+            {
+                const DoremiEditor::Core::TransformData& transformData = m_transforms[m_meshCoupling[i].transformName];
+                if(!transformData.attributes.isCollider || transformData.attributes.checkPointID > -1)
+                {
+                    continue;
+                }
+
+                DoremiEngine::Physics::MeshBodyDescription meshBody;
+                vector<DoremiEngine::Graphic::Vertex> vertexBuffer = ComputeVertexAndPositionAndIndex(
+                    m_meshes[m_meshCoupling[i].meshName], transformData.scale, meshBody.vertexPositions, meshBody.indices);
+
+                XMFLOAT3 bodyMax, bodyMin, bodyCenter;
+                CalculateAABBBoundingBox(vertexBuffer, transformData, bodyMax, bodyMin, bodyCenter);
+                o_min = XMFLOAT3(min(o_min.x, bodyMin.x), min(o_min.y, bodyMin.y), min(o_min.z, bodyMin.z));
+                o_max = XMFLOAT3(max(o_max.x, bodyMax.x), max(o_max.y, bodyMax.y), max(o_max.z, bodyMax.z));
+
+                meshBody.id = static_cast<int>(meshBodies.size());
+                meshBody.position = transformData.translation;
+                meshBody.orientation = transformData.rotation;
+                meshBodies.push_back(move(meshBody));
+            }
+
+            using namespace DoremiEngine::Physics;
+            RigidBodyManager& rigidBodyManager = m_sharedContext.GetPhysicsModule().GetRigidBodyManager();
+            PhysicsMaterialManager& physicsMaterialManager = m_sharedContext.GetPhysicsModule().GetPhysicsMaterialManager();
+            for(auto& meshBody : meshBodies)
+            {
+                meshBody.materialID = physicsMaterialManager.CreateMaterial(0.5, 0.5, 0.5);
+            }
+            // Shares the cooked meshes with the game
+            rigidBodyManager.AddMeshBodiesStatic(meshBodies, fileName + ".cookedmeshes");
+
+            // Same attributes as LevelLoader::SetPhysicalAttributesOnMesh, without the component
+            for(auto& meshBody : meshBodies)
+            {
+                rigidBodyManager.SetDrain(meshBody.id, true);
+                rigidBodyManager.SetCallbackFiltering(meshBody.id, 1, 0, 0, 0);
+            }
+            return static_cast<int>(meshBodies.size());
+        }
+
+        bool LevelLoaderPhysics::BuildComponents(int p_entityId, int p_meshCouplingID, std::vector<DoremiEngine::Graphic::Vertex>& p_vertexBuffer)
+        {
+            return false;
+        }
+    }
+}
@@ -86,7 +86,8 @@ namespace Doremi
                 LoadTransforms(ifs, nrTransforms);
                 LoadMeshes(ifs, nrMeshes);
                 LoadLights(ifs, nrLights);
-                BuildEntities();
+                // The physics meshes are cooked once and then kept in a file next to the level
+                BuildEntities(fileName + ".cookedmeshes");
                 std::vector<DoremiEngine::AI::PotentialField*>& potentialFields =
                     m_sharedContext.GetAIModule().GetPotentialFieldSubModule().GetAllActiveFields();
                 size_t length = potentialFields.size();
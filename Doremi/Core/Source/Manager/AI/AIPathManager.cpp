@@ -19,6 +19,10 @@
 #include <EventHandler/Events/PlayerCreationEvent.hpp>
 // Force Equations
 #include <AIHelper/ForceImpactFunctions.hpp>
+#include <AIHelper/AILevelOfDetailHandler.hpp>
+#include <AIHelper/AITransformSnapshotHandler.hpp>
+// Timing
+#include <Timing/NamedTimer.hpp>
 // Engine
 #include <DoremiEngine/Physics/Include/PhysicsModule.hpp>
 #include <DoremiEngine/Physics/Include/RigidBodyManager.hpp>
@@ -47,8 +51,13 @@ namespace Doremi
             EventHandler::GetInstance()->Subscribe(EventType::RangedEnemyCreated, this);
             EventHandler::GetInstance()->Subscribe(EventType::MeleeEnemyCreated, this);
             EventHandler::GetInstance()->Subscribe(EventType::PlayerCreation, this);
-            m_maxActorsUpdated = 1000; // We may only update one AI per update... TODOCONFIG
-            m_actorToUpdate = 0;
+            m_maxActorsUpdated = 1000; // Safety cap, the level of detail decides who gets updated... TODOCONFIG
+            const size_t numberOfTiers = static_cast<size_t>(AILevelOfDetailTier::NumberOfTiers);
+            for(size_t i = 0; i < numberOfTiers; i++)
+            {
+                const std::string name = m_name + " " + AILevelOfDetailHandler::GetTierName(static_cast<AILevelOfDetailTier>(i));
+                m_tierTimerIDs.push_back(TimerManager::GetInstance().RegisterTimer(name));
+            }
         }
 
         AIPathManager::~AIPathManager() {}
@@ -56,24 +65,17 @@ namespace Doremi
 
         void AIPathManager::Update(double p_dt)
         {
-            int updatedActors = 0;
-            size_t length = EntityHandler::GetInstance().GetLastEntityIndex();
-            int lastUpdatedActor = 0;
-            for(size_t i = m_actorToUpdate + 1; i != m_actorToUpdate; i++)
+            EntityHandler& t_entityHandler = EntityHandler::GetInstance();
+            AITransformSnapshotHandler* t_snapshot = AITransformSnapshotHandler::GetInstance();
+            size_t length = t_entityHandler.GetLastEntityIndex();
+
+            /// Update actors position, every actor needs this every update since the fields depend on them
+            for(size_t i = 0; i < length; i++)
             {
-                if(i > length)
-                {
-                    i = 0;
-                    if(i == m_actorToUpdate)
-                    {
-                        break;
-                    }
-                }
-                // Update actors position, should perhaps not be here...
-                if(EntityHandler::GetInstance().HasComponents(i, (int)ComponentType::PotentialField | (int)ComponentType::Transform))
+                if(t_entityHandler.HasComponents(i, (int)ComponentType::PotentialField | (int)ComponentType::Transform))
                 { // This is so the player updates his position too...
-                    PotentialFieldComponent* pfComp = EntityHandler::GetInstance().GetComponentFromStorage<PotentialFieldComponent>(i);
-                    XMFLOAT3 pos = EntityHandler::GetInstance().GetComponentFromStorage<TransformComponent>(i)->position;
+                    PotentialFieldComponent* pfComp = t_entityHandler.GetComponentFromStorage<PotentialFieldComponent>(i);
+                    XMFLOAT3 pos = t_snapshot->GetPosition(i);
                     if(!pfComp->isField) // If not a field we assume it's a actor who needs updating
                     {
                         pfComp->ChargedActor->SetPosition(pos);
@@ -83,67 +85,91 @@ namespace Doremi
                         pfComp->Field->SetCenter(pos);
                     }
                 }
-                if(EntityHandler::GetInstance().HasComponents(i, (int)ComponentType::AIAgent | (int)ComponentType::Transform |
-                                                                     (int)ComponentType::Movement | (int)ComponentType::PotentialField))
+            }
+
+            // Phermones decay every update, also for agents that aren't updated this time
+            m_sharedContext.GetAIModule().GetPotentialFieldSubModule().UpdatePhermones(static_cast<float>(p_dt));
+
+            /// Ask the fields where to go, only for the agents the level of detail picked for this update. Closest tier first
+            int updatedActors = 0;
+            AILevelOfDetailHandler* t_levelOfDetail = AILevelOfDetailHandler::GetInstance();
+            const size_t numberOfTiers = static_cast<size_t>(AILevelOfDetailTier::NumberOfTiers);
+            for(size_t tier = 0; tier < numberOfTiers && updatedActors < m_maxActorsUpdated; tier++)
+            {
+                ID_TIMER(m_tierTimerIDs[tier]);
+                const std::vector<uint32_t>& t_agents = t_levelOfDetail->GetScheduledAgents(static_cast<AILevelOfDetailTier>(tier));
+                const size_t numberOfAgents = t_agents.size();
+                for(size_t j = 0; j < numberOfAgents && updatedActors < m_maxActorsUpdated; j++)
                 {
-                    // Get the needed components
-                    XMFLOAT3 desiredPos;
-                    TransformComponent* transComp = EntityHandler::GetInstance().GetComponentFromStorage<TransformComponent>(i);
-                    XMFLOAT3 unitPos = transComp->position;
-                    // DoremiEngine::AI::PotentialGroup* group = EntityHandler::GetInstance().GetComponentFromStorage<AIGroupComponent>(i)->Group;
-                    DoremiEngine::AI::PotentialFieldActor* currentActor =
-                        EntityHandler::GetInstance().GetComponentFromStorage<PotentialFieldComponent>(i)->ChargedActor;
-                    DoremiEngine::AI::PotentialField* field = EntityHandler::GetInstance().GetComponentFromStorage<PotentialFieldComponent>(i)->Field;
+                    uint32_t i = t_agents[j];
+                    if(!t_entityHandler.HasComponents(i, (int)ComponentType::AIAgent | (int)ComponentType::Transform | (int)ComponentType::Movement |
+                                                             (int)ComponentType::PotentialField))
+                    {
+                        continue;
+                    }
+                    XMFLOAT3 unitPos = t_snapshot->GetPosition(i);
+                    PotentialFieldComponent* pfComp = t_entityHandler.GetComponentFromStorage<PotentialFieldComponent>(i);
+                    DoremiEngine::AI::PotentialFieldActor* currentActor = pfComp->ChargedActor;
+                    DoremiEngine::AI::PotentialField* field = pfComp->Field;
+                    if(field == nullptr)
+                    {
+                        continue;
+                    }
                     // TODOEA BORDE SPARA UNDAN O INTE KOLLA X O Y EFTER VARANN
-                    bool shouldJump = false;
-                    if(field != nullptr && updatedActors < m_maxActorsUpdated)
+                    if(currentActor->GetPrevGridPos().x == field->WhatGridPosAmIOn(currentActor->GetPosition()).x &&
+                       currentActor->GetPrevGridPos().y == field->WhatGridPosAmIOn(currentActor->GetPosition()).y)
                     {
-                        lastUpdatedActor = i;
-                        if(currentActor->GetPrevGridPos().x == field->WhatGridPosAmIOn(currentActor->GetPosition()).x &&
-                           currentActor->GetPrevGridPos().y == field->WhatGridPosAmIOn(currentActor->GetPosition()).y)
-                        {
-                            // Remove the first in the list om vi skulle anvnda oss av delta_T fr att uppdatera trailen med hjlp av den om ngon
-                            // str still.
-                            // if we are still standing on the same quad as the last update we do nothing
-                            // TODOKO if we have been standing stil for 2 long something might be wrong, Force him to move!!!
-                        }
-                        else
+                        // Remove the first in the list om vi skulle anvnda oss av delta_T fr att uppdatera trailen med hjlp av den om ngon
+                        // str still.
+                        // if we are still standing on the same quad as the last update we do nothing
+                        // TODOKO if we have been standing stil for 2 long something might be wrong, Force him to move!!!
+                    }
+                    else
+                    {
+                        XMINT2 newPrevPos = field->WhatGridPosAmIOn(currentActor->GetPosition());
+                        if(newPrevPos.x > -1 && newPrevPos.y > -1)
                         {
-                            XMINT2 newPrevPos = field->WhatGridPosAmIOn(currentActor->GetPosition());
-                            if(newPrevPos.x > -1 && newPrevPos.y > -1)
-                            {
-                                currentActor->SetPrevGridPosition(newPrevPos);
-                                currentActor->UpdatePhermoneTrail(currentActor->GetPrevGridPos());
-                            }
+                            currentActor->SetPrevGridPosition(newPrevPos);
+                            field->AddPhermone(newPrevPos, *currentActor);
                         }
-                        bool inField;
-                        bool goalInRange;
-                        desiredPos = field->GetAttractionPosition(unitPos, inField, goalInRange, shouldJump, currentActor, false);
+                    }
+                    bool inField;
+                    bool goalInRange;
+                    bool shouldJump = false;
+                    XMFLOAT3 desiredPos = field->GetAttractionPosition(unitPos, inField, goalInRange, shouldJump, currentActor, false);
 
-                        if(goalInRange)
-                        {
-                            updatedActors++;
-                        }
-                        if(!inField)
+                    if(goalInRange)
+                    {
+                        updatedActors++;
+                    }
+                    if(!inField)
+                    {
+                        // We are not in the current field, this means we are in another field. Lets change!
+                        DoremiEngine::AI::PotentialField* newField =
+                            m_sharedContext.GetAIModule().GetPotentialFieldSubModule().FindBestPotentialField(currentActor->GetPosition());
+                        if(newField != nullptr && newField != field)
                         {
-                            // We are not in the current field, this means we are in another field. Lets change!
-                            DoremiEngine::AI::PotentialField* newField =
-                                m_sharedContext.GetAIModule().GetPotentialFieldSubModule().FindBestPotentialField(currentActor->GetPosition());
-                            if(newField != nullptr && newField != field)
-                            {
-                                field->RemoveActor(currentActor);
-                                newField->AddActor(currentActor);
-                                EntityHandler::GetInstance().GetComponentFromStorage<PotentialFieldComponent>(i)->Field = newField;
-                            }
+                            field->RemoveActor(currentActor);
+                            newField->AddActor(currentActor);
+                            pfComp->Field = newField;
                         }
-                        currentActor->SetWantedPosition(desiredPos);
                     }
-                    desiredPos = currentActor->GetWantedPosition();
-
+                    currentActor->SetWantedPosition(desiredPos);
                     if(shouldJump)
                     {
                         PerformJump(i);
                     }
+                }
+            }
+
+            /// Move every agent towards the position it wants to be at, also the ones that weren't updated above
+            for(size_t i = 0; i < length; i++)
+            {
+                if(t_entityHandler.HasComponents(i, (int)ComponentType::AIAgent | (int)ComponentType::Transform | (int)ComponentType::Movement |
+                                                        (int)ComponentType::PotentialField))
+                {
+                    XMFLOAT3 unitPos = t_snapshot->GetPosition(i);
+                    XMFLOAT3 desiredPos = t_entityHandler.GetComponentFromStorage<PotentialFieldComponent>(i)->ChargedActor->GetWantedPosition();
                     XMFLOAT3 desiredPos3D = XMFLOAT3(desiredPos.x, unitPos.y, desiredPos.z); // The fields impact
 
                     XMVECTOR desiredPosVec = XMLoadFloat3(&desiredPos3D);
@@ -153,15 +179,10 @@ namespace Doremi
 
                     XMFLOAT3 direction;
                     XMStoreFloat3(&direction, dirVec);
-                    MovementComponent* moveComp = EntityHandler::GetInstance().GetComponentFromStorage<MovementComponent>(i);
+                    MovementComponent* moveComp = t_entityHandler.GetComponentFromStorage<MovementComponent>(i);
                     moveComp->movement = direction;
-
-                    // currentActor->SetUsePhermonetrail(true); // set it to active so it's active as standard
-                    // currentActor->SetActivePotentialVsType(DoremiEngine::AI::AIActorType::Player,
-                    //                                       false); // We dont know if we see the enemy so dont use this field
                 }
             }
-            m_actorToUpdate = lastUpdatedActor;
         }
 
         void AIPathManager::OnEvent(Event* p_event)
@@ -20,6 +20,11 @@
 
 // Helper
 #include <Helper/ProximityChecker.hpp>
+#include <AIHelper/AILevelOfDetailHandler.hpp>
+#include <AIHelper/AITransformSnapshotHandler.hpp>
+
+// Timing
+#include <Timing/NamedTimer.hpp>
 
 /// Engine
 // Physics
@@ -39,8 +44,14 @@ namespace Doremi
         AITargetManager::AITargetManager(const DoremiEngine::Core::SharedContext& p_sharedContext) : Manager(p_sharedContext, "AITargetManager")
         {
             m_playerMovementImpact = m_sharedContext.GetConfigurationModule().GetAllConfigurationValues().AIAimOffset;
-            m_maxActorsUpdated = 1; // We may only update one AI per update... TODOCONFIG
-            m_actorToUpdate = 0;
+            // All line of sight checks are sent to physics in one batch, so this can be a lot higher than one
+            m_maxActorsUpdated = m_sharedContext.GetConfigurationModule().GetAllConfigurationValues().AIMaxTargetUpdates;
+            const size_t numberOfTiers = static_cast<size_t>(AILevelOfDetailTier::NumberOfTiers);
+            for(size_t i = 0; i < numberOfTiers; i++)
+            {
+                const std::string name = m_name + " " + AILevelOfDetailHandler::GetTierName(static_cast<AILevelOfDetailTier>(i));
+                m_tierTimerIDs.push_back(TimerManager::GetInstance().RegisterTimer(name));
+            }
         }
 
         AITargetManager::~AITargetManager() {}
@@ -50,179 +61,211 @@ namespace Doremi
             using namespace DirectX;
 
             int updatedActors = 0;
-            int lastUpdatedActor = 0;
             // gets all the players in the world, used to see if we can see anyone of them
             std::map<uint32_t, PlayerServer*>& t_players = static_cast<PlayerHandlerServer*>(PlayerHandler::GetInstance())->GetPlayerMap();
             size_t length = EntityHandler::GetInstance().GetLastEntityIndex();
             EntityHandler& t_entityHandler = EntityHandler::GetInstance();
+            AITransformSnapshotHandler* t_snapshot = AITransformSnapshotHandler::GetInstance();
 
             // TODOXX this have very bad coupling and if possible should be done in the damage manager
-            std::map<int, float> damageToPlayer;
+            Utilities::Memory::FrameMap<int, float> damageToPlayer(GetFrameArena());
+
+            m_agentStates.clear();
+            m_lineOfSightChecks.clear();
+            m_rays.clear();
+
+            float checkRange = 1400; // Hardcoded range, not intreseted if player is outside this
 
-            for(size_t i = m_actorToUpdate + 1; i != m_actorToUpdate; i++)
+            /// The attack timers run every update no matter the level of detail
+            for(size_t i = 0; i < length; i++)
             {
-                if(i > length)
+                if(t_entityHandler.HasComponents(i, (int)ComponentType::AIAgent))
                 {
-                    i = 0;
-                    if(i == m_actorToUpdate)
-                    {
-                        break;
-                    }
+                    t_entityHandler.GetComponentFromStorage<AIAgentComponent>(i)->attackTimer += static_cast<float>(p_dt);
                 }
-                // Check and update the attack timer
-                bool shouldFire = false;
-                if(t_entityHandler.HasComponents(i, (int)ComponentType::AIAgent))
+            }
+
+            /// First pass, find out what players each actor might see and build one ray for each. Only for the actors the level of detail
+            /// picked for this update, closest tier first
+            AILevelOfDetailHandler* t_levelOfDetail = AILevelOfDetailHandler::GetInstance();
+            const size_t numberOfTiers = static_cast<size_t>(AILevelOfDetailTier::NumberOfTiers);
+            for(size_t tier = 0; tier < numberOfTiers && updatedActors < m_maxActorsUpdated; tier++)
+            {
+                ID_TIMER(m_tierTimerIDs[tier]);
+                const std::vector<uint32_t>& t_agents = t_levelOfDetail->GetScheduledAgents(static_cast<AILevelOfDetailTier>(tier));
+                const size_t numberOfAgents = t_agents.size();
+                for(size_t j = 0; j < numberOfAgents && updatedActors < m_maxActorsUpdated; j++)
                 {
-                    AIAgentComponent* timer = t_entityHandler.GetComponentFromStorage<AIAgentComponent>(i);
-                    timer->attackTimer += static_cast<float>(p_dt);
-                    // If above attack freq we should attack
-                    if(timer->attackTimer > timer->attackFrequency)
+                    size_t i = t_agents[j];
+                    if(!t_entityHandler.HasComponents(i, (int)ComponentType::Range | (int)ComponentType::AIAgent | (int)ComponentType::Transform))
                     {
-                        shouldFire = true;
+                        continue;
                     }
-                    else
-                    {
-                        // else continue to next for itteration
-                        shouldFire = false;
-                    }
-                }
-                else
-                {
-                    shouldFire = false; // No timer? TODOKO log error and dont let it fire!
-                }
-                if(t_entityHandler.HasComponents(i, (int)ComponentType::Range | (int)ComponentType::AIAgent | (int)ComponentType::Transform) &&
-                   updatedActors < m_maxActorsUpdated)
-                {
+                    // If above attack freq we should attack
+                    AIAgentComponent* timer = t_entityHandler.GetComponentFromStorage<AIAgentComponent>(i);
+                    bool shouldFire = timer->attackTimer > timer->attackFrequency;
 
                     // They have a range component and are AI agents, let's see if a player is in range!
                     // I use proximitychecker here because i'm guessing it's faster than raycast
-                    TransformComponent* AITransform = t_entityHandler.GetComponentFromStorage<TransformComponent>(i);
-                    RangeComponent* aiRange = t_entityHandler.GetComponentFromStorage<RangeComponent>(i);
-                    int closestVisiblePlayer = -1;
+                    const XMFLOAT3& AIPosition = t_snapshot->GetPosition(i);
+                    AgentTargetState agentState;
+                    agentState.entityID = i;
+                    agentState.shouldFire = shouldFire;
+                    agentState.closestVisiblePlayer = -1;
+                    agentState.closestDistance = checkRange;
+                    m_agentStates.push_back(agentState);
 
-                    float checkRange = 1400;
-                    float closestDistance = checkRange; // Hardcoded range, not intreseted if player is outside this
                     int onlyOnePlayerCounts = 1;
-                    // Check waht player is close and visible
+                    // Check waht player is close
                     for(auto pairs : t_players)
                     {
                         int playerID = pairs.second->m_playerEntityID;
                         float distanceToPlayer = ProximityChecker::GetInstance().GetDistanceBetweenEntities(pairs.second->m_playerEntityID, i);
-                        if(distanceToPlayer < closestDistance)
+                        if(distanceToPlayer < checkRange)
                         {
                             // It's after this we start whit heavy computation so this is counted as a updated actor
-                            lastUpdatedActor = i;
                             updatedActors += onlyOnePlayerCounts;
                             onlyOnePlayerCounts = 0;
-
                             // Potential player found, check if we see him
                             // We are in range!! Let's raycast in a appropirate direction!! so start with finding that direction!
                             if(!EntityHandler::GetInstance().HasComponents(playerID, (int)ComponentType::Transform)) // Just for saftey :D
                             {
                                 std::cout << "Player missing transformcomponent?" << std::endl;
-                                return;
+                                continue;
                             }
-                            // Fetch some components
-                            TransformComponent* playerTransform = t_entityHandler.GetComponentFromStorage<TransformComponent>(playerID);
-
                             // Get things in to vectors
-                            XMVECTOR playerPos = XMLoadFloat3(&playerTransform->position);
-                            XMVECTOR AIPos = XMLoadFloat3(&AITransform->position);
+                            XMVECTOR playerPos = XMLoadFloat3(&t_snapshot->GetPosition(playerID));
+                            XMVECTOR AIPos = XMLoadFloat3(&AIPosition);
 
                             // Calculate direction
                             XMVECTOR direction = playerPos - AIPos; // Might be the wrong way
                             direction = XMVector3Normalize(direction);
-                            XMFLOAT3 directionFloat;
-                            XMStoreFloat3(&directionFloat, direction);
 
                             // Offset origin of ray so we dont hit ourself
                             XMVECTOR rayOrigin = AIPos + direction * 5.0f; // TODOCONFIG x.xf is offset from the units body, might need to increase if
                             // the bodies radius is larger than x.x
-                            XMFLOAT3 rayOriginFloat;
-                            XMStoreFloat3(&rayOriginFloat, rayOrigin);
-
-                            // Send it to physx for raycast calculation
-                            int bodyHit = m_sharedContext.GetPhysicsModule().GetRayCastManager().CastRay(rayOriginFloat, directionFloat, checkRange);
-                            if(bodyHit == -1)
-                            {
-                                continue;
-                            }
-                            // we check if it was a bullet we did hit, in this case we probably did hit our own bullet and should take this as a
-                            // player hit
-                            // This is a bit of a wild guess and we should probably do a new raycast from the hit location but screw that!
-                            bool wasBullet = false;
-                            if(EntityHandler::GetInstance().HasComponents(bodyHit, (int)ComponentType::EntityType))
-                            {
-                                EntityTypeComponent* typeComp = EntityHandler::GetInstance().GetComponentFromStorage<EntityTypeComponent>(bodyHit);
-                                if(((int)typeComp->type & (int)EntityType::EnemyBullet) == (int)EntityType::EnemyBullet) // if first entity is bullet
-                                {
-                                    wasBullet = true;
-                                }
-                            }
-                            bool wasNonRenderObject = false;
-                            // object which was hit doesn't have render component - don't collide with it
-                            if(!EntityHandler::GetInstance().HasComponents(bodyHit, (int)ComponentType::Render))
-                            {
-                                wasNonRenderObject = true;
-                            }
 
-                            if(bodyHit == playerID || wasBullet || wasNonRenderObject)
-                            {
-                                closestDistance = distanceToPlayer;
-                                closestVisiblePlayer = pairs.second->m_playerEntityID;
+                            // Save the ray, it's sent to physx together with all the others
+                            DoremiEngine::Physics::RayCastQuery ray;
+                            XMStoreFloat3(&ray.origin, rayOrigin);
+                            XMStoreFloat3(&ray.direction, direction);
+                            ray.range = checkRange;
+                            m_rays.push_back(ray);
 
-                                // Rotate the enemy to face the player
-                                XMMATRIX mat = XMMatrixInverse(nullptr, XMMatrixLookAtLH(AIPos, AIPos + direction, XMLoadFloat3(&XMFLOAT3(0, 1, 0))));
-                                XMVECTOR rotation = XMQuaternionRotationMatrix(mat);
-                                XMFLOAT4 quater;
-                                XMStoreFloat4(&quater, rotation);
-                                AITransform->rotation = quater;
-                            }
+                            LineOfSightCheck check;
+                            check.agentStateIndex = m_agentStates.size() - 1;
+                            check.playerID = playerID;
+                            check.distance = distanceToPlayer;
+                            check.direction = ray.direction;
+                            m_lineOfSightChecks.push_back(check);
                         }
                     }
-                    if(closestVisiblePlayer != -1)
+                }
+            }
+
+            /// Send all the rays to physx at once
+            {
+                NAMED_TIMER("Raycasts");
+                m_sharedContext.GetPhysicsModule().GetRayCastManager().CastRays(m_rays, m_rayHits);
+            }
+
+            /// Second pass, find the closest visible player for each actor
+            size_t numberOfChecks = m_lineOfSightChecks.size();
+            for(size_t i = 0; i < numberOfChecks; i++)
+            {
+                const LineOfSightCheck& check = m_lineOfSightChecks[i];
+                int bodyHit = m_rayHits[i];
+                if(bodyHit == -1)
+                {
+                    continue;
+                }
+                AgentTargetState& agentState = m_agentStates[check.agentStateIndex];
+                if(check.distance >= agentState.closestDistance)
+                {
+                    continue;
+                }
+                // we check if it was a bullet we did hit, in this case we probably did hit our own bullet and should take this as a
+                // player hit
+                // This is a bit of a wild guess and we should probably do a new raycast from the hit location but screw that!
+                bool wasBullet = false;
+                if(EntityHandler::GetInstance().HasComponents(bodyHit, (int)ComponentType::EntityType))
+                {
+                    EntityTypeComponent* typeComp = EntityHandler::GetInstance().GetComponentFromStorage<EntityTypeComponent>(bodyHit);
+                    if(((int)typeComp->type & (int)EntityType::EnemyBullet) == (int)EntityType::EnemyBullet) // if first entity is bullet
                     {
-                        // We now know what player is closest and visible
-                        if(shouldFire)
+                        wasBullet = true;
+                    }
+                }
+                bool wasNonRenderObject = false;
+                // object which was hit doesn't have render component - don't collide with it
+                if(!EntityHandler::GetInstance().HasComponents(bodyHit, (int)ComponentType::Render))
+                {
+                    wasNonRenderObject = true;
+                }
+
+                if(bodyHit == check.playerID || wasBullet || wasNonRenderObject)
+                {
+                    agentState.closestDistance = check.distance;
+                    agentState.closestVisiblePlayer = check.playerID;
+
+                    // Rotate the enemy to face the player
+                    TransformComponent* AITransform = t_entityHandler.GetComponentFromStorage<TransformComponent>(agentState.entityID);
+                    XMVECTOR AIPos = XMLoadFloat3(&t_snapshot->GetPosition(agentState.entityID));
+                    XMVECTOR direction = XMLoadFloat3(&check.direction);
+                    XMMATRIX mat = XMMatrixInverse(nullptr, XMMatrixLookAtLH(AIPos, AIPos + direction, XMLoadFloat3(&XMFLOAT3(0, 1, 0))));
+                    XMVECTOR rotation = XMQuaternionRotationMatrix(mat);
+                    XMFLOAT4 quater;
+                    XMStoreFloat4(&quater, rotation);
+                    AITransform->rotation = quater;
+                }
+            }
+
+            /// Last pass, act on what each actor saw
+            for(auto& agentState : m_agentStates)
+            {
+                size_t i = agentState.entityID;
+                if(agentState.closestVisiblePlayer != -1)
+                {
+                    // We now know what player is closest and visible
+                    if(agentState.shouldFire)
+                    {
+                        RangeComponent* aiRange = t_entityHandler.GetComponentFromStorage<RangeComponent>(i);
+                        if(agentState.closestDistance <= aiRange->range)
                         {
-                            if(closestDistance <= aiRange->range)
+                            AIAgentComponent* agent = t_entityHandler.GetComponentFromStorage<AIAgentComponent>(i);
+                            agent->attackTimer = 0;
+                            if(agent->type == AIType::Melee)
                             {
-                                AIAgentComponent* agent = t_entityHandler.GetComponentFromStorage<AIAgentComponent>(i);
-                                agent->attackTimer = 0;
-                                if(agent->type == AIType::Melee)
+                                // melee attack logic, just deal the damage :P
+                                if(damageToPlayer.count(agentState.closestVisiblePlayer) == 0)
                                 {
-                                    // melee attack logic, just deal the damage :P
-                                    if(damageToPlayer.count(closestVisiblePlayer) == 0)
-                                    {
-                                        damageToPlayer[closestVisiblePlayer] = 0;
-                                    }
-                                    damageToPlayer[closestVisiblePlayer] += 10; // TODOCONFIG Melee enemy damage
+                                    damageToPlayer[agentState.closestVisiblePlayer] = 0;
                                 }
-                                else if(agent->type == AIType::SmallRanged)
-                                {
-                                    FireAtEntity(closestVisiblePlayer, i, closestDistance);
-                                }
-                                AnimationTransitionEvent* t_animationTransition = new AnimationTransitionEvent(i, Animation::ATTACK);
-                                EventHandler::GetInstance()->BroadcastEvent(t_animationTransition);
+                                damageToPlayer[agentState.closestVisiblePlayer] += 10; // TODOCONFIG Melee enemy damage
                             }
-                        }
-                        // If we see a player turn off the phermonetrail
-                        if(t_entityHandler.HasComponents(i, (int)ComponentType::PotentialField))
-                        {
-                            PotentialFieldComponent* pfComp = t_entityHandler.GetComponentFromStorage<PotentialFieldComponent>(i);
-                            pfComp->ChargedActor->SetUsePhermonetrail(false);
-                            pfComp->ChargedActor->SetActivePotentialVsType(DoremiEngine::AI::AIActorType::Player, true);
+                            else if(agent->type == AIType::SmallRanged)
+                            {
+                                FireAtEntity(agentState.closestVisiblePlayer, i, agentState.closestDistance);
+                            }
+                            AnimationTransitionEvent* t_animationTransition = new AnimationTransitionEvent(i, Animation::ATTACK);
+                            EventHandler::GetInstance()->BroadcastEvent(t_animationTransition);
                         }
                     }
-                    else if(t_entityHandler.HasComponents(i, (int)ComponentType::PotentialField))
+                    // If we see a player turn off the phermonetrail
+                    if(t_entityHandler.HasComponents(i, (int)ComponentType::PotentialField))
                     {
-                        // if we dont see a player set phemonetrail and shit
                         PotentialFieldComponent* pfComp = t_entityHandler.GetComponentFromStorage<PotentialFieldComponent>(i);
-                        pfComp->ChargedActor->SetUsePhermonetrail(true);
+                        pfComp->ChargedActor->SetUsePhermonetrail(false);
+                        pfComp->ChargedActor->SetActivePotentialVsType(DoremiEngine::AI::AIActorType::Player, true);
                     }
                 }
+                else if(t_entityHandler.HasComponents(i, (int)ComponentType::PotentialField))
+                {
+                    // if we dont see a player set phemonetrail and shit
+                    PotentialFieldComponent* pfComp = t_entityHandler.GetComponentFromStorage<PotentialFieldComponent>(i);
+                    pfComp->ChargedActor->SetUsePhermonetrail(true);
+                }
             }
-            m_actorToUpdate = lastUpdatedActor;
 
             // Send events for all the players that were immediatly damage by enemies
             for(auto pairs : damageToPlayer)
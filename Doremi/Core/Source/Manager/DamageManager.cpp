@@ -32,6 +32,19 @@ namespace Doremi
 {
     namespace Core
     {
+        namespace
+        {
+            bool IsEnemyBullet(const int& p_entityID)
+            {
+                if(!EntityHandler::GetInstance().HasComponents(p_entityID, (int)ComponentType::EntityType))
+                {
+                    return false;
+                }
+                EntityTypeComponent* typeComp = EntityHandler::GetInstance().GetComponentFromStorage<EntityTypeComponent>(p_entityID);
+                return ((int)typeComp->type & (int)EntityType::EnemyBullet) == (int)EntityType::EnemyBullet;
+            }
+        }
+
         DamageManager::DamageManager(const DoremiEngine::Core::SharedContext& p_sharedContext) : Manager(p_sharedContext, "DamageManager")
         {
             EventHandler::GetInstance()->Subscribe(EventType::Trigger, this);
@@ -43,73 +56,51 @@ namespace Doremi
         {
             std::map<uint32_t, PlayerServer*>& t_players = static_cast<PlayerHandlerServer*>(PlayerHandler::GetInstance())->GetPlayerMap();
 
-            // Check if the player was hit by any enemy bullet
-            std::vector<DoremiEngine::Physics::CollisionPair> t_collisionPairs = m_sharedContext.GetPhysicsModule().GetCollisionPairs();
-            size_t length = t_collisionPairs.size();
+            EntityHandler& t_entityHandler = EntityHandler::GetInstance();
+            DoremiEngine::Physics::PhysicsModule& t_physicsModule = m_sharedContext.GetPhysicsModule();
+            Utilities::Memory::FrameMap<int, float> damageMap(GetFrameArena()); // A map to save the total damage a entity have taken
 
-            // Start with getting every pair with a enemy bullet and save it to a list with bullet first, other second
-            std::vector<XMINT2> t_bulletPairs;
-            for(size_t i = 0; i < length; i++)
+            // for each player we check if a bullet did hit us, only the pairs of the players own body are looked at
+            for(auto pairs : t_players)
             {
-                if(EntityHandler::GetInstance().HasComponents(t_collisionPairs[i].firstID, (int)ComponentType::EntityType))
+                const int t_playerID = static_cast<int>(pairs.second->m_playerEntityID);
+                const DoremiEngine::Physics::CollisionPairSpan t_playerPairs = t_physicsModule.GetCollisionPairsForBody(t_playerID);
+                for(auto& pair : t_playerPairs)
                 {
-                    EntityTypeComponent* typeComp = EntityHandler::GetInstance().GetComponentFromStorage<EntityTypeComponent>(t_collisionPairs[i].firstID);
-                    if(((int)typeComp->type & (int)EntityType::EnemyBullet) == (int)EntityType::EnemyBullet) // if first entity is bullet
+                    // The second id is what the player collided with
+                    if(!IsEnemyBullet(pair.secondID))
                     {
-                        t_bulletPairs.push_back(XMINT2(t_collisionPairs[i].firstID, t_collisionPairs[i].secondID));
+                        continue;
                     }
-                }
-                // If bullets collide a bullet could be in both and should be removed
-                if(EntityHandler::GetInstance().HasComponents(t_collisionPairs[i].secondID, (int)ComponentType::EntityType))
-                {
-                    EntityTypeComponent* typeComp = EntityHandler::GetInstance().GetComponentFromStorage<EntityTypeComponent>(t_collisionPairs[i].secondID);
-                    if(((int)typeComp->type & (int)EntityType::EnemyBullet) == (int)EntityType::EnemyBullet) // if second entity is bullet
+                    // do we have a health comp?
+                    std::cout << "Hit vs player detected" << std::endl;
+                    if(t_entityHandler.HasComponents(t_playerID, (int)ComponentType::Health))
                     {
-                        t_bulletPairs.push_back(XMINT2(t_collisionPairs[i].secondID, t_collisionPairs[i].firstID));
-                    }
-                }
-            }
-
-            std::map<int, float> damageMap; // A map to save the total damage a entity have taken
-
-            // for each player we check if a bullet did hit us
-            length = t_bulletPairs.size();
-            for(auto pairs : t_players)
-            {
-                for(size_t i = 0; i < length; i++)
-                {
-                    if(pairs.second->m_playerEntityID == t_bulletPairs[i].y)
-                    {
-                        // do we have a health comp?
-                        std::cout << "Hit vs player detected" << std::endl;
-                        if(EntityHandler::GetInstance().HasComponents(pairs.second->m_playerEntityID, (int)ComponentType::Health))
+                        if(damageMap.count(t_playerID) == 0)
                         {
-                            if(damageMap.count(pairs.second->m_playerEntityID) == 0)
-                            {
-                                damageMap[pairs.second->m_playerEntityID] = 0;
-                            }
-                            damageMap[pairs.second->m_playerEntityID] += 10; // TODOCONFIG Enemy damage
+                            damageMap[t_playerID] = 0;
                         }
+                        damageMap[t_playerID] += 10; // TODOCONFIG Enemy damage
                     }
                 }
             }
 
             // We need this set to ensure that a bullet that hits multiple targets isnt removed twice
-            std::set<int> removedBullets;
-            for(size_t i = 0; i < length; i++)
+            Utilities::Memory::FrameSet<int> removedBullets(GetFrameArena());
+            const DoremiEngine::Physics::CollisionPairSpan t_collisionPairs = t_physicsModule.GetCollisionPairs();
+            for(auto& pair : t_collisionPairs)
             {
-                // Remove all bullets that hit something, TODOKO review if this is what we want
-                if(removedBullets.count(t_bulletPairs[i].x) == 0)
-                {
-                    EntityHandler::GetInstance().RemoveEntity(t_bulletPairs[i].x);
-                    removedBullets.insert(t_bulletPairs[i].x);
-                }
-                else
+                // Remove all bullets that hit something, TODOKO review if this is what we want. If bullets collide both are removed
+                const int t_ids[2] = {pair.firstID, pair.secondID};
+                for(int id : t_ids)
                 {
-                    // The bullet did hit multiple targets but have already been removed, do nothing.
+                    if(removedBullets.count(id) == 0 && IsEnemyBullet(id))
+                    {
+                        t_entityHandler.RemoveEntity(id);
+                        removedBullets.insert(id);
+                    }
                 }
             }
-            t_bulletPairs.clear();
             removedBullets.clear();
 
             // Check if the player hit any enemies
@@ -127,7 +118,8 @@ namespace Doremi
                 if(EntityHandler::GetInstance().HasComponents(pairs.second->m_playerEntityID, (int)ComponentType::PressureParticleSystem))
                 {
                     // checking if the particles in the particle system hit any drains.
-                    std::vector<int> t_drainsHit = m_sharedContext.GetPhysicsModule().GetFluidManager().GetDrainsHit(pairs.second->m_playerEntityID);
+                    const std::vector<int>& t_drainsHit =
+                        m_sharedContext.GetPhysicsModule().GetFluidManager().GetDrainsHit(pairs.second->m_playerEntityID);
                     size_t particleVecLength = t_drainsHit.size();
                     for(size_t o = 0; o < particleVecLength; o++)
                     {
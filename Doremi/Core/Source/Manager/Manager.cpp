@@ -1,4 +1,5 @@
 #include <Manager/Manager.hpp>
+#include <Timing/TimerManager.hpp>
 
 // Logger
 #include <DoremiEngine/Logging/Include/LoggingModule.hpp>
@@ -11,13 +12,30 @@ namespace Doremi
 {
     namespace Core
     {
+        namespace
+        {
+            // Memory of one update, what the managers allocate beyond this goes to the heap
+            const size_t FRAME_ARENA_SIZE = 1024 * 1024;
+        }
+
         Manager::Manager(const DoremiEngine::Core::SharedContext& p_sharedContext, const std::string& p_name)
-            : m_sharedContext(p_sharedContext), m_name(std::move(p_name))
+            : m_sharedContext(p_sharedContext), m_name(std::move(p_name)), m_timerID(TimerManager::GetInstance().RegisterTimer(m_name))
         {
             using namespace DoremiEngine::Logging;
             using namespace Utilities::Logging;
             Logger& logger = p_sharedContext.GetLoggingModule().GetSubModuleManager().GetLogger();
             logger.LogText(LogTag::GAME, LogLevel::INFO, "Creating manager: %s", m_name.c_str());
         }
+
+        Utilities::Memory::FrameArena& Manager::GetFrameArena()
+        {
+            static Utilities::Memory::FrameArena* frameArena = nullptr;
+            if(frameArena == nullptr)
+            {
+                frameArena = new Utilities::Memory::FrameArena();
+                frameArena->Initialize(FRAME_ARENA_SIZE);
+            }
+            return *frameArena;
+        }
     }
 }
\ No newline at end of file
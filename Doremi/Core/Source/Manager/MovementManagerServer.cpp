@@ -33,6 +33,9 @@ namespace Doremi
 
             const size_t length = EntityHandler::GetInstance().GetLastEntityIndex();
             int mask = (int)ComponentType::Movement | (int)ComponentType::CharacterController;
+
+            // Gather the moves of every controller
+            m_moves.clear();
             for(size_t i = 0; i < length; i++)
             {
                 if(EntityHandler::GetInstance().HasComponents(i, mask))
@@ -51,53 +54,50 @@ namespace Doremi
                     movementComp->movement.x = movementXZ.x;
                     movementComp->movement.z = movementXZ.y;
 
-                    /// 3 Move controller
-                    // Perform move
-                    bool hitGround = m_sharedContext.GetPhysicsModule().GetCharacterControlManager().MoveController(i, movementComp->movement, p_dt);
-                    if(hitGround)
-                    {
-                        EntityHandler::GetInstance().GetComponentFromStorage<GravityComponent>(i)->travelSpeed = 0;
-                        if(EntityHandler::GetInstance().HasComponents(i, (int)ComponentType::Jump)) // temporary fix
-                        {
-                            EntityHandler::GetInstance().GetComponentFromStorage<JumpComponent>(i)->active = false;
-                        }
-                    }
+                    DoremiEngine::Physics::ControllerMove move;
+                    move.id = static_cast<int>(i);
+                    move.displacement = movementComp->movement;
+                    m_moves.push_back(move);
+                }
+            }
 
-                    /// 4 Fix speed for next iteration
-                    // If we're sliding around, only reduce speed, don't entierly reset it
-                    if(iceEffect)
-                    {
-                        float iceSlowdownFactor = 0.99f * (1 - p_dt);
-                        movementComp->movement.x *= iceSlowdownFactor;
-                        movementComp->movement.z *= iceSlowdownFactor;
-                    }
+            /// 3 Move controllers
+            // Perform all moves at once
+            m_sharedContext.GetPhysicsModule().GetCharacterControlManager().MoveControllers(m_moves, static_cast<float>(p_dt), m_collisionFlags);
+
+            const size_t moveCount = m_moves.size();
+            for(size_t j = 0; j < moveCount; j++)
+            {
+                const int i = m_moves[j].id;
+                MovementComponent* movementComp = EntityHandler::GetInstance().GetComponentFromStorage<MovementComponent>(i);
 
-                    // If we're not running on fire (or ice) we can stop
-                    else if(!fireEffect)
+                bool hitGround = ((uint8_t)m_collisionFlags[j] & (uint8_t)DoremiEngine::Physics::ControllerCollisionFlags::down) != 0;
+                if(hitGround)
+                {
+                    EntityHandler::GetInstance().GetComponentFromStorage<GravityComponent>(i)->travelSpeed = 0;
+                    if(EntityHandler::GetInstance().HasComponents(i, (int)ComponentType::Jump)) // temporary fix
                     {
-                        movementComp->movement = XMFLOAT3(0, 0, 0);
+                        EntityHandler::GetInstance().GetComponentFromStorage<JumpComponent>(i)->active = false;
                     }
+                }
 
-                    // Always reset y movement. Again, we don't mess with y
-                    movementComp->movement.y = 0;
-
-
-                    // RigidBodyComponent* rigidBody = EntityHandler::GetInstance().GetComponentFromStorage<RigidBodyComponent>(i);
-                    // XMFLOAT3 currentVelocity = m_sharedContext.GetPhysicsModule().GetRigidBodyManager().GetBodyVelocity(rigidBody->p_bodyID);
-                    // XMVECTOR forward = XMLoadFloat3(&movement->direction);
-                    // XMVECTOR up = XMLoadFloat3(&XMFLOAT3(0, 1, 0));
-                    // XMVECTOR right = XMVector3Cross(up, forward);
-                    // right *= movement->rightAcceleration;
-                    // forward *= movement->forwardAcceleration;
-                    // XMVECTOR moveForce = right + forward;
-                    // XMVECTOR currentVel = XMLoadFloat3(&currentVelocity);
-                    //// moveForce -= (XMVector3Length(currentVel)/movement->maxSpeed) * moveForce ;
-                    // XMFLOAT3 force;
-                    // XMStoreFloat3(&force, moveForce);
-
+                /// 4 Fix speed for next iteration
+                // If we're sliding around, only reduce speed, don't entierly reset it
+                if(iceEffect)
+                {
+                    float iceSlowdownFactor = 0.99f * (1 - p_dt);
+                    movementComp->movement.x *= iceSlowdownFactor;
+                    movementComp->movement.z *= iceSlowdownFactor;
+                }
 
-                    // m_sharedContext.GetPhysicsModule().GetRigidBodyManager().AddForceToBody(rigidBody->p_bodyID, force);
+                // If we're not running on fire (or ice) we can stop
+                else if(!fireEffect)
+                {
+                    movementComp->movement = XMFLOAT3(0, 0, 0);
                 }
+
+                // Always reset y movement. Again, we don't mess with y
+                movementComp->movement.y = 0;
             }
         }
 
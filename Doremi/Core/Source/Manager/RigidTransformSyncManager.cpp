@@ -8,9 +8,12 @@
 
 // Handlers
 #include <EntityComponent/EntityHandler.hpp>
+#include <EntityComponent/StorageShelf.hpp>
 // Components
 #include <EntityComponent/Components/RigidBodyComponent.hpp>
 #include <EntityComponent/Components/TransformComponent.hpp>
+// Timing
+#include <Timing/NamedTimer.hpp>
 
 // 3rd party
 #include <DirectXMath.h>
@@ -29,34 +32,23 @@ namespace Doremi
 
         void RigidTransformSyncManager::Update(double p_dt)
         {
-            // Update simulation
-            m_sharedContext.GetPhysicsModule().Update(p_dt);
-            int mask = (int)ComponentType::RigidBody | (int)ComponentType::Transform;
-
-            // Prefetch the rigid body manager
-            DoremiEngine::Physics::RigidBodyManager& rigidManager = m_sharedContext.GetPhysicsModule().GetRigidBodyManager();
-
-            // Prefetch the entityhandler
-            EntityHandler& entityHandler = EntityHandler::GetInstance();
-
-
-            const size_t length = entityHandler.GetLastEntityIndex();
-            for(size_t i = 0; i < length; ++i)
+            // Update simulation, or wait for the step if it was started earlier in the update
+            DoremiEngine::Physics::PhysicsModule& physicsModule = m_sharedContext.GetPhysicsModule();
+            if(physicsModule.IsSimulating())
             {
-                if(entityHandler.HasComponents(i, mask))
-                {
-                    // Get relevant components
-                    TransformComponent* const transComp = entityHandler.GetComponentFromStorage<TransformComponent>(i);
-
-                    // Get position and orientation of rigid body
-                    const XMFLOAT3 position = rigidManager.GetBodyPosition(i);
-                    const XMFLOAT4 orientation = rigidManager.GetBodyOrientation(i);
-
-                    // Write position and orientation to transform component
-                    transComp->position = position;
-                    transComp->rotation = orientation;
-                }
+                NAMED_TIMER("EndSimulate");
+                physicsModule.EndSimulate();
+            }
+            else
+            {
+                NAMED_TIMER("PhysicsStep");
+                physicsModule.Update(p_dt);
             }
+
+            // Physics writes the bodies that moved straight into the transform components, body ids are entity ids
+            TransformComponent* transforms = StorageShelf<TransformComponent>::GetInstance()->GetPointerToArray();
+            physicsModule.GetRigidBodyManager().WriteMovedBodyTransforms(&transforms[0].position, &transforms[0].rotation, sizeof(TransformComponent),
+                                                                         MAX_NUM_ENTITIES);
         }
 
         void RigidTransformSyncManager::OnEvent(Event* p_event) {}
@@ -30,37 +30,21 @@ namespace Doremi
             // TODOXX If a trigger has the same wall as another trigger it acts weird. It will(tried it once) trigger one triggertype on the way out
             // and one on the
             // way in
-            // Loop through all entities
-            const size_t length = EntityHandler::GetInstance().GetLastEntityIndex();
-            for(size_t i = 0; i < length; i++)
-            {
-                // Check that the current entity has the relevant components
-                if(EntityHandler::GetInstance().HasComponents(i, (int)ComponentType::Trigger | (int)ComponentType::Transform | (int)ComponentType::RigidBody))
-                {
 
-                    // Get the collisionpairs from physicmodule
-                    std::vector<DoremiEngine::Physics::CollisionPair> collisionTriggerPairs = m_sharedContext.GetPhysicsModule().GetTriggerPairs();
-                    size_t collisionListLength = collisionTriggerPairs.size();
-                    for(size_t k = 0; k < collisionListLength; ++k)
-                    {
-                        // The first id will always be the trigger.
-                        if(i == collisionTriggerPairs[k].firstID)
-                        {
-                            // setting up an event to broadcast the triggertype from the component trigger.
-                            TriggerComponent* triggComp = EntityHandler::GetInstance().GetComponentFromStorage<TriggerComponent>(i);
-                            TriggerEvent* myEvent =
-                                new TriggerEvent(triggComp->triggerType, collisionTriggerPairs[k].secondID, collisionTriggerPairs[k].firstID);
-                            EventHandler::GetInstance()->BroadcastEvent(myEvent);
-                        }
-                        else
-                        {
-                            // Do nothing
-                        }
-                    }
-                }
-                else
+            // The trigger pairs are sorted by trigger, so going through them once gives the same events in the same order as going
+            // through every entity
+            EntityHandler& t_entityHandler = EntityHandler::GetInstance();
+            const DoremiEngine::Physics::CollisionPairSpan collisionTriggerPairs = m_sharedContext.GetPhysicsModule().GetTriggerPairs();
+            for(auto& pair : collisionTriggerPairs)
+            {
+                // The first id will always be the trigger. Check that it has the relevant components
+                if(pair.firstID >= 0 &&
+                   t_entityHandler.HasComponents(pair.firstID, (int)ComponentType::Trigger | (int)ComponentType::Transform | (int)ComponentType::RigidBody))
                 {
-                    // Do nothing
+                    // setting up an event to broadcast the triggertype from the component trigger.
+                    TriggerComponent* triggComp = t_entityHandler.GetComponentFromStorage<TriggerComponent>(pair.firstID);
+                    TriggerEvent* myEvent = new TriggerEvent(triggComp->triggerType, pair.secondID, pair.firstID);
+                    EventHandler::GetInstance()->BroadcastEvent(myEvent);
                 }
             }
         }
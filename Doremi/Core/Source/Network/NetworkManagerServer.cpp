@@ -20,6 +20,14 @@
 // Connections
 #include <Doremi/Core/Include/Network/NetworkConnectionsServer.hpp>
 
+// Timing
+#include <Doremi/Core/Include/Timing/FunctionTimer.hpp>
+
+// Logging
+#include <DoremiEngine/Logging/Include/LoggingModule.hpp>
+#include <DoremiEngine/Logging/Include/SubmoduleManager.hpp>
+#include <DoremiEngine/Logging/Include/Logger/Logger.hpp>
+
 // Standard
 #include <iostream> // TODOCM remove after test
 #include <vector>
@@ -45,6 +53,13 @@ namespace Doremi
             NetworkMessagesServer::StartupNetworkMessagesServer(p_sharedContext);
             NetworkConnectionsServer::StartupNetworkConnectionsServer(p_sharedContext);
 
+            using namespace Utilities::Logging;
+            m_logger = &p_sharedContext.GetLoggingModule().GetSubModuleManager().GetLogger();
+            m_connectionTelemetrySchema = m_logger->RegisterDataSchema("ServerConnection", {{"playerID", TelemetryFieldType::UINT32},
+                                                                                            {"bytesSent", TelemetryFieldType::UINT32},
+                                                                                            {"payloadBytesSent", TelemetryFieldType::UINT32},
+                                                                                            {"bytesReceived", TelemetryFieldType::UINT32}});
+
             srand(time(NULL));
         }
 
@@ -58,6 +73,9 @@ namespace Doremi
             // Send Messages for connected clients
             SendConnectedMessages();
 
+            // Log the traffic of this update
+            LogConnectionTelemetry();
+
             // Send messges to master
             SendMasterMessages(p_dt);
 
@@ -70,6 +88,7 @@ namespace Doremi
 
         void NetworkManagerServer::ReceiveMessages()
         {
+            FUNCTION_TIMER
             // For some incomming connecting Received messages we send one
             ReceiveConnectingMessages();
 
@@ -179,6 +198,8 @@ namespace Doremi
                     while(t_networkModule.ReceiveReliableData(&t_message, sizeof(t_message), t_connection.second->ConnectedSocketHandle, t_dataSizeReceived) &&
                           ++t_messageCounter < m_maxConnectedMessagesPerFrame)
                     {
+                        t_connection.second->BytesReceived += t_dataSizeReceived;
+
                         // If we received a correct message
                         if(t_dataSizeReceived != sizeof(NetMessageServerClientConnectedFromClient))
                         {
@@ -288,6 +309,7 @@ namespace Doremi
 
         void NetworkManagerServer::SendConnectedMessages()
         {
+            FUNCTION_TIMER
             NetworkMessagesServer::GetInstance()->UpdateSequence();
             NetworkMessagesServer* t_netMessages = NetworkMessagesServer::GetInstance();
 
@@ -328,6 +350,20 @@ namespace Doremi
             }
         }
 
+        void NetworkManagerServer::LogConnectionTelemetry()
+        {
+            auto& t_connections = NetworkConnectionsServer::GetInstance()->GetConnectedClientConnections();
+            for(auto& t_connection : t_connections)
+            {
+                ClientConnectionFromServer* t_clientConnection = t_connection.second;
+                m_logger->LogData(m_connectionTelemetrySchema, static_cast<uint32_t>(t_clientConnection->MyPlayerID), t_clientConnection->BytesSent,
+                                  t_clientConnection->PayloadBytesSent, t_clientConnection->BytesReceived);
+                t_clientConnection->BytesSent = 0;
+                t_clientConnection->PayloadBytesSent = 0;
+                t_clientConnection->BytesReceived = 0;
+            }
+        }
+
         void NetworkManagerServer::SendMasterMessages(double p_dt)
         {
             NetworkConnectionsServer* t_connections = NetworkConnectionsServer::GetInstance();
@@ -25,6 +25,7 @@
 
 #include <Doremi/Core/Include/NetworkEventSender.hpp>
 #include <SequenceMath.hpp>
+#include <Doremi/Core/Include/Timing/FunctionTimer.hpp>
 
 #include <iostream> // TODOCM remove this debug
 
@@ -343,11 +344,15 @@ namespace Doremi
             }
 
             // Send the message
-            t_networkModule.SendReliableData(&t_newMessage, sizeof(t_newMessage), p_connection->ConnectedSocketHandle);
+            if(t_networkModule.SendReliableData(&t_newMessage, sizeof(t_newMessage), p_connection->ConnectedSocketHandle))
+            {
+                p_connection->BytesSent += sizeof(t_newMessage);
+            }
         }
 
         void NetworkMessagesServer::SendLoadWorld(ClientConnectionFromServer* p_connection)
         {
+            FUNCTION_TIMER
             DoremiEngine::Network::NetworkModule& t_networkModule = m_sharedContext.GetNetworkModule();
 
             // Create new load world message
@@ -372,11 +377,16 @@ namespace Doremi
                 ->WriteQueuedEventsFromLateJoin(t_streamer, sizeof(t_newMessage.Data), t_bytesWritten, p_connection->MyPlayerID);
 
             // Send the message
-            t_networkModule.SendReliableData(&t_newMessage, sizeof(t_newMessage), p_connection->ConnectedSocketHandle);
+            if(t_networkModule.SendReliableData(&t_newMessage, sizeof(t_newMessage), p_connection->ConnectedSocketHandle))
+            {
+                p_connection->BytesSent += sizeof(t_newMessage);
+                p_connection->PayloadBytesSent += t_bytesWritten;
+            }
         }
 
         void NetworkMessagesServer::SendInGame(ClientConnectionFromServer* p_connection)
         {
+            FUNCTION_TIMER
             DoremiEngine::Network::NetworkModule& t_networkModule = m_sharedContext.GetNetworkModule();
             PlayerHandlerServer* t_playerHandler = static_cast<PlayerHandlerServer*>(PlayerHandler::GetInstance());
             InputHandlerServer* t_inputHandler = t_playerHandler->GetInputHandlerForPlayer(p_connection->MyPlayerID);
@@ -426,7 +436,11 @@ namespace Doremi
             }
 
             // Send the message
-            t_networkModule.SendReliableData(&t_newMessage, sizeof(t_newMessage), p_connection->ConnectedSocketHandle);
+            if(t_networkModule.SendReliableData(&t_newMessage, sizeof(t_newMessage), p_connection->ConnectedSocketHandle))
+            {
+                p_connection->BytesSent += sizeof(t_newMessage);
+                p_connection->PayloadBytesSent += t_bytesWritten;
+            }
         }
 
 
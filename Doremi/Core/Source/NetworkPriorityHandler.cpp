@@ -5,8 +5,10 @@
 #include <DoremiEngine/Physics/Include/RigidBodyManager.hpp>
 #include <DoremiEngine/Physics/Include/CharacterControlManager.hpp>
 #include <DoremiEngine/Physics/Include/PhysicsModule.hpp>
+#include <Utility/Utilities/Include/Memory/MemoryAllocator.hpp>
 #include <algorithm>
 #include <iostream>
+#include <new>
 
 
 namespace Doremi
@@ -16,11 +18,20 @@ namespace Doremi
         NetworkPriorityHandler::NetworkPriorityHandler(const DoremiEngine::Core::SharedContext& p_sharedContext)
             : m_sharedContext(p_sharedContext), RelevantTimer(5.0f), ShortRelevantTimer(1.0f), CullRange(1000000000.0f)
         {
+            using namespace Utilities::Memory;
+            m_netPriorityPages =
+                MemoryAllocator::AllocatePages(sizeof(NetworkObjectComponent) * MAX_NUM_ENTITIES, MemoryAllocator::GetDefaultPageOptions());
+            m_netPriorityObjects = static_cast<NetworkObjectComponent*>(m_netPriorityPages.memory);
+            for(size_t i = 0; i < MAX_NUM_ENTITIES; ++i)
+            {
+                new(&m_netPriorityObjects[i]) NetworkObjectComponent();
+            }
+
             // Copy all current network objects
             UpdateAllNetworkObject();
         }
 
-        NetworkPriorityHandler::~NetworkPriorityHandler() {}
+        NetworkPriorityHandler::~NetworkPriorityHandler() { Utilities::Memory::MemoryAllocator::FreePages(m_netPriorityPages); }
 
         void NetworkPriorityHandler::Update(EntityID p_playerID, double p_dt)
         {
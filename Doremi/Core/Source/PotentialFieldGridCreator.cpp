@@ -12,10 +12,14 @@
 #include <DoremiEngine/AI/Include/Interface/PotentialField/PotentialFieldActor.hpp>
 #include <DoremiEngine/AI/Include/Interface/SubModule/PotentialFieldSubModule.hpp>
 #include <DoremiEngine/AI/Include/AIModule.hpp>
+#include <Utility/Utilities/Include/Threading/WorkStealingThreadPool.hpp>
 
 // General
 #include <DirectXMath.h>
+#include <condition_variable>
 #include <iostream>
+#include <mutex>
+#include <vector>
 
 namespace Doremi
 {
@@ -34,19 +38,43 @@ namespace Doremi
             using namespace DirectX;
 
             XMFLOAT2 quadSize = op_field->GetQuadSize();
-            size_t gridSizeX = op_field->GetNumberOfQuadsWidth();
-            size_t gridSizeZ = op_field->GetNumberOfQuadsHeight();
+            const size_t gridSizeX = op_field->GetNumberOfQuadsWidth();
+            const size_t gridSizeZ = op_field->GetNumberOfQuadsHeight();
+            const XMFLOAT3 boxHalfExtents = XMFLOAT3(quadSize.x * 0.5f, 2, quadSize.y * 0.5f);
+            DoremiEngine::Physics::RayCastManager& rayCastManager = m_sharedContext.GetPhysicsModule().GetRayCastManager();
+
+            // The overlap tests only read the physics scene so columns of the grid can be tested on several threads at once.
+            // The hits are saved per quad and handed to the field afterwards on this thread since neither the entity handler nor the field are thread safe
+            std::vector<std::vector<int>> hitsPerQuad(gridSizeX * gridSizeZ);
+            Doremi::Utilities::Threading::WorkStealingThreadPool& threadPool = m_sharedContext.GetThreadPool();
+            std::mutex doneMutex;
+            std::condition_variable doneCondition;
+            size_t remaining = gridSizeX;
+            for(size_t x = 0; x < gridSizeX; ++x)
+            {
+                threadPool.Submit([&, x]() {
+                    for(size_t z = 0; z < gridSizeZ; ++z)
+                    {
+                        XMFLOAT3 sweepOrigin = op_field->GetGridQuadPosition(x, z);
+                        hitsPerQuad[x * gridSizeZ + z] = rayCastManager.OverlapBoxMultipleHits(sweepOrigin, boxHalfExtents);
+                    }
+                    std::lock_guard<std::mutex> lock(doneMutex);
+                    if(--remaining == 0)
+                    {
+                        doneCondition.notify_one();
+                    }
+                });
+            }
+            {
+                std::unique_lock<std::mutex> lock(doneMutex);
+                doneCondition.wait(lock, [&remaining]() { return remaining == 0; });
+            }
+
             for(size_t x = 0; x < gridSizeX; ++x)
-            // thread this place TODOKO
             {
                 for(size_t z = 0; z < gridSizeZ; ++z)
                 {
-                    XMFLOAT3 sweepOrigin = op_field->GetGridQuadPosition(x, z);
-                    XMFLOAT3 boxHalfExtents = XMFLOAT3(quadSize.x * 0.5f, 2, quadSize.y * 0.5);
-                    // m_sharedContext.GetPhysicsModule().GetRigidBodyManager().AddBoxBodyStatic(MAX_NUM_ENTITIES + 1, sweepOrigin, XMFLOAT4(0, 0, 0,
-                    // 1), boxHalfExtents, materialID);
-                    std::vector<int> sweepHits = m_sharedContext.GetPhysicsModule().GetRayCastManager().OverlapBoxMultipleHits(sweepOrigin, boxHalfExtents);
-
+                    const std::vector<int>& sweepHits = hitsPerQuad[x * gridSizeZ + z];
                     size_t numberOfHits = sweepHits.size();
                     for(size_t i = 0; i < numberOfHits; ++i)
                     {
@@ -0,0 +1,321 @@
+#include <Doremi/Core/Include/ServerStatsHandler.hpp>
+
+// Engine
+#include <DoremiEngine/Core/Include/SharedContext.hpp>
+#include <DoremiEngine/Configuration/Include/ConfigurationModule.hpp>
+#include <DoremiEngine/Network/Include/NetworkModule.hpp>
+#include <DoremiEngine/Network/Include/Adress.hpp>
+
+// Statistics
+#include <Doremi/Core/Include/Timing/TimerManager.hpp>
+#include <Doremi/Core/Include/Timing/AllocationTracker.hpp>
+#include <Doremi/Core/Include/Network/NetworkConnectionsServer.hpp>
+#include <Doremi/Core/Include/EntityComponent/EntityFactory.hpp>
+#include <Doremi/Core/Include/EntityComponent/EntityHandler.hpp>
+#include <Doremi/Core/Include/EventHandler/EventHandlerServer.hpp>
+#include <Doremi/Core/Include/Manager/Manager.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <stdexcept>
+
+namespace Doremi
+{
+    namespace Core
+    {
+        namespace
+        {
+            std::string EscapeLabel(const std::string& p_value)
+            {
+                std::string escaped;
+                escaped.reserve(p_value.size());
+                for(const char character : p_value)
+                {
+                    if(character == '\\' || character == '"')
+                    {
+                        escaped += '\\';
+                        escaped += character;
+                    }
+                    else if(character == '\n')
+                    {
+                        escaped += "\\n";
+                    }
+                    else
+                    {
+                        escaped += character;
+                    }
+                }
+                return escaped;
+            }
+
+            // One line of the snapshot, p_labels is written as is between the braces
+            void AppendMetric(std::string& o_snapshot, const char* p_name, const std::string& p_labels, const double& p_value)
+            {
+                char value[32];
+                snprintf(value, sizeof(value), "%.9g", p_value);
+                o_snapshot += p_name;
+                if(!p_labels.empty())
+                {
+                    o_snapshot += "{" + p_labels + "}";
+                }
+                o_snapshot += " ";
+                o_snapshot += value;
+                o_snapshot += "\n";
+            }
+
+            void AppendType(std::string& o_snapshot, const char* p_name, const char* p_type, const char* p_help)
+            {
+                o_snapshot += std::string("# HELP ") + p_name + " " + p_help + "\n# TYPE " + p_name + " " + p_type + "\n";
+            }
+
+            const char* GetConnectionStateName(const ClientConnectionStateFromServer& p_state)
+            {
+                switch(p_state)
+                {
+                    case ClientConnectionStateFromServer::VERSION_CHECK:
+                        return "version_check";
+                    case ClientConnectionStateFromServer::CONNECT:
+                        return "connect";
+                    case ClientConnectionStateFromServer::CONNECTED:
+                        return "connected";
+                    case ClientConnectionStateFromServer::LOAD_WORLD:
+                        return "load_world";
+                    case ClientConnectionStateFromServer::IN_GAME:
+                        return "in_game";
+                    default:
+                        return "unknown";
+                }
+            }
+        }
+
+        const uint32_t ServerStatsHandler::UPDATE_WINDOW;
+
+        ServerStatsHandler* ServerStatsHandler::m_singleton = nullptr;
+
+        ServerStatsHandler* ServerStatsHandler::GetInstance()
+        {
+            if(m_singleton == nullptr)
+            {
+                throw std::runtime_error("GetInstance called before StartupServerStatsHandler");
+            }
+            return m_singleton;
+        }
+
+        void ServerStatsHandler::StartupServerStatsHandler(const DoremiEngine::Core::SharedContext& p_sharedContext)
+        {
+            if(m_singleton != nullptr)
+            {
+                throw std::runtime_error("StartupServerStatsHandler called multiple times.");
+            }
+            m_singleton = new ServerStatsHandler(p_sharedContext);
+        }
+
+        ServerStatsHandler::ServerStatsHandler(const DoremiEngine::Core::SharedContext& p_sharedContext)
+            : m_sharedContext(p_sharedContext),
+              m_updateTimes(UPDATE_WINDOW, 0.0),
+              m_updateCount(0),
+              m_listening(false),
+              m_listenSocketHandle(0),
+              m_acceptedAdress(nullptr),
+              m_maxSnapshotsPerUpdate(4)
+        {
+            const int t_port = p_sharedContext.GetConfigurationModule().GetAllConfigurationValues().StatsPort;
+            if(t_port <= 0)
+            {
+                return;
+            }
+
+            // Only localhost, the statistics are for whatever runs next to the server
+            DoremiEngine::Network::NetworkModule& t_networkModule = p_sharedContext.GetNetworkModule();
+            DoremiEngine::Network::Adress* t_adress = t_networkModule.CreateAdress(127, 0, 0, 1, static_cast<uint16_t>(t_port));
+            m_listenSocketHandle = t_networkModule.CreateReliableConnection(t_adress, 4);
+            delete t_adress;
+            m_acceptedAdress = t_networkModule.CreateAdress();
+            m_listening = true;
+            std::cout << "Serving statistics on localhost:" << t_port << std::endl;
+        }
+
+        ServerStatsHandler::~ServerStatsHandler()
+        {
+            if(m_listening)
+            {
+                m_sharedContext.GetNetworkModule().DeleteSocket(m_listenSocketHandle);
+            }
+            delete m_acceptedAdress;
+        }
+
+        void ServerStatsHandler::Update(const double& p_updateTime)
+        {
+            m_updateTimes[m_updateCount % UPDATE_WINDOW] = p_updateTime;
+            ++m_updateCount;
+
+            if(!m_listening)
+            {
+                return;
+            }
+
+            DoremiEngine::Network::NetworkModule& t_networkModule = m_sharedContext.GetNetworkModule();
+            size_t t_socketHandle = 0;
+            uint32_t t_snapshots = 0;
+            while(t_snapshots++ < m_maxSnapshotsPerUpdate && t_networkModule.AcceptConnection(m_listenSocketHandle, t_socketHandle, m_acceptedAdress))
+            {
+                // A few kilobytes, so it fits in the send buffer of a new socket and the socket can be closed right away
+                std::string t_snapshot = BuildSnapshot();
+                t_networkModule.SendReliableData(&t_snapshot[0], static_cast<uint32_t>(t_snapshot.size()), t_socketHandle);
+                t_networkModule.DeleteSocket(t_socketHandle);
+            }
+        }
+
+        double ServerStatsHandler::GetPercentile(std::vector<double>& p_samples, const double& p_fraction)
+        {
+            if(p_samples.empty())
+            {
+                return 0;
+            }
+            const double t_rank = std::ceil(p_fraction * p_samples.size());
+            const size_t t_index = t_rank < 1 ? 0 : std::min(static_cast<size_t>(t_rank) - 1, p_samples.size() - 1);
+            std::nth_element(p_samples.begin(), p_samples.begin() + t_index, p_samples.end());
+            return p_samples[t_index];
+        }
+
+        std::string ServerStatsHandler::BuildSnapshot()
+        {
+            std::string t_snapshot;
+            t_snapshot.reserve(8192);
+
+            // Updates
+            AppendType(t_snapshot, "doremi_updates_total", "counter", "Updates run since startup.");
+            AppendMetric(t_snapshot, "doremi_updates_total", "", static_cast<double>(m_updateCount));
+            const size_t t_windowSize = static_cast<size_t>(std::min<uint64_t>(m_updateCount, UPDATE_WINDOW));
+            m_sortedUpdateTimes.assign(m_updateTimes.begin(), m_updateTimes.begin() + t_windowSize);
+            AppendType(t_snapshot, "doremi_update_seconds", "summary", "Time of the last updates.");
+            for(const double t_fraction : {0.5, 0.9, 0.99, 1.0})
+            {
+                char t_label[32];
+                snprintf(t_label, sizeof(t_label), "quantile=\"%g\"", t_fraction);
+                AppendMetric(t_snapshot, "doremi_update_seconds", t_label, GetPercentile(m_sortedUpdateTimes, t_fraction));
+            }
+            AppendMetric(t_snapshot, "doremi_update_seconds_count", "", static_cast<double>(t_windowSize));
+
+            // Timers, the call tree of every thread since startup
+            WriteTimers(t_snapshot, TimerManager::GetInstance().GetTotal());
+
+            // Connections
+            NetworkConnectionsServer* t_connections = NetworkConnectionsServer::GetInstance();
+            AppendType(t_snapshot, "doremi_connections", "gauge", "Clients connecting and connected.");
+            const size_t t_connectingCount = t_connections->GetConnectingClientConnections().size();
+            const size_t t_connectedCount = t_connections->GetConnectedClientConnections().size();
+            AppendMetric(t_snapshot, "doremi_connections", "state=\"connecting\"", static_cast<double>(t_connectingCount));
+            AppendMetric(t_snapshot, "doremi_connections", "state=\"connected\"", static_cast<double>(t_connectedCount));
+
+            // Each metric has all its lines together
+            const char* const t_trafficMetrics[3][2] = {
+                {"doremi_client_bytes_sent_total", "Bytes sent to each connected client."},
+                {"doremi_client_payload_bytes_sent_total", "Bytes written to the messages sent to each connected client."},
+                {"doremi_client_bytes_received_total", "Bytes received from each connected client."}};
+            for(uint32_t t_metric = 0; t_metric < 3; ++t_metric)
+            {
+                AppendType(t_snapshot, t_trafficMetrics[t_metric][0], "counter", t_trafficMetrics[t_metric][1]);
+                for(const auto& t_connection : t_connections->GetConnectedClientConnections())
+                {
+                    const ClientConnectionFromServer& t_client = *t_connection.second;
+                    const uint32_t t_values[3] = {t_client.BytesSent, t_client.PayloadBytesSent, t_client.BytesReceived};
+                    const std::string t_labels =
+                        "player=\"" + std::to_string(t_client.MyPlayerID) + "\",state=\"" + GetConnectionStateName(t_client.ConnectionState) + "\"";
+                    AppendMetric(t_snapshot, t_trafficMetrics[t_metric][0], t_labels, static_cast<double>(t_values[t_metric]));
+                }
+            }
+
+            // Entities, the blueprint is the value in the Blueprints enum
+            AppendType(t_snapshot, "doremi_entities", "gauge", "Entities alive by the blueprint they were created from.");
+            for(const auto& t_count : EntityFactory::GetInstance()->GetEntityCounts())
+            {
+                AppendMetric(t_snapshot, "doremi_entities", "blueprint=\"" + std::to_string(static_cast<uint32_t>(t_count.first)) + "\"",
+                             static_cast<double>(t_count.second));
+            }
+            AppendType(t_snapshot, "doremi_entity_index", "gauge", "Highest entity index in use.");
+            AppendMetric(t_snapshot, "doremi_entity_index", "", static_cast<double>(EntityHandler::GetInstance().GetLastEntityIndex()));
+
+            // Events
+            EventHandlerServer* t_eventHandler = static_cast<EventHandlerServer*>(EventHandler::GetInstance());
+            AppendType(t_snapshot, "doremi_queued_events", "gauge", "Events waiting to be delivered.");
+            AppendMetric(t_snapshot, "doremi_queued_events", "queue=\"basic\"", static_cast<double>(t_eventHandler->GetBasicEventCount()));
+            AppendMetric(t_snapshot, "doremi_queued_events", "queue=\"remove\"", static_cast<double>(t_eventHandler->GetRemoveEventCount()));
+
+            // Temporaries of the managers
+            const Utilities::Memory::FrameArena& t_frameArena = Manager::GetFrameArena();
+            const Utilities::Memory::FrameArenaStatistics& t_frameArenaStatistics = t_frameArena.GetLastFrameStatistics();
+            AppendType(t_snapshot, "doremi_frame_arena_bytes", "gauge", "Bytes the managers allocated from the frame arena in the last update.");
+            AppendMetric(t_snapshot, "doremi_frame_arena_bytes", "", static_cast<double>(t_frameArenaStatistics.allocatedBytes));
+            AppendType(t_snapshot, "doremi_frame_arena_allocations", "gauge", "Allocations from the frame arena in the last update.");
+            AppendMetric(t_snapshot, "doremi_frame_arena_allocations", "", static_cast<double>(t_frameArenaStatistics.allocations));
+            AppendType(t_snapshot, "doremi_frame_arena_peak_bytes", "gauge", "Most bytes allocated from the frame arena in one update.");
+            AppendMetric(t_snapshot, "doremi_frame_arena_peak_bytes", "", static_cast<double>(t_frameArena.GetPeakFrameBytes()));
+            AppendType(t_snapshot, "doremi_frame_arena_heap_allocations_total", "counter",
+                       "Frame arena allocations which did not fit and went to the heap.");
+            AppendMetric(t_snapshot, "doremi_frame_arena_heap_allocations_total", "",
+                         static_cast<double>(t_frameArena.GetTotalOverflowAllocations()));
+
+            // Allocations by the timer they were made in, only with AllocationTracking
+            if(AllocationTracker::IsTracking())
+            {
+                const std::vector<ScopeAllocations> t_scopes = AllocationTracker::GetScopes();
+                std::vector<std::string> t_labels;
+                t_labels.reserve(t_scopes.size());
+                for(const auto& t_scope : t_scopes)
+                {
+                    const std::string t_name = t_scope.timerID == 0 ? "Outside timers" : TimerManager::GetInstance().GetTimerName(t_scope.timerID);
+                    t_labels.push_back("scope=\"" + EscapeLabel(t_name) + "\"");
+                }
+                AppendType(t_snapshot, "doremi_scope_live_bytes", "gauge", "Bytes allocated inside each timer and not yet freed.");
+                for(size_t i = 0; i < t_scopes.size(); ++i)
+                {
+                    AppendMetric(t_snapshot, "doremi_scope_live_bytes", t_labels[i], static_cast<double>(t_scopes[i].liveBytes));
+                }
+                AppendType(t_snapshot, "doremi_scope_allocations_total", "counter", "Allocations inside each timer.");
+                for(size_t i = 0; i < t_scopes.size(); ++i)
+                {
+                    AppendMetric(t_snapshot, "doremi_scope_allocations_total", t_labels[i], static_cast<double>(t_scopes[i].allocations));
+                }
+            }
+            return t_snapshot;
+        }
+
+        void ServerStatsHandler::WriteTimers(std::string& o_snapshot, const FrameProfile& p_profile)
+        {
+            // Nodes come after their parent, so the path of the parent is always known
+            TimerManager& t_timerManager = TimerManager::GetInstance();
+            std::vector<std::string> t_labels(p_profile.nodes.size());
+            std::vector<std::string> t_paths(p_profile.nodes.size());
+            for(size_t i = 0; i < p_profile.nodes.size(); ++i)
+            {
+                const TimerNode& t_node = p_profile.nodes[i];
+                if(t_node.parent != FrameProfile::NO_PARENT)
+                {
+                    const std::string t_name = EscapeLabel(t_timerManager.GetTimerName(t_node.timerID));
+                    t_paths[i] = t_paths[t_node.parent].empty() ? t_name : t_paths[t_node.parent] + "/" + t_name;
+                    t_labels[i] = "thread=\"" + std::to_string(t_node.thread) + "\",path=\"" + t_paths[i] + "\"";
+                }
+            }
+
+            AppendType(o_snapshot, "doremi_timer_seconds_total", "counter", "Time in each timer by the timers it ran inside.");
+            for(size_t i = 0; i < p_profile.nodes.size(); ++i)
+            {
+                if(!t_labels[i].empty())
+                {
+                    AppendMetric(o_snapshot, "doremi_timer_seconds_total", t_labels[i], p_profile.GetSeconds(p_profile.nodes[i].ticks));
+                }
+            }
+            AppendType(o_snapshot, "doremi_timer_calls_total", "counter", "Calls of each timer by the timers it ran inside.");
+            for(size_t i = 0; i < p_profile.nodes.size(); ++i)
+            {
+                if(!t_labels[i].empty())
+                {
+                    AppendMetric(o_snapshot, "doremi_timer_calls_total", t_labels[i], static_cast<double>(p_profile.nodes[i].calls));
+                }
+            }
+        }
+    }
+}
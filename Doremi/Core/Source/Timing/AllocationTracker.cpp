@@ -0,0 +1,282 @@
+#include <Timing/AllocationTracker.hpp>
+#include <Doremi/Core/Include/Timing/TimerManager.hpp>
+#include <DoremiEngine/Core/Include/SharedContext.hpp>
+#include <DoremiEngine/Configuration/Include/ConfigurationModule.hpp>
+#include <DoremiEngine/Logging/Include/LoggingModule.hpp>
+#include <DoremiEngine/Logging/Include/SubmoduleManager.hpp>
+#include <DoremiEngine/Logging/Include/Logger/Logger.hpp>
+#include <Utility/Utilities/Include/Logging/LogLevel.hpp>
+#include <Utility/Utilities/Include/Logging/LogTag.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <malloc.h>
+
+namespace Doremi
+{
+    namespace Core
+    {
+        namespace
+        {
+            struct ScopeCounters
+            {
+                std::atomic<int64_t> liveBytes;
+                std::atomic<int64_t> liveAllocations;
+                std::atomic<uint64_t> allocations;
+            };
+
+            // Statics without constructors, they are zero before anything runs since operator new is called before main
+            ScopeCounters s_scopes[AllocationTracker::MAX_SCOPES];
+            std::atomic<bool> s_tracking;
+            thread_local uint32_t t_scope = 0;
+
+#ifdef USE_ALLOCATION_TRACKING
+            /**
+            Written in the last bytes of every block, so the pointer handed out is the one from malloc and a module freeing
+            it with its own operator delete frees it correctly
+            */
+            struct AllocationFooter
+            {
+                uint64_t size;
+                // FOOTER_MAGIC with the scope in the low bits if the block is counted, 0 otherwise
+                uint64_t tag;
+            };
+
+            const uint64_t FOOTER_MAGIC = 0xd03e41a110c00000ull;
+            const uint64_t FOOTER_SCOPE_MASK = 0xfffff;
+
+            size_t GetUsableSize(void* p_memory)
+            {
+#ifdef _WIN32
+                return _msize(p_memory);
+#else
+                return malloc_usable_size(p_memory);
+#endif
+            }
+
+            void* AllocateTracked(const size_t& p_size)
+            {
+                void* memory = std::malloc(p_size + sizeof(AllocationFooter));
+                if(memory == nullptr)
+                {
+                    return nullptr;
+                }
+
+                // Always written, the memory may hold the footer of an earlier block
+                AllocationFooter footer = {p_size, 0};
+                if(s_tracking.load(std::memory_order_relaxed))
+                {
+                    const uint32_t scope = t_scope;
+                    footer.tag = FOOTER_MAGIC | scope;
+                    ScopeCounters& counters = s_scopes[scope];
+                    counters.liveBytes.fetch_add(static_cast<int64_t>(p_size), std::memory_order_relaxed);
+                    counters.liveAllocations.fetch_add(1, std::memory_order_relaxed);
+                    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+                }
+                std::memcpy(static_cast<char*>(memory) + GetUsableSize(memory) - sizeof(AllocationFooter), &footer, sizeof(AllocationFooter));
+                return memory;
+            }
+
+            void FreeTracked(void* p_memory)
+            {
+                if(p_memory == nullptr)
+                {
+                    return;
+                }
+
+                // Blocks from a module have no footer, their last bytes won't hold the magic
+                char* footerAdress = static_cast<char*>(p_memory) + GetUsableSize(p_memory) - sizeof(AllocationFooter);
+                AllocationFooter footer;
+                std::memcpy(&footer, footerAdress, sizeof(AllocationFooter));
+                if((footer.tag & ~FOOTER_SCOPE_MASK) == FOOTER_MAGIC)
+                {
+                    ScopeCounters& counters = s_scopes[footer.tag & FOOTER_SCOPE_MASK];
+                    counters.liveBytes.fetch_sub(static_cast<int64_t>(footer.size), std::memory_order_relaxed);
+                    counters.liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+                    footer.tag = 0;
+                    std::memcpy(footerAdress, &footer, sizeof(AllocationFooter));
+                }
+                std::free(p_memory);
+            }
+#endif
+        }
+
+        const uint32_t AllocationTracker::MAX_SCOPES;
+        const uint32_t AllocationTracker::REPORTED_SCOPES;
+
+        AllocationTracker* AllocationTracker::m_singleton = nullptr;
+
+        AllocationTracker* AllocationTracker::GetInstance()
+        {
+            if(m_singleton == nullptr)
+            {
+                throw std::runtime_error("GetInstance called before StartupAllocationTracker");
+            }
+            return m_singleton;
+        }
+
+        void AllocationTracker::StartupAllocationTracker(const DoremiEngine::Core::SharedContext& p_sharedContext)
+        {
+            if(m_singleton != nullptr)
+            {
+                throw std::runtime_error("StartupAllocationTracker called multiple times.");
+            }
+            m_singleton = new AllocationTracker(p_sharedContext);
+        }
+
+        AllocationTracker::AllocationTracker(const DoremiEngine::Core::SharedContext& p_sharedContext)
+            : m_sharedContext(p_sharedContext), m_reportSeconds(0), m_timeSinceReport(0), m_reportedLiveBytes(MAX_SCOPES, 0)
+        {
+            using namespace Utilities::Logging;
+            const DoremiEngine::Configuration::ConfiguartionInfo& t_configuration =
+                p_sharedContext.GetConfigurationModule().GetAllConfigurationValues();
+            if(t_configuration.AllocationTracking == 0)
+            {
+                return;
+            }
+            DoremiEngine::Logging::Logger& t_logger = p_sharedContext.GetLoggingModule().GetSubModuleManager().GetLogger();
+            if(!IsBuiltIn())
+            {
+                t_logger.LogText(LogTag::MEMORY, LogLevel::WARNING, "AllocationTracking is set but the build has no BUILD_ALLOCATION_TRACKING");
+                return;
+            }
+            m_reportSeconds = t_configuration.AllocationReportSeconds;
+            SetTracking(true);
+            t_logger.LogText(LogTag::MEMORY, LogLevel::INFO, "Tracking allocations, report every %f s", m_reportSeconds);
+        }
+
+        AllocationTracker::~AllocationTracker() {}
+
+        uint32_t AllocationTracker::EnterScope(const uint32_t& p_timerID)
+        {
+            const uint32_t outerScope = t_scope;
+            t_scope = p_timerID < MAX_SCOPES ? p_timerID : 0;
+            return outerScope;
+        }
+
+        void AllocationTracker::LeaveScope(const uint32_t& p_outerScope) { t_scope = p_outerScope; }
+
+        bool AllocationTracker::IsBuiltIn()
+        {
+#ifdef USE_ALLOCATION_TRACKING
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        bool AllocationTracker::IsTracking() { return s_tracking.load(std::memory_order_relaxed); }
+
+        void AllocationTracker::SetTracking(const bool& p_tracking) { s_tracking.store(p_tracking && IsBuiltIn(), std::memory_order_relaxed); }
+
+        std::vector<ScopeAllocations> AllocationTracker::GetScopes()
+        {
+            std::vector<ScopeAllocations> scopes;
+            for(uint32_t i = 0; i < MAX_SCOPES; ++i)
+            {
+                const uint64_t allocations = s_scopes[i].allocations.load(std::memory_order_relaxed);
+                if(allocations == 0)
+                {
+                    continue;
+                }
+                ScopeAllocations scope;
+                scope.timerID = i;
+                scope.liveBytes = s_scopes[i].liveBytes.load(std::memory_order_relaxed);
+                scope.liveAllocations = s_scopes[i].liveAllocations.load(std::memory_order_relaxed);
+                scope.allocations = allocations;
+                scopes.push_back(scope);
+            }
+            return scopes;
+        }
+
+        void AllocationTracker::Update(const double& p_deltaTime)
+        {
+            if(!IsTracking() || m_reportSeconds <= 0)
+            {
+                return;
+            }
+            m_timeSinceReport += p_deltaTime;
+            if(m_timeSinceReport >= m_reportSeconds)
+            {
+                LogReport();
+            }
+        }
+
+        void AllocationTracker::LogReport()
+        {
+            using namespace Utilities::Logging;
+            std::vector<ScopeAllocations> t_scopes = GetScopes();
+            std::vector<std::pair<int64_t, ScopeAllocations>> t_growers;
+            for(const auto& scope : t_scopes)
+            {
+                const int64_t growth = scope.liveBytes - m_reportedLiveBytes[scope.timerID];
+                m_reportedLiveBytes[scope.timerID] = scope.liveBytes;
+                if(growth > 0)
+                {
+                    t_growers.push_back(std::make_pair(growth, scope));
+                }
+            }
+            const size_t t_reportedCount = std::min(t_growers.size(), static_cast<size_t>(REPORTED_SCOPES));
+            std::partial_sort(t_growers.begin(), t_growers.begin() + t_reportedCount, t_growers.end(),
+                              [](const std::pair<int64_t, ScopeAllocations>& p_first, const std::pair<int64_t, ScopeAllocations>& p_second) {
+                                  return p_first.first > p_second.first;
+                              });
+
+            DoremiEngine::Logging::Logger& t_logger = m_sharedContext.GetLoggingModule().GetSubModuleManager().GetLogger();
+            t_logger.LogText(LogTag::MEMORY, LogLevel::INFO, "Live allocations grew in %u scopes over the last %f s",
+                             static_cast<uint32_t>(t_growers.size()), m_timeSinceReport);
+            TimerManager& t_timerManager = TimerManager::GetInstance();
+            for(size_t i = 0; i < t_reportedCount; ++i)
+            {
+                const ScopeAllocations& scope = t_growers[i].second;
+                const std::string name = scope.timerID == 0 ? "Outside timers" : t_timerManager.GetTimerName(scope.timerID);
+                t_logger.LogText(LogTag::MEMORY, LogLevel::INFO, "%s: +%lld bytes, %lld bytes live in %lld allocations, %llu allocations in total",
+                                 name.c_str(), static_cast<long long>(t_growers[i].first), static_cast<long long>(scope.liveBytes),
+                                 static_cast<long long>(scope.liveAllocations), static_cast<unsigned long long>(scope.allocations));
+            }
+            m_timeSinceReport = 0;
+        }
+    }
+}
+
+#ifdef USE_ALLOCATION_TRACKING
+void* operator new(size_t p_size)
+{
+    void* memory = Doremi::Core::AllocateTracked(p_size);
+    if(memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void* operator new[](size_t p_size)
+{
+    void* memory = Doremi::Core::AllocateTracked(p_size);
+    if(memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void* operator new(size_t p_size, const std::nothrow_t&) noexcept { return Doremi::Core::AllocateTracked(p_size); }
+
+void* operator new[](size_t p_size, const std::nothrow_t&) noexcept { return Doremi::Core::AllocateTracked(p_size); }
+
+void operator delete(void* p_memory) noexcept { Doremi::Core::FreeTracked(p_memory); }
+
+void operator delete[](void* p_memory) noexcept { Doremi::Core::FreeTracked(p_memory); }
+
+void operator delete(void* p_memory, size_t) noexcept { Doremi::Core::FreeTracked(p_memory); }
+
+void operator delete[](void* p_memory, size_t) noexcept { Doremi::Core::FreeTracked(p_memory); }
+
+void operator delete(void* p_memory, const std::nothrow_t&) noexcept { Doremi::Core::FreeTracked(p_memory); }
+
+void operator delete[](void* p_memory, const std::nothrow_t&) noexcept { Doremi::Core::FreeTracked(p_memory); }
+#endif
@@ -5,17 +5,112 @@
 #include <DoremiEngine/Logging/Include/Logger/Logger.hpp>
 
 #include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
 #include <vector>
+#if defined(_WIN32)
+#include <intrin.h>
+#endif
 
 namespace Doremi
 {
     namespace Core
     {
-        using namespace Doremi::Utilities::Chrono;
+        namespace
+        {
+            // Timestamp of a timer, cheap enough to take around every timer
+            uint64_t ReadTicks()
+            {
+#if defined(_WIN32)
+                return __rdtsc();
+#else
+                using namespace std::chrono;
+                return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+#endif
+            }
+
+            double ReadSeconds()
+            {
+                using namespace std::chrono;
+                return duration_cast<duration<double>>(steady_clock::now().time_since_epoch()).count();
+            }
+
+            // Ticks are calibrated against the steady clock at startup and then continuously while this much time passes
+            const double CALIBRATION_STARTUP_TIME = 0.002;
+            const double CALIBRATION_MIN_TIME = 0.1;
+
+            // Ring of the calling thread and the TimerManager it belongs to
+            struct ThreadTimersOfManager
+            {
+                uint64_t instance;
+                void* timers;
+            };
+            thread_local ThreadTimersOfManager t_threadTimers = {0, nullptr};
+
+            std::atomic<uint64_t> s_nextInstance(1);
+
+            const uint32_t TRACE_START = 0x80000000;
+
+            void WriteJsonString(std::ostream& p_stream, const std::string& p_string)
+            {
+                p_stream << '"';
+                for(const char character : p_string)
+                {
+                    if(character == '"' || character == '\\')
+                    {
+                        p_stream << '\\' << character;
+                    }
+                    else if(static_cast<unsigned char>(character) < 0x20)
+                    {
+                        p_stream << ' ';
+                    }
+                    else
+                    {
+                        p_stream << character;
+                    }
+                }
+                p_stream << '"';
+            }
+        }
+
+        const uint32_t FrameProfile::NO_PARENT;
+        const uint32_t TimerManager::THREAD_RING_SIZE;
+        const uint32_t TimerManager::TRACE_MAX_EVENTS;
+
+        TimerManager::TimerManager()
+            : m_instance(s_nextInstance.fetch_add(1)),
+              m_frameStart(0),
+              m_traceEventCount(0),
+              m_traceSeconds(0),
+              m_traceSpikeThreshold(0),
+              m_lastTraceEnd(0),
+              m_traceCount(0),
+              m_traceRequested(false)
+        {
+            m_sites.push_back({"Thread", "", 0});
 
-        TimerManager::TimerManager() {}
+            m_calibrationTicks = ReadTicks();
+            m_calibrationSeconds = ReadSeconds();
+            double elapsed = 0;
+            uint64_t ticks = m_calibrationTicks;
+            while(elapsed < CALIBRATION_STARTUP_TIME)
+            {
+                ticks = ReadTicks();
+                elapsed = ReadSeconds() - m_calibrationSeconds;
+            }
+            m_ticksPerSecond = static_cast<double>(ticks - m_calibrationTicks) / elapsed;
+            m_frameStart = ReadTicks();
+        }
 
-        TimerManager::~TimerManager() {}
+        TimerManager::~TimerManager()
+        {
+            for(auto& thread : m_threads)
+            {
+                delete thread;
+            }
+        }
 
         TimerManager& TimerManager::GetInstance()
         {
@@ -23,123 +118,441 @@ namespace Doremi
             return timerManager;
         }
 
-        const TimerData* const TimerManager::StartTimer(const std::string& p_file, const std::string& p_function, const uint32_t& p_lineNumber)
+        uint32_t TimerManager::RegisterSite(TimerSite& p_site)
         {
-            // See if timer exists
-            auto& timer = m_timers.find(TimerKey(p_file, p_function, p_lineNumber));
-            if(timer != m_timers.end())
+            std::lock_guard<std::mutex> lock(m_sitesLock);
+            uint32_t id = p_site.id.load(std::memory_order_relaxed);
+            if(id != 0)
             {
-                //// Timer exists
-                timer->second.timer.Tick();
-                return &timer->second;
+                return id;
             }
-            else
+            m_sites.push_back({p_site.name, p_site.file, p_site.line});
+            id = static_cast<uint32_t>(m_sites.size() - 1);
+            p_site.id.store(id, std::memory_order_release);
+            return id;
+        }
+
+        uint32_t TimerManager::RegisterTimer(const std::string& p_name)
+        {
+            std::lock_guard<std::mutex> lock(m_sitesLock);
+            auto found = m_namedTimers.find(p_name);
+            if(found != m_namedTimers.end())
             {
-                //// Timer does not exist
-                // Create new timer
-                auto& tTimer = m_timers.emplace(TimerKey(p_file, p_function, p_lineNumber), TimerData(p_lineNumber)).first->second;
-                tTimer.timer.Tick();
-                return &tTimer;
+                return found->second;
             }
+            m_sites.push_back({p_name, "", 0});
+            const uint32_t id = static_cast<uint32_t>(m_sites.size() - 1);
+            m_namedTimers.emplace(p_name, id);
+            return id;
         }
 
-        void TimerManager::StopTimer(const TimerData* const p_timer)
+        std::string TimerManager::GetTimerName(const uint32_t& p_timerID)
         {
-            TimerData* timer = const_cast<TimerData*>(p_timer);
-            timer->data += timer->timer.Tick().GetElapsedTimeInSeconds();
+            std::lock_guard<std::mutex> lock(m_sitesLock);
+            return p_timerID < m_sites.size() ? m_sites[p_timerID].name : std::string();
         }
 
-        void TimerManager::StartTimer(const std::string& p_name)
+        TimerManager::ThreadTimers& TimerManager::GetThreadTimers()
         {
-            const auto& timer = m_namedTimers.find(p_name);
-            if(timer != m_namedTimers.end())
+            if(t_threadTimers.instance != m_instance)
             {
-                //// Already exists
-                timer->second.timer.Tick();
+                ThreadTimers* timers = new ThreadTimers();
+                timers->head.store(0, std::memory_order_relaxed);
+                timers->tail.store(0, std::memory_order_relaxed);
+                timers->depth = 0;
+                timers->skippedDepth = 0;
+                {
+                    std::lock_guard<std::mutex> lock(m_threadsLock);
+                    timers->index = static_cast<uint32_t>(m_threads.size());
+                    m_threads.push_back(timers);
+                }
+                t_threadTimers.instance = m_instance;
+                t_threadTimers.timers = timers;
             }
-            else
+            return *static_cast<ThreadTimers*>(t_threadTimers.timers);
+        }
+
+        bool TimerManager::Push(ThreadTimers& p_thread, const TimerEvent& p_event, const uint32_t& p_requiredSpace)
+        {
+            const uint64_t head = p_thread.head.load(std::memory_order_relaxed);
+            const uint64_t tail = p_thread.tail.load(std::memory_order_acquire);
+            if(THREAD_RING_SIZE - (head - tail) < p_requiredSpace)
+            {
+                return false;
+            }
+            p_thread.events[head % THREAD_RING_SIZE] = p_event;
+            p_thread.head.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        void TimerManager::StartTimer(const uint32_t& p_timerID)
+        {
+            ThreadTimers& thread = GetThreadTimers();
+            // Room is kept for stopping every running timer, so a recorded start always gets its stop. Timers inside one
+            // which wasn't recorded aren't either, they would end up under the wrong parent
+            if(thread.skippedDepth > 0 || !Push(thread, {ReadTicks(), p_timerID, 1}, thread.depth + 2))
             {
-                //// Does not already exist
-                const auto& tTimer = m_namedTimers.emplace(p_name, TimerData(0));
-                tTimer.first->second.timer.Tick();
+                ++thread.skippedDepth;
+                return;
             }
+            ++thread.depth;
         }
 
-        void TimerManager::StopTimer(const std::string& p_name)
+        void TimerManager::StopTimer(const uint32_t& p_timerID)
         {
-            const auto& timer = m_namedTimers.find(p_name);
-            if(timer != m_namedTimers.end())
+            ThreadTimers& thread = GetThreadTimers();
+            if(thread.skippedDepth > 0)
             {
-                //// Already exists
-                timer->second.data += timer->second.timer.Tick().GetElapsedTimeInSeconds();
+                --thread.skippedDepth;
+                return;
             }
-            else
+            if(thread.depth == 0)
             {
-                const std::string message("Timer with name '" + p_name + "' does not exist.");
-                throw std::exception(message.c_str());
+                return;
             }
+            Push(thread, {ReadTicks(), p_timerID, 0}, 1);
+            --thread.depth;
         }
 
-        bool sortTimerData(const std::pair<TimerKey, TimerData>& lhs, const std::pair<TimerKey, TimerData>& rhs)
+        void TimerManager::EndFrame()
         {
-            if(lhs.first.file < rhs.first.file)
+            std::lock_guard<std::mutex> lock(m_frameLock);
             {
-                return true;
+                std::lock_guard<std::mutex> threadsLock(m_threadsLock);
+                m_frameThreads.assign(m_threads.begin(), m_threads.end());
             }
-            else if(rhs.first.file < lhs.first.file)
+
+            for(auto& thread : m_frameThreads)
             {
-                return false;
+                CollectThread(*thread);
             }
-            else
+
+            // Timers still running get the time until now, the rest goes to the next frame
+            const uint64_t frameEnd = ReadTicks();
+            for(auto& thread : m_frameThreads)
             {
-                if(rhs.first.file < lhs.first.file)
+                for(auto& openTimer : thread->openTimers)
                 {
-                    return true;
+                    if(frameEnd > openTimer.start)
+                    {
+                        m_frame.nodes[openTimer.node].ticks += frameEnd - openTimer.start;
+                        openTimer.start = frameEnd;
+                    }
                 }
-                else if(lhs.first.file < rhs.first.file)
+            }
+
+            const double seconds = ReadSeconds();
+            if(seconds - m_calibrationSeconds > CALIBRATION_MIN_TIME)
+            {
+                m_ticksPerSecond = static_cast<double>(frameEnd - m_calibrationTicks) / (seconds - m_calibrationSeconds);
+            }
+
+            m_frame.frameTicks = frameEnd - m_frameStart;
+            m_frame.frameCount = 1;
+            m_frame.ticksPerSecond = m_ticksPerSecond;
+            for(auto& node : m_frame.nodes)
+            {
+                if(node.parent == FrameProfile::NO_PARENT)
                 {
-                    return false;
+                    node.ticks = m_frame.frameTicks;
+                    node.calls = 1;
                 }
-                else
+            }
+
+            AddToTotal(m_frame);
+            if(m_frame.frameTicks > m_slowestFrame.frameTicks)
+            {
+                m_slowestFrame = m_frame;
+            }
+            m_lastFrame = m_frame;
+
+            // The next frame starts with the timers still running
+            m_frame.nodes.clear();
+            m_frame.firstRoot = FrameProfile::NO_PARENT;
+            for(auto& thread : m_frameThreads)
+            {
+                uint32_t parent = FrameProfile::NO_PARENT;
+                if(!thread->openTimers.empty())
                 {
-                    if(rhs.second.startLine < lhs.second.startLine)
-                    {
-                        return true;
-                    }
-                    else if(lhs.second.startLine < rhs.second.startLine)
+                    parent = GetChild(m_frame, FrameProfile::NO_PARENT, 0, thread->index);
+                }
+                for(auto& openTimer : thread->openTimers)
+                {
+                    openTimer.node = GetChild(m_frame, parent, openTimer.timerID, thread->index);
+                    parent = openTimer.node;
+                }
+            }
+            m_frameStart = frameEnd;
+
+            const bool traceRequested = m_traceRequested.exchange(false, std::memory_order_relaxed);
+            if(!m_traceEvents.empty())
+            {
+                // Frames after a spike are often slow as well, they are left for the next trace
+                const uint64_t traceTicks = static_cast<uint64_t>(m_traceSeconds * m_ticksPerSecond);
+                const bool spike = m_traceSpikeThreshold > 0 && m_lastFrame.GetSeconds(m_lastFrame.frameTicks) > m_traceSpikeThreshold &&
+                                   (m_lastTraceEnd == 0 || frameEnd - m_lastTraceEnd > traceTicks);
+                if(traceRequested || spike)
+                {
+                    const std::string fileName = "trace" + std::to_string(m_traceCount++) + ".json";
+                    if(spike)
                     {
-                        return false;
+                        printf("Frame took %f s, ", m_lastFrame.GetSeconds(m_lastFrame.frameTicks));
                     }
+                    printf(WriteTraceFile(fileName) ? "wrote trace to %s\n" : "failed to write trace to %s\n", fileName.c_str());
                 }
             }
+            else if(traceRequested)
+            {
+                printf("No trace is captured, it is started with TraceCaptureSeconds in the configuration.\n");
+            }
         }
 
-        void TimerManager::DumpData(const DoremiEngine::Core::SharedContext& p_sharedContext)
+        void TimerManager::CollectThread(ThreadTimers& p_thread)
         {
-            printf("Dumping data.\n");
-            std::vector<std::pair<TimerKey, TimerData>> vectorEntries;
-            vectorEntries.reserve(m_timers.size());
-            for(const auto& entry : m_timers)
+            const uint64_t head = p_thread.head.load(std::memory_order_acquire);
+            uint64_t tail = p_thread.tail.load(std::memory_order_relaxed);
+            for(; tail != head; ++tail)
+            {
+                const TimerEvent& event = p_thread.events[tail % THREAD_RING_SIZE];
+                if(event.isStart != 0)
+                {
+                    const uint32_t parent = p_thread.openTimers.empty() ? GetChild(m_frame, FrameProfile::NO_PARENT, 0, p_thread.index)
+                                                                        : p_thread.openTimers.back().node;
+                    const uint32_t node = GetChild(m_frame, parent, event.timerID, p_thread.index);
+                    p_thread.openTimers.push_back({event.timerID, node, event.timestamp});
+                }
+                else if(!p_thread.openTimers.empty())
+                {
+                    const OpenTimer& openTimer = p_thread.openTimers.back();
+                    TimerNode& node = m_frame.nodes[openTimer.node];
+                    // A stop from before the frame was split counts as stopping at the split
+                    node.ticks += event.timestamp > openTimer.start ? event.timestamp - openTimer.start : 0;
+                    ++node.calls;
+                    p_thread.openTimers.pop_back();
+                }
+
+                if(!m_traceEvents.empty())
+                {
+                    const uint32_t start = event.isStart != 0 ? TRACE_START : 0;
+                    m_traceEvents[m_traceEventCount % m_traceEvents.size()] = {event.timestamp, event.timerID, p_thread.index | start};
+                    ++m_traceEventCount;
+                }
+            }
+            p_thread.tail.store(head, std::memory_order_release);
+        }
+
+        uint32_t TimerManager::GetChild(FrameProfile& p_profile, const uint32_t& p_parent, const uint32_t& p_timerID, const uint32_t& p_thread)
+        {
+            uint32_t* link = p_parent == FrameProfile::NO_PARENT ? &p_profile.firstRoot : &p_profile.nodes[p_parent].firstChild;
+            while(*link != FrameProfile::NO_PARENT)
             {
-                vectorEntries.push_back(std::pair<TimerKey, TimerData>(entry.first, entry.second));
+                const TimerNode& node = p_profile.nodes[*link];
+                if(node.timerID == p_timerID && node.thread == p_thread)
+                {
+                    return *link;
+                }
+                link = &p_profile.nodes[*link].nextSibling;
+            }
+
+            // Added last, the link may point into the nodes so it is set before they grow
+            const uint32_t index = static_cast<uint32_t>(p_profile.nodes.size());
+            *link = index;
+            p_profile.nodes.push_back({p_timerID, p_parent, p_thread, FrameProfile::NO_PARENT, FrameProfile::NO_PARENT, 0, 0});
+            return index;
+        }
+
+        void TimerManager::AddToTotal(const FrameProfile& p_frame)
+        {
+            // Nodes come after their parent, so the parent has been found when a node is reached
+            m_totalIndices.resize(p_frame.nodes.size());
+            for(size_t i = 0; i < p_frame.nodes.size(); ++i)
+            {
+                const TimerNode& node = p_frame.nodes[i];
+                const uint32_t parent = node.parent == FrameProfile::NO_PARENT ? FrameProfile::NO_PARENT : m_totalIndices[node.parent];
+                const uint32_t totalIndex = GetChild(m_total, parent, node.timerID, node.thread);
+                m_total.nodes[totalIndex].calls += node.calls;
+                m_total.nodes[totalIndex].ticks += node.ticks;
+                m_totalIndices[i] = totalIndex;
             }
+            m_total.frameTicks += p_frame.frameTicks;
+            m_total.frameCount += p_frame.frameCount;
+            m_total.ticksPerSecond = p_frame.ticksPerSecond;
+        }
 
-            std::sort(vectorEntries.begin(), vectorEntries.end(), sortTimerData);
+        void TimerManager::DumpData(const DoremiEngine::Core::SharedContext& p_sharedContext)
+        {
+            printf("Dumping data.\n");
+            EndFrame();
+            LogProfile("All frames", m_total, p_sharedContext);
+            LogProfile("Slowest frame", m_slowestFrame, p_sharedContext);
+        }
 
+        void TimerManager::LogProfile(const std::string& p_title, const FrameProfile& p_profile,
+                                      const DoremiEngine::Core::SharedContext& p_sharedContext)
+        {
             using namespace Doremi::Utilities::Logging;
             auto& logger = p_sharedContext.GetLoggingModule().GetSubModuleManager().GetLogger();
-            for(const auto& i : vectorEntries)
+
+            std::vector<SiteInfo> sites;
             {
-                logger.LogText(LogTag::TIMER, LogLevel::MASS_DATA_PRINT, "%s:%s:%d, %f", i.first.file.c_str(), i.first.function.c_str(),
-                               i.second.startLine, i.second.data);
-                printf("%s:%s:%d, %f\n", i.first.file.c_str(), i.first.function.c_str(), i.second.startLine, i.second.data);
+                std::lock_guard<std::mutex> lock(m_sitesLock);
+                sites = m_sites;
             }
 
-            for(const auto& i : m_namedTimers)
+            const double frameTime = p_profile.GetSeconds(p_profile.frameTicks);
+            logger.LogTextFast(LogTag::TIMER, LogLevel::MASS_DATA_PRINT, "%s: %u frames, %f s", p_title, p_profile.frameCount, frameTime);
+            printf("%s: %u frames, %f s\n", p_title.c_str(), p_profile.frameCount, frameTime);
+
+            // Depth first, children in the order they first ran
+            std::vector<std::pair<uint32_t, uint32_t>> stack;
+            std::vector<uint32_t> children;
+            for(uint32_t root = p_profile.firstRoot; root != FrameProfile::NO_PARENT; root = p_profile.nodes[root].nextSibling)
             {
-                logger.LogText(LogTag::TIMER, LogLevel::MASS_DATA_PRINT, "%s, %f", i.first.c_str(), i.second.data);
-                printf("%s, %f\n", i.first.c_str(), i.second.data);
+                stack.push_back({root, 0});
+                while(!stack.empty())
+                {
+                    const uint32_t index = stack.back().first;
+                    const uint32_t depth = stack.back().second;
+                    stack.pop_back();
+
+                    const TimerNode& node = p_profile.nodes[index];
+                    std::string name = std::string(depth * 2, ' ') + sites[node.timerID].name;
+                    if(node.parent == FrameProfile::NO_PARENT)
+                    {
+                        name += " " + std::to_string(node.thread);
+                    }
+                    else if(!sites[node.timerID].file.empty())
+                    {
+                        name += " (" + sites[node.timerID].file + ":" + std::to_string(sites[node.timerID].line) + ")";
+                    }
+                    const double time = p_profile.GetSeconds(node.ticks);
+                    const double timePerFrame = p_profile.frameCount > 0 ? time * 1000.0 / p_profile.frameCount : 0;
+                    logger.LogTextFast(LogTag::TIMER, LogLevel::MASS_DATA_PRINT, "%s, %u calls, %f s, %f ms per frame", name, node.calls, time,
+                                       timePerFrame);
+                    printf("%s, %u calls, %f s, %f ms per frame\n", name.c_str(), node.calls, time, timePerFrame);
+
+                    children.clear();
+                    for(uint32_t child = node.firstChild; child != FrameProfile::NO_PARENT; child = p_profile.nodes[child].nextSibling)
+                    {
+                        children.push_back(child);
+                    }
+                    for(auto child = children.rbegin(); child != children.rend(); ++child)
+                    {
+                        stack.push_back({*child, depth + 1});
+                    }
+                }
+            }
+        }
+
+        void TimerManager::StartTraceCapture(const double& p_seconds, const double& p_spikeThreshold)
+        {
+            std::lock_guard<std::mutex> lock(m_frameLock);
+            m_traceEvents.assign(TRACE_MAX_EVENTS, TraceEvent());
+            m_traceEventCount = 0;
+            m_traceSeconds = p_seconds;
+            m_traceSpikeThreshold = p_spikeThreshold;
+            m_lastTraceEnd = 0;
+        }
+
+        void TimerManager::StopTraceCapture()
+        {
+            std::lock_guard<std::mutex> lock(m_frameLock);
+            std::vector<TraceEvent>().swap(m_traceEvents);
+            m_traceEventCount = 0;
+        }
+
+        bool TimerManager::WriteTrace(const std::string& p_fileName)
+        {
+            std::lock_guard<std::mutex> lock(m_frameLock);
+            return WriteTraceFile(p_fileName);
+        }
+
+        bool TimerManager::WriteTraceFile(const std::string& p_fileName)
+        {
+            if(m_traceEventCount == 0)
+            {
+                return false;
+            }
+            std::ofstream file(p_fileName, std::ofstream::out | std::ofstream::trunc);
+            if(!file.is_open())
+            {
+                return false;
+            }
+
+            std::vector<SiteInfo> sites;
+            {
+                std::lock_guard<std::mutex> lock(m_sitesLock);
+                sites = m_sites;
+            }
+
+            // Everything up to the end of the last frame, the rest hasn't been collected
+            const uint64_t traceEnd = m_frameStart;
+            const uint64_t traceTicks = static_cast<uint64_t>(m_traceSeconds * m_ticksPerSecond);
+            // Timestamps are from the creation of the TimerManager
+            const uint64_t traceStart = std::max(traceEnd > traceTicks ? traceEnd - traceTicks : 0, m_calibrationTicks);
+            const uint64_t ringSize = m_traceEvents.size();
+            const uint64_t firstEvent = m_traceEventCount > ringSize ? m_traceEventCount - ringSize : 0;
+            const double microsecondsPerTick = 1000000.0 / m_ticksPerSecond;
+            m_lastTraceEnd = traceEnd;
+
+            bool firstWritten = true;
+            // Complete events rather than begin and end, so timers cut off by the ring or the window can't mismatch
+            auto writeTimer = [&](const TraceEvent& p_start, const uint64_t& p_end) {
+                const uint64_t start = std::max(p_start.timestamp, traceStart);
+                const SiteInfo& site = sites[p_start.timerID];
+                file << (firstWritten ? "\n" : ",\n") << "{\"name\":";
+                WriteJsonString(file, site.name);
+                file << ",\"cat\":\"timer\",\"ph\":\"X\",\"ts\":" << (start - m_calibrationTicks) * microsecondsPerTick
+                     << ",\"dur\":" << (p_end > start ? p_end - start : 0) * microsecondsPerTick << ",\"pid\":1,\"tid\":"
+                     << (p_start.threadAndStart & ~TRACE_START);
+                if(!site.file.empty())
+                {
+                    file << ",\"args\":{\"file\":";
+                    WriteJsonString(file, site.file);
+                    file << ",\"line\":" << site.line << "}";
+                }
+                file << "}";
+                firstWritten = false;
+            };
+
+            file << std::fixed << std::setprecision(3) << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+            std::vector<std::vector<TraceEvent>> openTimers;
+            for(uint64_t i = firstEvent; i < m_traceEventCount; ++i)
+            {
+                const TraceEvent& event = m_traceEvents[i % ringSize];
+                const uint32_t thread = event.threadAndStart & ~TRACE_START;
+                if(thread >= openTimers.size())
+                {
+                    openTimers.resize(thread + 1);
+                }
+                if((event.threadAndStart & TRACE_START) != 0)
+                {
+                    openTimers[thread].push_back(event);
+                }
+                else if(!openTimers[thread].empty())
+                {
+                    // A stop without its start had the start overwritten in the ring and is left out
+                    if(event.timestamp >= traceStart)
+                    {
+                        writeTimer(openTimers[thread].back(), event.timestamp);
+                    }
+                    openTimers[thread].pop_back();
+                }
+            }
+
+            // Timers still running end with the trace
+            for(uint32_t thread = 0; thread < openTimers.size(); ++thread)
+            {
+                for(const auto& openTimer : openTimers[thread])
+                {
+                    writeTimer(openTimer, traceEnd);
+                }
+                file << (firstWritten ? "\n" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << thread
+                     << ",\"args\":{\"name\":\"Thread " << thread << "\"}}";
+                firstWritten = false;
             }
+            file << "\n]}\n";
+            return file.good();
         }
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,121 @@
+#pragma once
+#include <Doremi/Core/Include/GameCore.hpp>
+#include <DoremiEngine/Physics/Include/CharacterControlManager.hpp>
+#include <DirectXMath.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Doremi
+{
+    /**
+    What the replay runs. Two runs with the same settings, level and worker thread count step the same inputs
+    */
+    struct PhysicsReplaySettings
+    {
+        // Level to load, relative to the working directory
+        std::string levelFile;
+        int frameCount = 600;
+        uint32_t seed = 1337;
+        float stepLength = 1.0f / 60.0f;
+        // Bullets fired every frame, they are removed after bulletLifeFrames like the game does after five seconds
+        int bulletsPerFrame = 2;
+        int bulletLifeFrames = 300;
+        int controllerCount = 64;
+        int emitterCount = 4;
+        // File to write the time of every step to as CSV, empty skips it
+        std::string timingFile;
+    };
+
+    /**
+    Headless physics benchmark. Loads the collision meshes of a level, spawns a scripted workload of bullets, character
+    controllers and pressure particles from a fixed seed and steps it. Prints timing per step and a checksum of all poses
+    at the end, so a change in performance or in simulation result shows up between runs.
+    */
+    class PhysicsReplayMain : public Core::GameCore
+    {
+    public:
+        explicit PhysicsReplayMain(const PhysicsReplaySettings& p_settings);
+
+        virtual ~PhysicsReplayMain();
+
+        /**
+        Runs the whole replay and prints the report. Returns the pose checksum
+        */
+        uint64_t Start();
+
+    private:
+        struct Bullet
+        {
+            int id;
+            int spawnFrame;
+        };
+
+        struct Controller
+        {
+            int id;
+            DirectX::XMFLOAT3 heading;
+        };
+
+        struct Emitter
+        {
+            int id;
+            DirectX::XMFLOAT3 position;
+            float startYaw;
+        };
+
+        void Initialize();
+
+        /**
+        Creates the controllers and emitters, they live for the whole replay
+        */
+        void SpawnWorkload();
+
+        /**
+        Gives the scripted input of one frame to physics, the simulation itself is not part of it
+        */
+        void UpdateWorkload(int p_frame);
+
+        void SpawnBullet(int p_frame);
+
+        DirectX::XMFLOAT3 RandomPosition();
+        DirectX::XMFLOAT3 RandomDirection(bool p_horizontal);
+
+        /**
+        Takes an ID of a removed body if there is one. Reusing them keeps the IDs dense like entity IDs in the game
+        */
+        int TakeID();
+
+        /**
+        FNV-1a over the exact bits of every bullet pose, controller position and particle position
+        */
+        uint64_t ComputePoseChecksum();
+
+        void Report(uint64_t p_checksum);
+
+        void Stop() override;
+
+        const PhysicsReplaySettings m_settings;
+        std::mt19937 m_randomGenerator;
+
+        // Area of the level the workload is spawned in
+        DirectX::XMFLOAT3 m_levelMin;
+        DirectX::XMFLOAT3 m_levelMax;
+
+        int m_nextID;
+        std::vector<int> m_freeIDs;
+        int m_bulletMaterial;
+        std::vector<Bullet> m_bullets;
+        std::vector<Controller> m_controllers;
+        std::vector<Emitter> m_emitters;
+        // Kept between frames so the workload doesn't allocate every frame
+        std::vector<DoremiEngine::Physics::ControllerMove> m_moves;
+        std::vector<DoremiEngine::Physics::ControllerCollisionFlags> m_collisionFlags;
+
+        // Time of each step in seconds, the workload update and the simulation separately
+        std::vector<double> m_workloadTimes;
+        std::vector<double> m_simulationTimes;
+    };
+}
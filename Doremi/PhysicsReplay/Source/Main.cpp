@@ -0,0 +1,102 @@
+// Project specific
+#include <PhysicsReplay.hpp>
+
+// Standard libraries
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <string>
+
+namespace
+{
+    void PrintUsage()
+    {
+        std::cout << "Usage: PhysicsReplay <level.drm> [--frames N] [--seed N] [--bullets N] [--controllers N] [--emitters N]"
+                  << " [--timing file.csv] [--expect checksum]" << std::endl
+                  << "Steps physics of the level with a scripted workload and prints step times and a pose checksum." << std::endl
+                  << "With --expect the exit code is 2 if the checksum differs, runs are only comparable with the same WorkerThreadCount."
+                  << std::endl;
+    }
+
+    // Reads the settings, returns false if the arguments are wrong
+    bool ParseArguments(int argc, const char* argv[], Doremi::PhysicsReplaySettings& o_settings, std::string& o_expectedChecksum)
+    {
+        if(argc < 2)
+        {
+            return false;
+        }
+        o_settings.levelFile = argv[1];
+        for(int i = 2; i < argc; i += 2)
+        {
+            if(i + 1 >= argc)
+            {
+                return false;
+            }
+            const std::string value = argv[i + 1];
+            if(strcmp(argv[i], "--frames") == 0)
+            {
+                o_settings.frameCount = std::stoi(value);
+            }
+            else if(strcmp(argv[i], "--seed") == 0)
+            {
+                o_settings.seed = static_cast<uint32_t>(std::stoul(value));
+            }
+            else if(strcmp(argv[i], "--bullets") == 0)
+            {
+                o_settings.bulletsPerFrame = std::stoi(value);
+            }
+            else if(strcmp(argv[i], "--controllers") == 0)
+            {
+                o_settings.controllerCount = std::stoi(value);
+            }
+            else if(strcmp(argv[i], "--emitters") == 0)
+            {
+                o_settings.emitterCount = std::stoi(value);
+            }
+            else if(strcmp(argv[i], "--timing") == 0)
+            {
+                o_settings.timingFile = value;
+            }
+            else if(strcmp(argv[i], "--expect") == 0)
+            {
+                o_expectedChecksum = value;
+            }
+            else
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+int main(int argc, const char* argv[])
+{
+    Doremi::PhysicsReplaySettings settings;
+    std::string expectedChecksum;
+    try
+    {
+        if(!ParseArguments(argc, argv, settings, expectedChecksum))
+        {
+            PrintUsage();
+            return 1;
+        }
+
+        uint64_t checksum;
+        {
+            Doremi::PhysicsReplayMain replay(settings);
+            checksum = replay.Start();
+        }
+        if(!expectedChecksum.empty() && std::stoull(expectedChecksum, nullptr, 16) != checksum)
+        {
+            std::cout << "Pose checksum differs from the expected " << expectedChecksum << std::endl;
+            return 2;
+        }
+    }
+    catch(const std::exception& e)
+    {
+        std::cout << "Unhandled exception: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
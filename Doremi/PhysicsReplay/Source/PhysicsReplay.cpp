@@ -0,0 +1,318 @@
+// Project specific
+#include <PhysicsReplay.hpp>
+
+// Engine
+#include <DoremiEngine/Core/Include/Subsystem/EngineModuleEnum.hpp>
+#include <DoremiEngine/Core/Include/SharedContext.hpp>
+#include <DoremiEngine/Physics/Include/PhysicsModule.hpp>
+#include <DoremiEngine/Physics/Include/PhysicsMaterialManager.hpp>
+#include <DoremiEngine/Physics/Include/RigidBodyManager.hpp>
+#include <DoremiEngine/Physics/Include/CharacterControlManager.hpp>
+#include <DoremiEngine/Physics/Include/FluidManager.hpp>
+
+// Game
+#include <Doremi/Core/Include/LevelLoaderPhysics.hpp>
+
+// Utilities
+#include <Utility/Utilities/Include/Chrono/Timer.hpp>
+
+// Standard libraries
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+namespace Doremi
+{
+    using namespace DirectX;
+
+    namespace
+    {
+        // Same as the enemy bullets in the game
+        const float BULLET_FORCE = 1500.0f;
+        const XMFLOAT3 BULLET_DIMENSIONS = XMFLOAT3(0.25f, 0.25f, 0.25f);
+        const XMFLOAT2 CONTROLLER_DIMENSIONS = XMFLOAT2(3.0f, 1.5f);
+        const float CONTROLLER_SPEED = 45.0f;
+        const float CONTROLLER_FALL_SPEED = 20.0f;
+        // Frames between controllers picking a new direction
+        const int CONTROLLER_TURN_INTERVAL = 120;
+        // How fast emitters sweep around, radians per second
+        const float EMITTER_TURN_SPEED = 1.0f;
+
+        const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+        const uint64_t FNV_PRIME = 1099511628211ULL;
+
+        uint64_t HashBytes(uint64_t p_hash, const void* p_data, const size_t& p_size)
+        {
+            const uint8_t* bytes = static_cast<const uint8_t*>(p_data);
+            for(size_t i = 0; i < p_size; ++i)
+            {
+                p_hash = (p_hash ^ bytes[i]) * FNV_PRIME;
+            }
+            return p_hash;
+        }
+
+        // Value at the given fraction of the sorted times
+        double Percentile(const std::vector<double>& p_sortedTimes, const double& p_fraction)
+        {
+            if(p_sortedTimes.empty())
+            {
+                return 0;
+            }
+            const size_t index = static_cast<size_t>(p_fraction * static_cast<double>(p_sortedTimes.size() - 1) + 0.5);
+            return p_sortedTimes[index];
+        }
+
+        void PrintTimes(const std::string& p_name, std::vector<double> p_times)
+        {
+            std::sort(p_times.begin(), p_times.end());
+            double total = 0;
+            for(auto& time : p_times)
+            {
+                total += time;
+            }
+            const double mean = p_times.empty() ? 0 : total / static_cast<double>(p_times.size());
+            std::cout << std::left << std::setw(12) << p_name << std::right << std::fixed << std::setprecision(3) << " mean " << mean * 1000.0
+                      << " ms, min " << Percentile(p_times, 0) * 1000.0 << " ms, median " << Percentile(p_times, 0.5) * 1000.0 << " ms, p95 "
+                      << Percentile(p_times, 0.95) * 1000.0 << " ms, p99 " << Percentile(p_times, 0.99) * 1000.0 << " ms, max "
+                      << Percentile(p_times, 1) * 1000.0 << " ms" << std::endl;
+        }
+
+        // Same values as the pressure particle blueprint
+        DoremiEngine::Physics::ParticleEmitterData CreateEmitterData(const XMFLOAT3& p_position, const float& p_yaw)
+        {
+            DoremiEngine::Physics::ParticleEmitterData data;
+            data.m_active = true;
+            data.m_position = p_position;
+            data.m_dimensions = XMFLOAT2(0, 0);
+            XMStoreFloat4(&data.m_direction, XMQuaternionRotationRollPitchYaw(0, p_yaw, 0));
+            data.m_launchPressure = 100.0f;
+            data.m_emissionRate = 0.05f;
+            data.m_density = 2.0f;
+            data.m_numParticlesX = 5;
+            data.m_numParticlesY = 1;
+            data.m_emissionAreaDimensions = XMFLOAT2(XM_PIDIV4, XM_PI / 5.0f);
+            data.m_size = 1.0f;
+            return data;
+        }
+    }
+
+    PhysicsReplayMain::PhysicsReplayMain(const PhysicsReplaySettings& p_settings)
+        : m_settings(p_settings), m_randomGenerator(p_settings.seed), m_nextID(0), m_bulletMaterial(0)
+    {
+    }
+
+    PhysicsReplayMain::~PhysicsReplayMain() {}
+
+    uint64_t PhysicsReplayMain::Start()
+    {
+        Initialize();
+        SpawnWorkload();
+
+        DoremiEngine::Physics::PhysicsModule& physicsModule = m_sharedContext->GetPhysicsModule();
+        m_workloadTimes.reserve(m_settings.frameCount);
+        m_simulationTimes.reserve(m_settings.frameCount);
+        Utilities::Chrono::Timer timer;
+        for(int frame = 0; frame < m_settings.frameCount; ++frame)
+        {
+            timer.Reset();
+            UpdateWorkload(frame);
+            m_workloadTimes.push_back(timer.Tick().GetElapsedTimeInSeconds());
+            physicsModule.Update(m_settings.stepLength);
+            m_simulationTimes.push_back(timer.Tick().GetElapsedTimeInSeconds());
+        }
+
+        const uint64_t checksum = ComputePoseChecksum();
+        Report(checksum);
+        return checksum;
+    }
+
+    void PhysicsReplayMain::Initialize()
+    {
+        const DoremiEngine::Core::SharedContext& sharedContext = InitializeEngine(DoremiEngine::Core::EngineModuleEnum::PHYSICS);
+
+        Core::LevelLoaderPhysics levelLoader(sharedContext);
+        m_nextID = levelLoader.LoadLevel(m_settings.levelFile, m_levelMin, m_levelMax);
+        std::cout << "Loaded " << m_nextID << " collision meshes from " << m_settings.levelFile << std::endl;
+        if(m_nextID == 0)
+        {
+            // Nothing to bound the workload with, use an area around the origin instead
+            m_levelMin = XMFLOAT3(-100.0f, 0.0f, -100.0f);
+            m_levelMax = XMFLOAT3(100.0f, 50.0f, 100.0f);
+        }
+    }
+
+    void PhysicsReplayMain::SpawnWorkload()
+    {
+        using namespace DoremiEngine::Physics;
+        PhysicsModule& physicsModule = m_sharedContext->GetPhysicsModule();
+        m_bulletMaterial = physicsModule.GetPhysicsMaterialManager().CreateMaterial(0.5f, 0.5f, 0.5f);
+        const int controllerMaterial = physicsModule.GetPhysicsMaterialManager().CreateMaterial(0.0f, 0.0f, 0.0f);
+
+        CharacterControlManager& characterControlManager = physicsModule.GetCharacterControlManager();
+        for(int i = 0; i < m_settings.controllerCount; ++i)
+        {
+            Controller controller;
+            controller.id = TakeID();
+            controller.heading = RandomDirection(true);
+            // Dropped in from the top of the level
+            XMFLOAT3 position = RandomPosition();
+            position.y = m_levelMax.y;
+            characterControlManager.AddController(controller.id, controllerMaterial, position, CONTROLLER_DIMENSIONS);
+            m_controllers.push_back(controller);
+        }
+
+        FluidManager& fluidManager = physicsModule.GetFluidManager();
+        std::uniform_real_distribution<float> yawDistribution(-XM_PI, XM_PI);
+        for(int i = 0; i < m_settings.emitterCount; ++i)
+        {
+            Emitter emitter;
+            emitter.id = i;
+            emitter.position = RandomPosition();
+            emitter.startYaw = yawDistribution(m_randomGenerator);
+            fluidManager.CreateParticleEmitter(emitter.id, CreateEmitterData(emitter.position, emitter.startYaw));
+            m_emitters.push_back(emitter);
+        }
+    }
+
+    void PhysicsReplayMain::UpdateWorkload(int p_frame)
+    {
+        using namespace DoremiEngine::Physics;
+        PhysicsModule& physicsModule = m_sharedContext->GetPhysicsModule();
+        RigidBodyManager& rigidBodyManager = physicsModule.GetRigidBodyManager();
+
+        // Bullets older than their life time are removed first, they are ordered by age
+        size_t expired = 0;
+        while(expired < m_bullets.size() && p_frame - m_bullets[expired].spawnFrame >= m_settings.bulletLifeFrames)
+        {
+            rigidBodyManager.RemoveBody(m_bullets[expired].id);
+            m_freeIDs.push_back(m_bullets[expired].id);
+            ++expired;
+        }
+        m_bullets.erase(m_bullets.begin(), m_bullets.begin() + expired);
+        for(int i = 0; i < m_settings.bulletsPerFrame; ++i)
+        {
+            SpawnBullet(p_frame);
+        }
+
+        // Controllers walk straight and turn now and then, all of them in one batch like the movement manager
+        m_moves.resize(m_controllers.size());
+        for(size_t i = 0; i < m_controllers.size(); ++i)
+        {
+            Controller& controller = m_controllers[i];
+            if((p_frame + static_cast<int>(i)) % CONTROLLER_TURN_INTERVAL == 0)
+            {
+                controller.heading = RandomDirection(true);
+            }
+            const float distance = CONTROLLER_SPEED * m_settings.stepLength;
+            m_moves[i].id = controller.id;
+            m_moves[i].displacement =
+                XMFLOAT3(controller.heading.x * distance, -CONTROLLER_FALL_SPEED * m_settings.stepLength, controller.heading.z * distance);
+        }
+        physicsModule.GetCharacterControlManager().MoveControllers(m_moves, m_settings.stepLength, m_collisionFlags);
+
+        // Emitters sweep around, each from where it started
+        FluidManager& fluidManager = physicsModule.GetFluidManager();
+        const float time = static_cast<float>(p_frame) * m_settings.stepLength;
+        for(auto& emitter : m_emitters)
+        {
+            fluidManager.SetParticleEmitterData(emitter.id, CreateEmitterData(emitter.position, emitter.startYaw + time * EMITTER_TURN_SPEED));
+        }
+    }
+
+    void PhysicsReplayMain::SpawnBullet(int p_frame)
+    {
+        DoremiEngine::Physics::RigidBodyManager& rigidBodyManager = m_sharedContext->GetPhysicsModule().GetRigidBodyManager();
+        Bullet bullet;
+        bullet.id = TakeID();
+        bullet.spawnFrame = p_frame;
+        rigidBodyManager.AddBoxBodyDynamic(bullet.id, RandomPosition(), XMFLOAT4(0, 0, 0, 1), BULLET_DIMENSIONS, m_bulletMaterial);
+        rigidBodyManager.SetGravity(bullet.id, false);
+        rigidBodyManager.SetCallbackFiltering(bullet.id, 3, 1, 8, 2);
+        const XMFLOAT3 direction = RandomDirection(false);
+        XMFLOAT3 force;
+        XMStoreFloat3(&force, XMLoadFloat3(&direction) * BULLET_FORCE);
+        rigidBodyManager.AddForceToBody(bullet.id, force);
+        m_bullets.push_back(bullet);
+    }
+
+    XMFLOAT3 PhysicsReplayMain::RandomPosition()
+    {
+        std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+        const float x = distribution(m_randomGenerator);
+        const float y = distribution(m_randomGenerator);
+        const float z = distribution(m_randomGenerator);
+        return XMFLOAT3(m_levelMin.x + (m_levelMax.x - m_levelMin.x) * x, m_levelMin.y + (m_levelMax.y - m_levelMin.y) * y,
+                        m_levelMin.z + (m_levelMax.z - m_levelMin.z) * z);
+    }
+
+    XMFLOAT3 PhysicsReplayMain::RandomDirection(bool p_horizontal)
+    {
+        std::uniform_real_distribution<float> distribution(-XM_PI, XM_PI);
+        const float yaw = distribution(m_randomGenerator);
+        const float pitch = p_horizontal ? 0.0f : distribution(m_randomGenerator) * 0.25f;
+        return XMFLOAT3(cosf(pitch) * sinf(yaw), sinf(pitch), cosf(pitch) * cosf(yaw));
+    }
+
+    int PhysicsReplayMain::TakeID()
+    {
+        if(m_freeIDs.empty())
+        {
+            return m_nextID++;
+        }
+        const int id = m_freeIDs.back();
+        m_freeIDs.pop_back();
+        return id;
+    }
+
+    uint64_t PhysicsReplayMain::ComputePoseChecksum()
+    {
+        using namespace DoremiEngine::Physics;
+        PhysicsModule& physicsModule = m_sharedContext->GetPhysicsModule();
+        uint64_t hash = FNV_OFFSET_BASIS;
+        for(auto& bullet : m_bullets)
+        {
+            const XMFLOAT3 position = physicsModule.GetRigidBodyManager().GetBodyPosition(bullet.id);
+            const XMFLOAT4 orientation = physicsModule.GetRigidBodyManager().GetBodyOrientation(bullet.id);
+            hash = HashBytes(hash, &position, sizeof(position));
+            hash = HashBytes(hash, &orientation, sizeof(orientation));
+        }
+        for(auto& controller : m_controllers)
+        {
+            const XMFLOAT3 position = physicsModule.GetCharacterControlManager().GetPosition(controller.id);
+            hash = HashBytes(hash, &position, sizeof(position));
+        }
+        std::vector<XMFLOAT3> particlePositions;
+        for(auto& emitter : m_emitters)
+        {
+            particlePositions.clear();
+            physicsModule.GetFluidManager().GetParticlePositions(emitter.id, particlePositions);
+            if(!particlePositions.empty())
+            {
+                hash = HashBytes(hash, &particlePositions[0], sizeof(XMFLOAT3) * particlePositions.size());
+            }
+        }
+        return hash;
+    }
+
+    void PhysicsReplayMain::Report(uint64_t p_checksum)
+    {
+        std::cout << "Stepped " << m_settings.frameCount << " frames with seed " << m_settings.seed << ", " << m_bullets.size() << " bullets, "
+                  << m_controllers.size() << " controllers and " << m_emitters.size() << " emitters alive at the end" << std::endl;
+        PrintTimes("Workload", m_workloadTimes);
+        PrintTimes("Simulation", m_simulationTimes);
+        std::cout << "Pose checksum " << std::hex << std::setw(16) << std::setfill('0') << p_checksum << std::dec << std::setfill(' ') << std::endl;
+
+        if(!m_settings.timingFile.empty())
+        {
+            std::ofstream file(m_settings.timingFile, std::ofstream::out | std::ofstream::trunc);
+            file << "frame,workload_ms,simulation_ms\n";
+            for(size_t i = 0; i < m_simulationTimes.size(); ++i)
+            {
+                file << i << "," << m_workloadTimes[i] * 1000.0 << "," << m_simulationTimes[i] * 1000.0 << "\n";
+            }
+        }
+    }
+
+    void PhysicsReplayMain::Stop() {}
+}
@@ -65,6 +65,10 @@ namespace Doremi
             TOODCM doc
         */
         std::vector<Core::Manager*> m_managers;
+        // If physics steps while the first managers run, set by AsynchronousPhysics in the configuration
+        bool m_asynchronousPhysics;
+        // Telemetry of every update step, its length, the number of entities and connected clients
+        uint32_t m_tickTelemetrySchema;
         // Track memory leak
         std::map<std::string, SSIZE_T> m_memoryLeakFromStringDelta;
         std::map<std::string, SSIZE_T> m_memoryLeakFromString;
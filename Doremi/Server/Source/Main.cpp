@@ -1,5 +1,6 @@
 // Project specific
 #include <Server.hpp>
+#include <Doremi/Core/Include/Timing/TimerManager.hpp>
 
 #define PLATFORM_WINDOWS 1
 #define PLATFORM_UNIX 2
@@ -156,6 +157,9 @@ BOOL CtrlHandler(DWORD fdwCtrlType)
             attemptGracefulShutdown();
             Sleep(10000); // Sleep until 10 seconds, if process has been shutof during this time, this will exit correctly
             return TRUE;
+        case CTRL_BREAK_EVENT: // Write the timers of the last seconds, if they are captured
+            Doremi::Core::TimerManager::GetInstance().RequestTraceDump();
+            return TRUE;
         default:
             return FALSE;
     }
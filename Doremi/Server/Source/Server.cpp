@@ -9,6 +9,7 @@
 #include <DoremiEngine/AI/Include/AIModule.hpp>
 #include <DoremiEngine/AI/Include/Interface/SubModule/PotentialFieldSubModule.hpp>
 #include <DoremiEngine/AI/Include/Interface/PotentialField/PotentialFieldActor.hpp>
+#include <DoremiEngine/Configuration/Include/ConfigurationModule.hpp>
 
 // Game
 #include <Doremi/Core/Include/GameCore.hpp>
@@ -17,6 +18,9 @@
 #include <Doremi/Core/Include/LevelLoaderServer.hpp>
 #include <Doremi/Core/Include/EntityComponent/EntityFactory.hpp>
 #include <Doremi/Core/Include/HealthChecker.hpp>
+#include <Doremi/Core/Include/Helper/ProximityChecker.hpp>
+#include <Doremi/Core/Include/AIHelper/AILevelOfDetailHandler.hpp>
+#include <Doremi/Core/Include/AIHelper/AITransformSnapshotHandler.hpp>
 
 // Components
 #include <Doremi/Core/Include/EntityComponent/Components/TransformComponent.hpp>
@@ -33,11 +37,13 @@
 #include <Doremi/Core/Include/PlayerSpawnerHandler.hpp>
 #include <Doremi/Core/Include/TimeHandler.hpp>
 #include <Doremi/Core/Include/ServerStateHandler.hpp>
+#include <Doremi/Core/Include/ServerStatsHandler.hpp>
 #include <Doremi/Core/Include/TreeCreator.hpp>
 
 // Managers
 #include <Doremi/Core/Include/Manager/Manager.hpp>
 #include <Doremi/Core/Include/Network/NetworkManagerServer.hpp>
+#include <Doremi/Core/Include/Network/NetworkConnectionsServer.hpp>
 #include <Doremi/Core/Include/Manager/MovementManagerServer.hpp>
 #include <Doremi/Core/Include/Manager/RigidTransformSyncManager.hpp>
 #include <Doremi/Core/Include/Manager/FrequencyAffectedObjectManager.hpp>
@@ -64,9 +70,11 @@
 
 // Timer
 #include <Doremi/Core/Include/Timing/TimerManager.hpp>
+#include <Doremi/Core/Include/Timing/AllocationTracker.hpp>
 #include <Doremi/Core/Include/Timing/NamedTimer.hpp>
 #include <Doremi/Core/Include/Timing/FunctionTimer.hpp>
 #include <Utility/Utilities/Include/Chrono/Timer.hpp>
+#include <Utility/Utilities/Include/Memory/MemoryAllocator.hpp>
 
 // Third party
 #include <DirectXMath.h>
@@ -85,7 +93,7 @@ namespace Doremi
     using namespace Core;
     using namespace Utilities::Logging;
 
-    ServerMain::ServerMain() {}
+    ServerMain::ServerMain() : m_asynchronousPhysics(false), m_tickTelemetrySchema(0) {}
 
     ServerMain::~ServerMain()
     {
@@ -102,6 +110,19 @@ namespace Doremi
         const DoremiEngine::Core::SharedContext& sharedContext = InitializeEngine(
             DoremiEngine::Core::EngineModuleEnum::NETWORK | DoremiEngine::Core::EngineModuleEnum::PHYSICS | DoremiEngine::Core::EngineModuleEnum::AI);
 
+        // Before the first component shelf is created
+        {
+            using namespace Utilities::Memory;
+            const DoremiEngine::Configuration::ConfiguartionInfo& t_memoryConfiguration =
+                sharedContext.GetConfigurationModule().GetAllConfigurationValues();
+            MemoryAllocator::SetDefaultPageOptions(PageOptions(t_memoryConfiguration.LargePages != 0, t_memoryConfiguration.NumaNode));
+            if(t_memoryConfiguration.LargePages != 0 && MemoryAllocator::GetLargePageSize() == 0)
+            {
+                using namespace Utilities::Logging;
+                m_logger->LogText(LogTag::MEMORY, LogLevel::WARNING, "LargePages is set but the process can't use large pages, using regular pages");
+            }
+        }
+
         /* This starts the physics handler. Should not be done here, but since this is the general
         code dump, it'll work for now TODOJB*/
         Core::EntityFactory::StartupEntityFactory(sharedContext);
@@ -110,6 +131,25 @@ namespace Doremi
         Core::PlayerHandlerServer::StartPlayerHandlerServer(sharedContext);
         Core::PlayerSpawnerHandler::StartupPlayerSpawnerHandler(sharedContext);
         Core::ServerStateHandler::StartupServerStateHandler(sharedContext);
+        Core::AILevelOfDetailHandler::StartupAILevelOfDetailHandler(sharedContext);
+        Core::AITransformSnapshotHandler::StartupAITransformSnapshotHandler(sharedContext);
+        Core::ServerStatsHandler::StartupServerStatsHandler(sharedContext);
+        Core::AllocationTracker::StartupAllocationTracker(sharedContext);
+        Core::ProximityChecker::StartupProximityChecker(sharedContext);
+        const DoremiEngine::Configuration::ConfiguartionInfo& t_configuration = sharedContext.GetConfigurationModule().GetAllConfigurationValues();
+        m_asynchronousPhysics = t_configuration.AsynchronousPhysics != 0;
+        if(t_configuration.TraceCaptureSeconds > 0)
+        {
+            Core::TimerManager::GetInstance().StartTraceCapture(t_configuration.TraceCaptureSeconds, t_configuration.TraceSpikeThreshold);
+        }
+        {
+            using namespace Utilities::Logging;
+            m_tickTelemetrySchema = m_logger->RegisterDataSchema("ServerTick", {{"updateTime", TelemetryFieldType::DOUBLE},
+                                                                                {"entityCount", TelemetryFieldType::INT32},
+                                                                                {"connectedClients", TelemetryFieldType::UINT32},
+                                                                                {"frameArenaBytes", TelemetryFieldType::UINT64},
+                                                                                {"frameArenaOverflows", TelemetryFieldType::UINT32}});
+        }
 
         ////////////////Example only////////////////
         // Create manager
@@ -141,10 +181,21 @@ namespace Doremi
         // m_managers.push_back(t_physicsManager);
         m_managers.push_back(t_serverNetworkManager);
         // m_managers.push_back(t_extraDrainManager);
-        m_managers.push_back(t_rigidTransSyndManager);
-        m_managers.push_back(t_pressureParticleManager);
-        m_managers.push_back(t_groundEffectManagerServer);
-        m_managers.push_back(t_aiPathManager);
+        if(m_asynchronousPhysics)
+        {
+            // Pathing only reads the transform snapshot so it runs while physics steps, the sync manager then waits for the step
+            m_managers.push_back(t_aiPathManager);
+            m_managers.push_back(t_rigidTransSyndManager);
+            m_managers.push_back(t_pressureParticleManager); // Particles can't be read while simulating
+            m_managers.push_back(t_groundEffectManagerServer);
+        }
+        else
+        {
+            m_managers.push_back(t_rigidTransSyndManager);
+            m_managers.push_back(t_pressureParticleManager);
+            m_managers.push_back(t_groundEffectManagerServer);
+            m_managers.push_back(t_aiPathManager);
+        }
         m_managers.push_back(t_aiTargetManager); // Must be before movement
         m_managers.push_back(t_jumpManager);
         m_managers.push_back(t_gravManager);
@@ -225,6 +276,7 @@ namespace Doremi
         // m_lastMemory = pmc.PrivateUsage;
 
 
+        Utilities::Chrono::Timer t_updateTimer;
         ServerStates state = ServerStates::LOBBY;
         while(state != ServerStates::EXIT)
         {
@@ -241,10 +293,28 @@ namespace Doremi
             while(t_timeHandler->ShouldUpdateFrame())
             {
                 // Update Game logic
+                t_updateTimer.Reset();
                 UpdateGame(t_timeHandler->UpdateStepLen);
+                const double t_updateTime = t_updateTimer.Tick().GetElapsedTimeInSeconds();
+
+                // Temporaries of the managers from the update before this one are freed
+                Utilities::Memory::FrameArena& t_frameArena = Core::Manager::GetFrameArena();
+                t_frameArena.SwapFrames();
+                const Utilities::Memory::FrameArenaStatistics& t_frameArenaStatistics = t_frameArena.GetLastFrameStatistics();
+
+                const uint32_t t_connectedClients =
+                    static_cast<uint32_t>(Core::NetworkConnectionsServer::GetInstance()->GetConnectedClientConnections().size());
+                m_logger->LogData(m_tickTelemetrySchema, t_updateTime, Core::EntityHandler::GetInstance().GetLastEntityIndex(), t_connectedClients,
+                                  static_cast<uint64_t>(t_frameArenaStatistics.allocatedBytes),
+                                  static_cast<uint32_t>(t_frameArenaStatistics.overflowAllocations));
+                Core::ServerStatsHandler::GetInstance()->Update(t_updateTime);
+                Core::AllocationTracker::GetInstance()->Update(t_timeHandler->UpdateStepLen);
 
                 // Update accumulator and gametime
                 t_timeHandler->UpdateAccumulatorAndGameTime();
+
+                // One call tree per tick
+                Doremi::Core::TimerManager::GetInstance().EndFrame();
             }
             state = Core::ServerStateHandler::GetInstance()->GetState();
         }
@@ -282,6 +352,13 @@ namespace Doremi
     void ServerMain::UpdateGame(double p_deltaTime)
     {
         FUNCTION_TIMER
+        // Start the step, it runs on the worker threads until the RigidTransformSyncManager waits for it
+        if(m_asynchronousPhysics)
+        {
+            NAMED_TIMER("BeginSimulate");
+            m_sharedContext->GetPhysicsModule().BeginSimulate(static_cast<float>(p_deltaTime));
+        }
+
         // Deliver basic events
         static_cast<Core::EventHandlerServer*>(Core::EventHandler::GetInstance())->DeliverBasicEvents();
 
@@ -293,6 +370,15 @@ namespace Doremi
 
         Core::PlayerHandler::GetInstance()->Update(p_deltaTime);
 
+        // Sync the spatial hash after entities have been removed but before the managers start querying it
+        Core::ProximityChecker::GetInstance().UpdateSpatialHash();
+
+        // Decide which AI agents get their expensive updates this update, must be before the AI managers
+        {
+            NAMED_TIMER("AILevelOfDetailHandler");
+            Core::AILevelOfDetailHandler::GetInstance()->Update();
+        }
+
         //// Track memory leak
         // PlayerHandlerServer* t_playerHandler = static_cast<PlayerHandlerServer*>(PlayerHandler::GetInstance());
         // bool shouldStart = false;
@@ -313,13 +399,15 @@ namespace Doremi
         const size_t length = m_managers.size();
         for(size_t i = 0; i < length; i++)
         {
-            const std::string& name = m_managers.at(i)->GetName();
-            NAMED_TIMER(name);
+            ID_TIMER(m_managers.at(i)->GetTimerID());
             m_managers.at(i)->Update(p_deltaTime);
 
             // Track memory leak
             // TrackMemoryLeak(m_managers.at(i)->GetName(), shouldStart);
         }
+
+        // All transforms are written, the AI reads these during the next update
+        Core::AITransformSnapshotHandler::GetInstance()->Capture();
     }
 
     void ServerMain::Start()
@@ -0,0 +1,112 @@
+#pragma once
+#include <DirectXMath.h>
+#include <cstddef>
+namespace DoremiEngine
+{
+    namespace AI
+    {
+        class PotentialField;
+        /**
+        Phermone one actor has added to a quad
+        */
+        struct PhermoneDeposit
+        {
+            DirectX::XMINT2 quad;
+            double time; // The phermone clock of the field when the phermone was added
+            const PotentialField* field; // The field the quad is in
+            PhermoneDeposit() : quad(0, 0), time(0), field(nullptr) {}
+            PhermoneDeposit(const DirectX::XMINT2& p_quad, const double& p_time, const PotentialField* p_field)
+                : quad(p_quad), time(p_time), field(p_field)
+            {
+            }
+        };
+
+        /**
+        The last quads an actor has visited, oldest first. Stored in a fixed size ring buffer so adding a quad never allocates or moves the
+        other quads. The length can be changed up to MAX_LENGTH, when the trail is full the oldest quad is dropped
+        */
+        class PhermoneTrail
+        {
+        public:
+            static const size_t MAX_LENGTH = 64;
+
+            PhermoneTrail() : m_start(0), m_size(0), m_length(15) {}
+
+            /**
+            Sets how many quads the trail remembers, clamped to [1, MAX_LENGTH]. Drops the oldest quads if the trail is too long
+            */
+            void SetLength(const size_t& p_length)
+            {
+                m_length = p_length;
+                if(m_length < 1)
+                {
+                    m_length = 1;
+                }
+                else if(m_length > MAX_LENGTH)
+                {
+                    m_length = MAX_LENGTH;
+                }
+                while(m_size > m_length)
+                {
+                    PopOldest();
+                }
+            }
+
+            /**
+            Returns how many quads the trail remembers
+            */
+            size_t GetLength() const { return m_length; }
+
+            /**
+            Returns how many quads there are in the trail right now
+            */
+            size_t Size() const { return m_size; }
+
+            /**
+            Returns the quad at the given index, 0 is the oldest
+            */
+            const PhermoneDeposit& operator[](const size_t& p_index) const { return m_quads[(m_start + p_index) % MAX_LENGTH]; }
+
+            /**
+            Returns the latest added quad, the trail must not be empty
+            */
+            const PhermoneDeposit& Newest() const { return (*this)[m_size - 1]; }
+
+            /**
+            Adds a quad to the trail. If the trail is full the oldest quad is dropped and copied to o_dropped, returns true if a quad was dropped
+            */
+            bool Push(const PhermoneDeposit& p_quad, PhermoneDeposit& o_dropped)
+            {
+                bool dropped = false;
+                if(m_size == m_length)
+                {
+                    o_dropped = m_quads[m_start];
+                    PopOldest();
+                    dropped = true;
+                }
+                m_quads[(m_start + m_size) % MAX_LENGTH] = p_quad;
+                ++m_size;
+                return dropped;
+            }
+
+            /**
+            Removes the oldest quad, does nothing if the trail is empty
+            */
+            void PopOldest()
+            {
+                if(m_size == 0)
+                {
+                    return;
+                }
+                m_start = (m_start + 1) % MAX_LENGTH;
+                --m_size;
+            }
+
+        private:
+            PhermoneDeposit m_quads[MAX_LENGTH];
+            size_t m_start;
+            size_t m_size;
+            size_t m_length;
+        };
+    }
+}
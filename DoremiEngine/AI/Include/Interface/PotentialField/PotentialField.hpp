@@ -77,6 +77,17 @@ namespace DoremiEngine
             */
             virtual void RemoveActor(PotentialFieldActor* p_newActor) = 0;
 
+            /**
+            Adds phermone to the given quad and the quad to the phermonetrail of the actor. Phermone lowers the charge of the quad for actors
+            using phermonetrails until it has decayed or the quad falls off the end of the trail, whichever comes first
+            */
+            virtual void AddPhermone(const DirectX::XMINT2& p_quad, PotentialFieldActor& p_actor) = 0;
+
+            /**
+            Decays the phermone of every quad in the field, should be called once per update
+            */
+            virtual void UpdatePhermones(const float& p_dt) = 0;
+
             /**
             Returns the position of the gridpoint the given units position is most attracted to. If a actor is given the charge given by that actor
             will be ignored. If the static check flag is set to true the function will use the stored value in the potential field, if set to false
@@ -1,4 +1,5 @@
 #pragma once
+#include <Interface/PotentialField/PhermoneTrail.hpp>
 #include <DirectXMath.h>
 #include <vector>
 #include <functional>
@@ -98,9 +99,9 @@ namespace DoremiEngine
             */
             virtual const DirectX::XMINT2 GetClosestOccupied(const DirectX::XMINT2& p_quad) = 0;
             /**
-            Returns the phermonetrail vector.
+            Returns the phermonetrail, the last quads the actor has visited.
             */
-            virtual const std::vector<DirectX::XMINT2>& GetPhermoneTrail() const = 0;
+            virtual const PhermoneTrail& GetPhermoneTrail() const = 0;
             /**
             Returns last updates GridPos.
             */
@@ -110,14 +111,19 @@ namespace DoremiEngine
             */
             virtual void SetPrevGridPosition(const DirectX::XMINT2& p_prevGridPos) = 0;
             /**
-            If the vector.size is more than 5 we remove the last one and add the new one. Otherwise we just add the gridpos.
+            Adds the gridpos to the phermonetrail. If the trail is full the oldest gridpos is removed and copied to o_dropped,
+            returns true if a gridpos was removed. Used by PotentialField::AddPhermone
             */
-            virtual void UpdatePhermoneTrail(const DirectX::XMINT2& p_gridPosToAdd) = 0;
+            virtual bool UpdatePhermoneTrail(const PhermoneDeposit& p_gridPosToAdd, PhermoneDeposit& o_dropped) = 0;
             /**
-            Erase the first([0]) element in the phermone list!
+            Erase the oldest element in the phermone trail!
             */
             virtual void EraseLatestAddedToPhermoneList() = 0;
             /**
+            Sets how many gridpositions the phermonetrail remembers, at most PhermoneTrail::MAX_LENGTH
+            */
+            virtual void SetPhermoneTrailLength(const size_t& p_length) = 0;
+            /**
             Adds a new potential to be used when checking vs other actors. This is what makes ranged stay on range and melee go to melee.
             If a actor contains one of these fields it will be used when checking vs other actors. For example a range unit might contain a
             potential which will only be used when checking against positive charges. This will make the enemy move against the player since
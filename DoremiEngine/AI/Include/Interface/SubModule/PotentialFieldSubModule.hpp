@@ -73,6 +73,11 @@ namespace DoremiEngine
             */
             virtual void AddActorToEveryPotentialField(PotentialFieldActor* p_actor) = 0;
 
+            /**
+            Decays the phermones of every field, should be called once per update
+            */
+            virtual void UpdatePhermones(const float& p_dt) = 0;
+
             /**
             Returns a vector with pointers to all active fields.
             */
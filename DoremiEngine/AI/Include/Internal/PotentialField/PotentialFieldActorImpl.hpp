@@ -25,12 +25,13 @@ namespace DoremiEngine
             const std::vector<DirectX::XMINT2>& GetOccupiedQuads() const override { return m_occupiedQuads; };
             const bool& IsStatic() const override { return m_static; };
             const DirectX::XMINT2 GetClosestOccupied(const DirectX::XMINT2& p_quad);
-            const std::vector<DirectX::XMINT2>& GetPhermoneTrail() const override { return m_phermoneTrail; };
+            const PhermoneTrail& GetPhermoneTrail() const override { return m_phermoneTrail; };
             const DirectX::XMINT2 GetPrevGridPos() const override { return m_prevGridPos; };
             /*const DirectX::XMINT2 GetGridPos() const override { return m_gridPos; };*/
             void SetPrevGridPosition(const DirectX::XMINT2& p_prevGridPos) override { m_prevGridPos = p_prevGridPos; };
-            void UpdatePhermoneTrail(const DirectX::XMINT2& p_gridPosToAdd) override;
+            bool UpdatePhermoneTrail(const PhermoneDeposit& p_gridPosToAdd, PhermoneDeposit& o_dropped) override;
             void EraseLatestAddedToPhermoneList() override;
+            void SetPhermoneTrailLength(const size_t& p_length) override { m_phermoneTrail.SetLength(p_length); };
             void AddPotentialVsOther(const PotentialChargeInformation& p_newPotential) override;
             virtual const std::vector<PotentialChargeInformation>& GetPotentialVsOthers() const { return m_potentialsVsOther; };
             void SetActivePotentialVsType(const AIActorType& p_type, bool p_active) override;
@@ -39,7 +40,7 @@ namespace DoremiEngine
             const DirectX::XMFLOAT3& GetWantedPosition() const override { return m_wantedPosition; };
             void SetWantedPosition(const DirectX::XMFLOAT3& p_wantedPosition) override { m_wantedPosition = p_wantedPosition; };
         private:
-            std::vector<DirectX::XMINT2> m_phermoneTrail;
+            PhermoneTrail m_phermoneTrail;
             std::vector<DirectX::XMINT2> m_occupiedQuads; // TODOKO review if it should be set to enable checking for duplicates
             std::vector<PotentialChargeInformation> m_potentialsVsOther;
             float m_range;
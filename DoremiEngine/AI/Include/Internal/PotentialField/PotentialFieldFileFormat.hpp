@@ -0,0 +1,77 @@
+#pragma once
+#include <Interface/PotentialField/PotentialField.hpp>
+
+#include <DirectXMath.h>
+#include <cstdint>
+#include <cstddef>
+namespace DoremiEngine
+{
+    namespace AI
+    {
+        // "DRPF" in little endian
+        const uint32_t POTENTIAL_FIELD_FILE_MAGIC = 0x46505244;
+        // Increase whenever the layout of the header or PotentialFieldGridPoint changes, old files are then rebuilt on load
+        const uint32_t POTENTIAL_FIELD_FILE_VERSION = 1;
+        // Where the grid starts in the file, keeps the grid aligned when the file is mapped into memory
+        const uint32_t POTENTIAL_FIELD_FILE_GRID_OFFSET = 64;
+
+        /**
+        Header of a .drmpf file. The grid follows at gridOffset, stored exactly as it is in memory so the file can be mapped
+        and the grid used in place without any copying
+        */
+        struct PotentialFieldFileHeader
+        {
+            uint32_t magic;
+            uint32_t version;
+            // sizeof(PotentialFieldGridPoint) when the file was saved
+            uint32_t gridPointSize;
+            uint32_t gridOffset;
+            DirectX::XMFLOAT3 center;
+            float width;
+            float height;
+            int32_t quadsX;
+            int32_t quadsZ;
+            uint32_t gridChecksum;
+        };
+        static_assert(sizeof(PotentialFieldFileHeader) <= POTENTIAL_FIELD_FILE_GRID_OFFSET, "Potential field file header overlaps the grid");
+
+        /**
+        FNV-1a hash of the given memory, used as checksum of the grid
+        */
+        inline uint32_t CalculatePotentialFieldChecksum(const void* p_data, const size_t& p_size)
+        {
+            const uint8_t* data = static_cast<const uint8_t*>(p_data);
+            uint32_t hash = 2166136261u;
+            for(size_t i = 0; i < p_size; ++i)
+            {
+                hash ^= data[i];
+                hash *= 16777619u;
+            }
+            return hash;
+        }
+
+        /**
+        Checks that the mapped file is a potential field file of the current version and that the grid is intact
+        */
+        inline bool ValidatePotentialFieldFile(const void* p_memory, const size_t& p_size)
+        {
+            if(p_size < sizeof(PotentialFieldFileHeader))
+            {
+                return false;
+            }
+            const PotentialFieldFileHeader& header = *static_cast<const PotentialFieldFileHeader*>(p_memory);
+            if(header.magic != POTENTIAL_FIELD_FILE_MAGIC || header.version != POTENTIAL_FIELD_FILE_VERSION ||
+               header.gridPointSize != sizeof(PotentialFieldGridPoint) || header.quadsX <= 0 || header.quadsZ <= 0)
+            {
+                return false;
+            }
+            const size_t gridSize = sizeof(PotentialFieldGridPoint) * static_cast<size_t>(header.quadsX) * static_cast<size_t>(header.quadsZ);
+            if(header.gridOffset < sizeof(PotentialFieldFileHeader) || header.gridOffset + gridSize > p_size)
+            {
+                return false;
+            }
+            const uint8_t* grid = static_cast<const uint8_t*>(p_memory) + header.gridOffset;
+            return CalculatePotentialFieldChecksum(grid, gridSize) == header.gridChecksum;
+        }
+    }
+}
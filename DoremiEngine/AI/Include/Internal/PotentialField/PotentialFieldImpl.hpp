@@ -3,6 +3,17 @@
 #include <Internal/AIContext.hpp>
 
 #include <set>
+#include <vector>
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace IO
+        {
+            class MappedFile;
+        }
+    }
+}
 namespace DoremiEngine
 {
     namespace AI
@@ -17,11 +28,7 @@ namespace DoremiEngine
             void SetWidth(const float& p_width) override { m_width = p_width; };
             void SetCenter(const DirectX::XMFLOAT3& p_center) override { m_center = p_center; };
             void SetQuadSize(const DirectX::XMFLOAT2& p_quadSize) override { m_quadSize = p_quadSize; };
-            void SetNumberOfQuads(const int& p_numberOfQuadsWidth, const int& p_numberOfQuadsHeight) override
-            {
-                m_numberOfQuadsHeight = p_numberOfQuadsHeight;
-                m_numberOfQuadsWidth = p_numberOfQuadsWidth;
-            };
+            void SetNumberOfQuads(const int& p_numberOfQuadsWidth, const int& p_numberOfQuadsHeight) override;
             void SetName(const std::string& p_name) override { m_name = p_name; };
             const std::string& GetName() const override { return m_name; };
             void SetNeedUpdating(const bool& p_needsUpdating) override { m_needsUpdate = p_needsUpdating; };
@@ -32,6 +39,8 @@ namespace DoremiEngine
             void Update() override;
             void AddActor(PotentialFieldActor* p_newActor) override;
             void RemoveActor(PotentialFieldActor* p_newActor) override;
+            void AddPhermone(const DirectX::XMINT2& p_quad, PotentialFieldActor& p_actor) override;
+            void UpdatePhermones(const float& p_dt) override;
             DirectX::XMINT2 WhatGridPosAmIOn(const DirectX::XMFLOAT3& p_unitPosition);
             DirectX::XMFLOAT3 GetAttractionPosition(const DirectX::XMFLOAT3& p_unitPosition, bool& p_inField, bool& p_goalInRange, bool& p_shouldJump,
                                                     PotentialFieldActor* p_currentActor = nullptr, const bool& p_staticCheck = true) override;
@@ -42,16 +51,25 @@ namespace DoremiEngine
 
             // Not in interface
             float CalculateCharge(int p_quadX, int p_quadY, const PotentialFieldActor* p_currentActor);
+            /**
+            Gives the field ownership of the file its grid is mapped from. The file is unmapped when the field is deleted
+            */
+            void SetMappedFile(Doremi::Utilities::IO::MappedFile* p_mappedFile) { m_mappedFile = p_mappedFile; }
 
         private:
             // Help functions
             void AttemptJumpToNewField(const DirectX::XMFLOAT3& p_position, float& o_charge, DirectX::XMFLOAT3& o_newPosition);
+            /**
+            Removes what is left of a deposit from its quad, used when the quad falls off the end of a phermonetrail
+            */
+            void RemovePhermone(const PhermoneDeposit& p_deposit);
 
             bool AnyPositiveGoalInRange(const DirectX::XMFLOAT3& p_position);
             float GetChargeInfluenceFromActor(const DirectX::XMFLOAT2& p_position, const PotentialFieldActor& p_actor);
             float GetSpecialInfluenceBetweenActors(const DirectX::XMFLOAT2& p_position, const PotentialFieldActor& p_actorToCheck,
                                                    const PotentialFieldActor& p_yourActor, bool& o_phermoneActive);
             PotentialFieldGridPoint* m_grid; // [width][height]
+            Doremi::Utilities::IO::MappedFile* m_mappedFile; // nullptr unless the grid was loaded from file
             std::set<PotentialFieldActor*> m_staticActors; // set for fast check if actor already recides in list
             std::vector<PotentialFieldActor*> m_dynamicActors; // vector for fast access through the list
             float m_width;
@@ -60,7 +78,10 @@ namespace DoremiEngine
             DirectX::XMFLOAT3 m_center;
             int m_numberOfQuadsWidth; // x
             int m_numberOfQuadsHeight; // z
-            float m_phermoneEffect;
+            float m_phermoneEffect; // How much phermone is added when an actor enters a quad
+            float m_phermoneDecay; // How much of the phermone is left after one second
+            double m_phermoneTime; // Seconds of decay since the field was created, deposits are stamped with it
+            std::vector<float> m_phermoneGrid; // [width][height], same layout as m_grid
             AIContext& m_context;
             float m_stepDistance;
 
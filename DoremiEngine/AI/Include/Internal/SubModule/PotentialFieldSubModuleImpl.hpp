@@ -23,6 +23,7 @@ namespace DoremiEngine
             void EraseActor(PotentialFieldActor* op_actor, PotentialField* op_field) override;
             PotentialField* FindBestPotentialField(const DirectX::XMFLOAT3& p_position) override;
             void AddActorToEveryPotentialField(PotentialFieldActor* p_actor) override;
+            void UpdatePhermones(const float& p_dt) override;
             std::vector<PotentialField*>& GetAllActiveFields() override { return m_fields; };
         private:
             std::vector<PotentialField*> m_fields;
@@ -54,20 +54,12 @@ namespace DoremiEngine
             return returnQuad;
         }
 
-        void PotentialFieldActorImpl::UpdatePhermoneTrail(const DirectX::XMINT2& p_gridPosToAdd)
+        bool PotentialFieldActorImpl::UpdatePhermoneTrail(const PhermoneDeposit& p_gridPosToAdd, PhermoneDeposit& o_dropped)
         {
-            int vectorSize = m_phermoneTrail.size();
-            // if it is greater than 10 we remove the last before we add this one
-            // TODOCONFIG HRDKODAT VRDE ATT DET R en trail p 10
-
-            if(vectorSize >= 15)
-            {
-                m_phermoneTrail.erase(m_phermoneTrail.begin());
-            }
-
-            m_phermoneTrail.push_back(p_gridPosToAdd);
+            // The trail drops the oldest position by itself when it's full
+            return m_phermoneTrail.Push(p_gridPosToAdd, o_dropped);
         }
-        void PotentialFieldActorImpl::EraseLatestAddedToPhermoneList() { m_phermoneTrail.erase(m_phermoneTrail.begin()); }
+        void PotentialFieldActorImpl::EraseLatestAddedToPhermoneList() { m_phermoneTrail.PopOldest(); }
         void PotentialFieldActorImpl::AddPotentialVsOther(const PotentialChargeInformation& p_newPotential)
         {
             m_potentialsVsOther.push_back(p_newPotential);
@@ -5,23 +5,36 @@
 // Config module
 #include <DoremiEngine/Configuration/Include/ConfigurationModule.hpp>
 
+// Utilities
+#include <Utility/Utilities/Include/IO/MappedFile/MappedFile.hpp>
+
 #include <iostream>
+#include <algorithm>
+#include <cmath>
 
 
 namespace DoremiEngine
 {
     namespace AI
     {
-        PotentialFieldImpl::PotentialFieldImpl(AIContext& p_aiContext) : m_phermoneEffect(15), m_context(p_aiContext)
+        PotentialFieldImpl::PotentialFieldImpl(AIContext& p_aiContext)
+            : m_mappedFile(nullptr), m_phermoneEffect(15), m_phermoneTime(0), m_context(p_aiContext)
         {
             m_stepDistance = m_context.config.GetAllConfigurationValues().AIJumpDistance;
+            m_phermoneDecay = m_context.config.GetAllConfigurationValues().AIPhermoneDecay;
         }
-        PotentialFieldImpl::~PotentialFieldImpl() {}
+        PotentialFieldImpl::~PotentialFieldImpl() { delete m_mappedFile; }
         void PotentialFieldImpl::SetGrid(PotentialFieldGridPoint* p_grid)
         {
             // m_grid = p_grid;
             m_grid = p_grid;
         }
+        void PotentialFieldImpl::SetNumberOfQuads(const int& p_numberOfQuadsWidth, const int& p_numberOfQuadsHeight)
+        {
+            m_numberOfQuadsHeight = p_numberOfQuadsHeight;
+            m_numberOfQuadsWidth = p_numberOfQuadsWidth;
+            m_phermoneGrid.assign(static_cast<size_t>(p_numberOfQuadsWidth) * static_cast<size_t>(p_numberOfQuadsHeight), 0.0f);
+        }
         void PotentialFieldImpl::Update()
         {
             // TODOKO optimize!!!! threads would be awesome here...
@@ -173,20 +186,22 @@ namespace DoremiEngine
             int quadNrX = static_cast<int>(std::floor(position2D.x / gridQuadWidth)); // What quad in x and y
             int quadNrY = static_cast<int>(std::floor(position2D.y / gridQuadHeight));
 
-            // Add quads that needs checking, 3x3 square around the unit
-            std::vector<XMINT2> quadsToCheck;
+            // Add quads that needs checking, 3x3 square around the unit. Always 8 so they are kept on the stack
+            XMINT2 quadsToCheck[8];
+            size_t length = 0;
             for(int x = -1; x < 2; x++) // -1, 0, 1
             {
                 for(int y = -1; y < 2; y++)
                 {
-                    quadsToCheck.push_back(XMINT2(quadNrX + x, quadNrY + y));
+                    // Skip the quad we are standing on since that one is our start value we dont need to check it again
+                    if(x != 0 || y != 0)
+                    {
+                        quadsToCheck[length++] = XMINT2(quadNrX + x, quadNrY + y);
+                    }
                 }
             }
-            // Remove the quad we are standing on since that one is our start value we dont need to check it again
-            quadsToCheck.erase(quadsToCheck.begin() + 4);
 
             // Check for special cases
-            size_t length = quadsToCheck.size();
             XMFLOAT3 highestChargedPos = m_center; // if we are outside the field we should walk to center
             float highestCharge = 0;
             if(quadNrX >= 0 && quadNrX < m_numberOfQuadsWidth && quadNrY >= 0 && quadNrY < m_numberOfQuadsHeight)
@@ -327,31 +342,60 @@ namespace DoremiEngine
             // Only do the phermonetrail thingie if we have a actor
             if(p_currentActor != nullptr && usePhermone && p_currentActor->GetUsePhermonetrail())
             {
-                // Going through the phermone trail and adding them to the corresponding gridpos.
-                std::vector<XMINT2> phermoneVector = p_currentActor->GetPhermoneTrail();
-                size_t t_vecSize = phermoneVector.size();
-                for(size_t i = 0; i < t_vecSize; ++i)
-                {
-                    // Create a smal charge on the phermone position
-                    XMFLOAT3 phermonePos3d = GetGridQuadPosition(phermoneVector[i].x, phermoneVector[i].y);
-                    XMFLOAT2 phermonePos = XMFLOAT2(phermonePos3d.x, phermonePos3d.z);
-                    XMVECTOR phermonePosVec = XMLoadFloat2(&phermonePos);
-                    XMVECTOR quadPosVec = XMLoadFloat2(&quadPos);
-
-                    // Get the distance
-                    XMVECTOR distance = phermonePosVec - quadPosVec;
-                    XMVECTOR quadSize = XMLoadFloat2(&m_quadSize);
-                    float quadLength = *XMVector2Length(quadSize).m128_f32; // Sort of quad length, from center to corner
-                    float dist = *XMVector3Length(distance).m128_f32;
-                    float force = 0;
-                    force = -(m_phermoneEffect + i) *
-                            std::fmaxf(1.0f - dist / quadLength * 2, 0.0f); // the phermone will effect all quads around the phemoned quad
-                    totalCharge += force;
-                }
+                // The phermone of every actor's trail is already summed up in the phermone grid
+                totalCharge -= m_phermoneGrid[p_quadX + p_quadY * m_numberOfQuadsWidth];
             }
 
             return totalCharge + m_grid[p_quadX + p_quadY * m_numberOfQuadsWidth].charge;
         }
+
+        void PotentialFieldImpl::AddPhermone(const DirectX::XMINT2& p_quad, PotentialFieldActor& p_actor)
+        {
+            if(p_quad.x < 0 || p_quad.x >= m_numberOfQuadsWidth || p_quad.y < 0 || p_quad.y >= m_numberOfQuadsHeight)
+            {
+                return;
+            }
+            m_phermoneGrid[p_quad.x + p_quad.y * m_numberOfQuadsWidth] += m_phermoneEffect;
+
+            // The trail length decides how many quads the actor keeps marked, the oldest stops counting when it falls off the trail.
+            // Deposits in other fields are left to decay, the actor has changed field since
+            PhermoneDeposit dropped;
+            if(p_actor.UpdatePhermoneTrail(PhermoneDeposit(p_quad, m_phermoneTime, this), dropped) && dropped.field == this)
+            {
+                RemovePhermone(dropped);
+            }
+        }
+
+        void PotentialFieldImpl::RemovePhermone(const PhermoneDeposit& p_deposit)
+        {
+            float& phermone = m_phermoneGrid[p_deposit.quad.x + p_deposit.quad.y * m_numberOfQuadsWidth];
+            const float left = m_phermoneEffect * static_cast<float>(std::pow(static_cast<double>(m_phermoneDecay), m_phermoneTime - p_deposit.time));
+            phermone = std::max(phermone - left, 0.0f);
+        }
+
+        void PotentialFieldImpl::UpdatePhermones(const float& p_dt)
+        {
+            using namespace DirectX;
+            // Exponential decay, m_phermoneDecay is what's left after one second
+            const float decay = std::pow(m_phermoneDecay, p_dt);
+            m_phermoneTime += p_dt;
+            const XMVECTOR decayVec = XMVectorReplicate(decay);
+            const size_t length = m_phermoneGrid.size();
+            float* phermones = m_phermoneGrid.data();
+
+            // Four quads at a time, then the ones that are left
+            size_t i = 0;
+            for(; i + 4 <= length; i += 4)
+            {
+                XMFLOAT4* quads = reinterpret_cast<XMFLOAT4*>(phermones + i);
+                XMStoreFloat4(quads, XMVectorMultiply(XMLoadFloat4(quads), decayVec));
+            }
+            for(; i < length; ++i)
+            {
+                phermones[i] *= decay;
+            }
+        }
+
         bool PotentialFieldImpl::AnyPositiveGoalInRange(const DirectX::XMFLOAT3& p_position)
         {
             using namespace DirectX;
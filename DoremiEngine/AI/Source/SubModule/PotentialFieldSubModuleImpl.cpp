@@ -3,6 +3,9 @@
 #include <Internal/PotentialField/PotentialFieldImpl.hpp>
 #include <Internal/PotentialField/PotentialGroupImpl.hpp>
 #include <Internal/PotentialField/PotentialFieldActorImpl.hpp>
+#include <Internal/PotentialField/PotentialFieldFileFormat.hpp>
+#include <Utility/Utilities/Include/IO/MappedFile/MappedFile.hpp>
+#include <DoremiEngine/Configuration/Include/ConfigurationModule.hpp>
 
 #include <iostream>
 #include <fstream>
@@ -68,48 +71,39 @@ namespace DoremiEngine
                 fixedFileName.erase(std::remove(fixedFileName.begin(), fixedFileName.end(), charsToRemove[i]), fixedFileName.end());
             }
 
-            // Change the file name and then open the file
+            // Change the file name and then map the file. The grid is used straight from the mapped memory without copying it
             string fullFileName = m_context.WorkingDirectory + "PotentialFields/" + fixedFileName + ".drmpf";
-            ifstream file(fullFileName, ofstream::in | ofstream::binary);
-            if(!file.is_open())
+            Doremi::Utilities::IO::MappedFile* mappedFile = new Doremi::Utilities::IO::MappedFile();
+            void* memory = mappedFile->Initialize(fullFileName);
+            if(memory == nullptr)
             {
                 // TODOKO log error, couldnt open file
+                delete mappedFile;
                 return nullptr;
             }
-            // create variable to contatin what the field gives us
-            int quadsX;
-            int quadsZ;
-
-            XMFLOAT3 center;
-
-            float width;
-            float height;
-
-            // read some one of a kind values
-            file.read((char*)&center, sizeof(XMFLOAT3));
-
-            file.read((char*)&width, sizeof(float));
-            file.read((char*)&height, sizeof(float));
-
-            // Save down nubmer of quads in x and z so we know how many to read later on. Also used to calc quad size
-            file.read((char*)&quadsX, sizeof(int));
-            file.read((char*)&quadsZ, sizeof(int));
-
-            // Now that we know how many quads there is allocate some memory
-            PotentialFieldGridPoint* grid = (PotentialFieldGridPoint*)malloc(sizeof(PotentialFieldGridPoint) * quadsX * quadsZ);
-
-            // Now we save down every quad in the grid
-            file.read((char*)grid, sizeof(PotentialFieldGridPoint) * quadsX * quadsZ);
-            // Everything we need is saved, close file
-            file.close();
+            // Files of an older version or broken files are treated as missing, the field is then rebuilt and saved again
+            if(!ValidatePotentialFieldFile(memory, mappedFile->GetSize()))
+            {
+                std::cout << "Potential field file " << fullFileName << " is outdated or corrupt, it will be rebuilt." << std::endl;
+                delete mappedFile;
+                return nullptr;
+            }
+            const PotentialFieldFileHeader& header = *static_cast<PotentialFieldFileHeader*>(memory);
+            int quadsX = header.quadsX;
+            int quadsZ = header.quadsZ;
+            XMFLOAT3 center = header.center;
+            float width = header.width;
+            float height = header.height;
+            PotentialFieldGridPoint* grid = reinterpret_cast<PotentialFieldGridPoint*>(static_cast<char*>(memory) + header.gridOffset);
 
             // Calculate the size of a quad
             XMFLOAT2 quadSize;
 
             quadSize.x = width / static_cast<float>(quadsX);
             quadSize.y = height / static_cast<float>(quadsZ);
-            // Create a new field
-            PotentialField* newField = new PotentialFieldImpl(m_context);
+            // Create a new field, the field owns the mapped file from now on
+            PotentialFieldImpl* newField = new PotentialFieldImpl(m_context);
+            newField->SetMappedFile(mappedFile);
 
             // Save the values to the field
             newField->SetGrid(grid);
@@ -159,18 +153,28 @@ namespace DoremiEngine
                 // TODOKO log error, couldnt create file?
                 return false;
             }
-            // Save down some one of a kind values
-            file.write((char*)&center, sizeof(XMFLOAT3));
-
-            file.write((char*)&width, sizeof(float));
-            file.write((char*)&height, sizeof(float));
-
-            // Save down nubmer of quads in x and z so we know how many to read later on. Also used to calc quad size
-            file.write((char*)&quadsX, sizeof(int));
-            file.write((char*)&quadsZ, sizeof(int));
-
-            // Now we save down every quad in the grid
-            file.write((char*)grid, sizeof(PotentialFieldGridPoint) * quadsX * quadsZ);
+            // Everything the loader needs to validate and map the file goes in the header
+            const size_t gridSize = sizeof(PotentialFieldGridPoint) * quadsX * quadsZ;
+            PotentialFieldFileHeader header;
+            memset(&header, 0, sizeof(PotentialFieldFileHeader));
+            header.magic = POTENTIAL_FIELD_FILE_MAGIC;
+            header.version = POTENTIAL_FIELD_FILE_VERSION;
+            header.gridPointSize = sizeof(PotentialFieldGridPoint);
+            header.gridOffset = POTENTIAL_FIELD_FILE_GRID_OFFSET;
+            header.center = center;
+            header.width = width;
+            header.height = height;
+            header.quadsX = quadsX;
+            header.quadsZ = quadsZ;
+            header.gridChecksum = CalculatePotentialFieldChecksum(grid, gridSize);
+
+            // Pad the header up to where the grid starts
+            char headerBlock[POTENTIAL_FIELD_FILE_GRID_OFFSET] = {0};
+            memcpy(headerBlock, &header, sizeof(PotentialFieldFileHeader));
+            file.write(headerBlock, POTENTIAL_FIELD_FILE_GRID_OFFSET);
+
+            // Now we save down every quad in the grid, in the same layout as in memory
+            file.write((const char*)grid, gridSize);
 
             // Everything we need is saved, close file
             file.close();
@@ -191,6 +195,7 @@ namespace DoremiEngine
             newActor->SetCharge(p_charge);
             newActor->SetRange(p_range);
             newActor->SetActorType(p_actorType);
+            newActor->SetPhermoneTrailLength(m_context.config.GetAllConfigurationValues().AIPhermoneTrailLength);
 
             return newActor;
         }
@@ -271,5 +276,13 @@ namespace DoremiEngine
                 m_fields[i]->AddActor(p_actor);
             }
         }
+        void PotentialFieldSubModuleImpl::UpdatePhermones(const float& p_dt)
+        {
+            size_t length = m_fields.size();
+            for(size_t i = 0; i < length; i++)
+            {
+                m_fields[i]->UpdatePhermones(p_dt);
+            }
+        }
     }
 }
\ No newline at end of file
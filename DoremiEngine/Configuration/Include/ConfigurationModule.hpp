@@ -43,6 +43,8 @@ namespace DoremiEngine
             int PortServerConnected = 4050;
             std::string ServerName = "DefaultServer";
             int MaxPlayers = 16;
+            // Port on localhost where the server serves its statistics, 0 doesn't serve them
+            int StatsPort = 0;
 
 
             std::string IPToServer = "127.0.0.1";
@@ -64,6 +66,21 @@ namespace DoremiEngine
             float AIAimOffset = 0.3f;
             float MeleeEnemySpeed = 50;
             float RangedEnemySpeed = 45;
+            int AIMaxTargetUpdates = 100;
+            // AI level of detail, where each tier ends and how many updates there are between the updates of an agent in the tier
+            float AILODNearDistance = 300.0f;
+            float AILODMediumDistance = 700.0f;
+            float AILODFarDistance = 1400.0f;
+            int AILODNearInterval = 1;
+            int AILODMediumInterval = 2;
+            int AILODFarInterval = 5;
+            int AILODDistantInterval = 15;
+            // How many quads an AI remembers in its phermonetrail and how much of the phermone in a quad is left after one second
+            int AIPhermoneTrailLength = 15;
+            float AIPhermoneDecay = 0.5f;
+            // Cell size of the spatial hash for the proximity queries, and how far an entity may move before it changes cell
+            float SpatialHashCellSize = 100.0f;
+            float SpatialHashLooseMargin = 25.0f;
 
             // Player specific
             float TurnSpeed = 0.01f;
@@ -72,6 +89,40 @@ namespace DoremiEngine
             float PlayerSpeed = 45;
             float JumpPower = 1;
             bool FriendlyFire = false;
+
+            // Threading stuff
+            // Number of worker threads in the engine thread pool, 0 uses one thread less than the number of hardware threads
+            int WorkerThreadCount = 0;
+            // If the server steps physics while AI and network run, the AI then reads the transforms of the last step
+            int AsynchronousPhysics = 0;
+
+            // Physics debugging
+            // Address of a PhysX Visual Debugger to connect to at startup, empty doesn't connect
+            std::string PhysicsVisualDebuggerIP = "";
+            int PhysicsVisualDebuggerPort = 5425;
+            // "SAP" or "MBP". MBP splits the level into PhysicsBroadPhaseSubdivisions^2 regions, which scales better on large levels
+            std::string PhysicsBroadPhase = "SAP";
+            int PhysicsBroadPhaseSubdivisions = 4;
+            // 1 keeps static geometry in a static AABB tree built once when a level is loaded, 0 uses a dynamic tree like dynamic actors
+            int PhysicsStaticPruningStructure = 0;
+
+            // Profiling
+            // Seconds of timers kept for a Chrome trace, written on Ctrl+Break or a slow frame. 0 doesn't capture
+            float TraceCaptureSeconds = 0.0f;
+            // A frame longer than this many seconds writes a trace, 0 only writes on Ctrl+Break
+            float TraceSpikeThreshold = 0.05f;
+            // 1 counts allocations per timer if built with BUILD_ALLOCATION_TRACKING
+            int AllocationTracking = 0;
+            // Seconds between reports of the timers whose allocations grew the most, 0 doesn't report
+            float AllocationReportSeconds = 60.0f;
+
+            // Memory stuff
+            // 1 puts the big entity arrays and the physics scratch memory on 2 MB pages, if the system has any to give
+            int LargePages = 0;
+            // NUMA node the big entity arrays and the physics scratch memory are placed on, -1 leaves it to the system
+            int NumaNode = -1;
+            // Memory PhysX uses for temporaries during a step before it allocates, rounded up to 16 KB. 0 gives it none
+            int PhysicsScratchKilobytes = 2048;
         };
         /**
         Reads and saves configuration from file. If another module needs configuration values they can use fucntions in this class to get them.
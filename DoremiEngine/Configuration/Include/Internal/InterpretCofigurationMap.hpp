@@ -150,6 +150,54 @@ namespace DoremiEngine
             {
                 o_info.RangedEnemySpeed = std::stof(p_mapToInterpret.at("RangedEnemySpeed"));
             }
+            if(p_mapToInterpret.count("AIMaxTargetUpdates"))
+            {
+                o_info.AIMaxTargetUpdates = std::stoi(p_mapToInterpret.at("AIMaxTargetUpdates"));
+            }
+            if(p_mapToInterpret.count("AILODNearDistance"))
+            {
+                o_info.AILODNearDistance = std::stof(p_mapToInterpret.at("AILODNearDistance"));
+            }
+            if(p_mapToInterpret.count("AILODMediumDistance"))
+            {
+                o_info.AILODMediumDistance = std::stof(p_mapToInterpret.at("AILODMediumDistance"));
+            }
+            if(p_mapToInterpret.count("AILODFarDistance"))
+            {
+                o_info.AILODFarDistance = std::stof(p_mapToInterpret.at("AILODFarDistance"));
+            }
+            if(p_mapToInterpret.count("AILODNearInterval"))
+            {
+                o_info.AILODNearInterval = std::stoi(p_mapToInterpret.at("AILODNearInterval"));
+            }
+            if(p_mapToInterpret.count("AILODMediumInterval"))
+            {
+                o_info.AILODMediumInterval = std::stoi(p_mapToInterpret.at("AILODMediumInterval"));
+            }
+            if(p_mapToInterpret.count("AILODFarInterval"))
+            {
+                o_info.AILODFarInterval = std::stoi(p_mapToInterpret.at("AILODFarInterval"));
+            }
+            if(p_mapToInterpret.count("AILODDistantInterval"))
+            {
+                o_info.AILODDistantInterval = std::stoi(p_mapToInterpret.at("AILODDistantInterval"));
+            }
+            if(p_mapToInterpret.count("AIPhermoneTrailLength"))
+            {
+                o_info.AIPhermoneTrailLength = std::stoi(p_mapToInterpret.at("AIPhermoneTrailLength"));
+            }
+            if(p_mapToInterpret.count("AIPhermoneDecay"))
+            {
+                o_info.AIPhermoneDecay = std::stof(p_mapToInterpret.at("AIPhermoneDecay"));
+            }
+            if(p_mapToInterpret.count("SpatialHashCellSize"))
+            {
+                o_info.SpatialHashCellSize = std::stof(p_mapToInterpret.at("SpatialHashCellSize"));
+            }
+            if(p_mapToInterpret.count("SpatialHashLooseMargin"))
+            {
+                o_info.SpatialHashLooseMargin = std::stof(p_mapToInterpret.at("SpatialHashLooseMargin"));
+            }
             if(p_mapToInterpret.count("PlayerSpeed"))
             {
                 o_info.PlayerSpeed = std::stof(p_mapToInterpret.at("PlayerSpeed"));
@@ -170,6 +218,66 @@ namespace DoremiEngine
             {
                 o_info.AmplitudeCutOff = std::stof(p_mapToInterpret.at("AmplitudeCutOff"));
             }
+            if(p_mapToInterpret.count("WorkerThreadCount"))
+            {
+                o_info.WorkerThreadCount = std::stoi(p_mapToInterpret.at("WorkerThreadCount"));
+            }
+            if(p_mapToInterpret.count("AsynchronousPhysics"))
+            {
+                o_info.AsynchronousPhysics = std::stoi(p_mapToInterpret.at("AsynchronousPhysics"));
+            }
+            if(p_mapToInterpret.count("PhysicsVisualDebuggerIP"))
+            {
+                o_info.PhysicsVisualDebuggerIP = p_mapToInterpret.at("PhysicsVisualDebuggerIP");
+            }
+            if(p_mapToInterpret.count("PhysicsVisualDebuggerPort"))
+            {
+                o_info.PhysicsVisualDebuggerPort = std::stoi(p_mapToInterpret.at("PhysicsVisualDebuggerPort"));
+            }
+            if(p_mapToInterpret.count("PhysicsBroadPhase"))
+            {
+                o_info.PhysicsBroadPhase = p_mapToInterpret.at("PhysicsBroadPhase");
+            }
+            if(p_mapToInterpret.count("PhysicsBroadPhaseSubdivisions"))
+            {
+                o_info.PhysicsBroadPhaseSubdivisions = std::stoi(p_mapToInterpret.at("PhysicsBroadPhaseSubdivisions"));
+            }
+            if(p_mapToInterpret.count("PhysicsStaticPruningStructure"))
+            {
+                o_info.PhysicsStaticPruningStructure = std::stoi(p_mapToInterpret.at("PhysicsStaticPruningStructure"));
+            }
+            if(p_mapToInterpret.count("StatsPort"))
+            {
+                o_info.StatsPort = std::stoi(p_mapToInterpret.at("StatsPort"));
+            }
+            if(p_mapToInterpret.count("TraceCaptureSeconds"))
+            {
+                o_info.TraceCaptureSeconds = std::stof(p_mapToInterpret.at("TraceCaptureSeconds"));
+            }
+            if(p_mapToInterpret.count("TraceSpikeThreshold"))
+            {
+                o_info.TraceSpikeThreshold = std::stof(p_mapToInterpret.at("TraceSpikeThreshold"));
+            }
+            if(p_mapToInterpret.count("AllocationTracking"))
+            {
+                o_info.AllocationTracking = std::stoi(p_mapToInterpret.at("AllocationTracking"));
+            }
+            if(p_mapToInterpret.count("AllocationReportSeconds"))
+            {
+                o_info.AllocationReportSeconds = std::stof(p_mapToInterpret.at("AllocationReportSeconds"));
+            }
+            if(p_mapToInterpret.count("LargePages"))
+            {
+                o_info.LargePages = std::stoi(p_mapToInterpret.at("LargePages"));
+            }
+            if(p_mapToInterpret.count("NumaNode"))
+            {
+                o_info.NumaNode = std::stoi(p_mapToInterpret.at("NumaNode"));
+            }
+            if(p_mapToInterpret.count("PhysicsScratchKilobytes"))
+            {
+                o_info.PhysicsScratchKilobytes = std::stoi(p_mapToInterpret.at("PhysicsScratchKilobytes"));
+            }
         }
 
         static std::map<std::string, std::string> SaveConfigToMap(const ConfiguartionInfo& p_info)
@@ -211,11 +319,38 @@ namespace DoremiEngine
             returnMap["MinPitch"] = std::to_string(p_info.MinPitch);
             returnMap["MeleeEnemySpeed"] = std::to_string(p_info.MeleeEnemySpeed);
             returnMap["RangedEnemySpeed"] = std::to_string(p_info.RangedEnemySpeed);
+            returnMap["AIMaxTargetUpdates"] = std::to_string(p_info.AIMaxTargetUpdates);
+            returnMap["AILODNearDistance"] = std::to_string(p_info.AILODNearDistance);
+            returnMap["AILODMediumDistance"] = std::to_string(p_info.AILODMediumDistance);
+            returnMap["AILODFarDistance"] = std::to_string(p_info.AILODFarDistance);
+            returnMap["AILODNearInterval"] = std::to_string(p_info.AILODNearInterval);
+            returnMap["AILODMediumInterval"] = std::to_string(p_info.AILODMediumInterval);
+            returnMap["AILODFarInterval"] = std::to_string(p_info.AILODFarInterval);
+            returnMap["AILODDistantInterval"] = std::to_string(p_info.AILODDistantInterval);
+            returnMap["AIPhermoneTrailLength"] = std::to_string(p_info.AIPhermoneTrailLength);
+            returnMap["AIPhermoneDecay"] = std::to_string(p_info.AIPhermoneDecay);
+            returnMap["SpatialHashCellSize"] = std::to_string(p_info.SpatialHashCellSize);
+            returnMap["SpatialHashLooseMargin"] = std::to_string(p_info.SpatialHashLooseMargin);
             returnMap["PlayerSpeed"] = std::to_string(p_info.PlayerSpeed);
             returnMap["JumpPower"] = std::to_string(p_info.JumpPower);
             returnMap["FriendlyFire"] = std::to_string(p_info.FriendlyFire);
             returnMap["Fullscreen"] = std::to_string(p_info.Fullscreen);
             returnMap["AmplitudeCutOff"] = std::to_string(p_info.AmplitudeCutOff);
+            returnMap["WorkerThreadCount"] = std::to_string(p_info.WorkerThreadCount);
+            returnMap["AsynchronousPhysics"] = std::to_string(p_info.AsynchronousPhysics);
+            returnMap["PhysicsVisualDebuggerIP"] = p_info.PhysicsVisualDebuggerIP;
+            returnMap["PhysicsVisualDebuggerPort"] = std::to_string(p_info.PhysicsVisualDebuggerPort);
+            returnMap["PhysicsBroadPhase"] = p_info.PhysicsBroadPhase;
+            returnMap["PhysicsBroadPhaseSubdivisions"] = std::to_string(p_info.PhysicsBroadPhaseSubdivisions);
+            returnMap["PhysicsStaticPruningStructure"] = std::to_string(p_info.PhysicsStaticPruningStructure);
+            returnMap["StatsPort"] = std::to_string(p_info.StatsPort);
+            returnMap["TraceCaptureSeconds"] = std::to_string(p_info.TraceCaptureSeconds);
+            returnMap["TraceSpikeThreshold"] = std::to_string(p_info.TraceSpikeThreshold);
+            returnMap["AllocationTracking"] = std::to_string(p_info.AllocationTracking);
+            returnMap["AllocationReportSeconds"] = std::to_string(p_info.AllocationReportSeconds);
+            returnMap["LargePages"] = std::to_string(p_info.LargePages);
+            returnMap["NumaNode"] = std::to_string(p_info.NumaNode);
+            returnMap["PhysicsScratchKilobytes"] = std::to_string(p_info.PhysicsScratchKilobytes);
             return returnMap;
         }
     }
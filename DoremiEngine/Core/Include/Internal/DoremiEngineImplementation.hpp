@@ -84,6 +84,9 @@ namespace DoremiEngine
             Logging::LoggingModule* m_loggingModule;
             Configuration::ConfigurationModule* m_configurationModule;
 
+            // Thread pool shared by all modules
+            Doremi::Utilities::Threading::WorkStealingThreadPool* m_threadPool;
+
             // Logging variables
             Logging::Logger* m_logger;
 
@@ -22,7 +22,8 @@ namespace DoremiEngine
                   m_input(nullptr),
                   m_ai(nullptr),
                   m_logging(nullptr),
-                  m_configuration(nullptr)
+                  m_configuration(nullptr),
+                  m_threadPool(nullptr)
             {
             }
 
@@ -38,6 +39,7 @@ namespace DoremiEngine
             void SetAIModule(AI::AIModule* p_AIModule) { m_ai = p_AIModule; }
             void SetLoggingModule(Logging::LoggingModule* p_loggingModule) { m_logging = p_loggingModule; }
             void SetConfigurationModule(Configuration::ConfigurationModule* p_configurationModule) { m_configuration = p_configurationModule; }
+            void SetThreadPool(Doremi::Utilities::Threading::WorkStealingThreadPool* p_threadPool) { m_threadPool = p_threadPool; }
             void SetExitFunction(std::function<void()> p_function) { m_exitFunction = p_function; }
             const std::string GetWorkingDirectory() const { return m_workingDirectory; };
 
@@ -131,6 +133,15 @@ namespace DoremiEngine
                 throw std::runtime_error("Configuration module has not been initialized."); // TODOXX This cannot be used over .dll borders.
             }
 
+            Doremi::Utilities::Threading::WorkStealingThreadPool& GetThreadPool() const override
+            {
+                if(m_threadPool != nullptr)
+                {
+                    return *m_threadPool;
+                }
+                throw std::runtime_error("Thread pool has not been initialized."); // TODOXX This cannot be used over .dll borders.
+            }
+
             void RequestApplicationExit() const override
             {
                 if(m_exitFunction != nullptr)
@@ -151,6 +162,7 @@ namespace DoremiEngine
             AI::AIModule* m_ai;
             Logging::LoggingModule* m_logging;
             Configuration::ConfigurationModule* m_configuration;
+            Doremi::Utilities::Threading::WorkStealingThreadPool* m_threadPool;
             std::function<void()> m_exitFunction;
         };
     }
@@ -1,6 +1,17 @@
 #pragma once
 #include <string>
 
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace Threading
+        {
+            class WorkStealingThreadPool;
+        }
+    }
+}
+
 namespace DoremiEngine
 {
     namespace Audio
@@ -70,6 +81,10 @@ namespace DoremiEngine
             virtual AI::AIModule& GetAIModule() const = 0;
             virtual Logging::LoggingModule& GetLoggingModule() const = 0;
             virtual Configuration::ConfigurationModule& GetConfigurationModule() const = 0;
+            /**
+            Gets the thread pool shared by the engine modules and the game
+            */
+            virtual Doremi::Utilities::Threading::WorkStealingThreadPool& GetThreadPool() const = 0;
             virtual void RequestApplicationExit() const = 0;
         };
     }
@@ -11,6 +11,7 @@
 #include <DoremiEngine/Logging/Include/Logger/Logger.hpp>
 #include <DoremiEngine/Configuration/Include/ConfigurationModule.hpp>
 #include <Utility/DynamicLoader/Include/DynamicLoader.hpp>
+#include <Utility/Utilities/Include/Threading/WorkStealingThreadPool.hpp>
 
 #include <Internal/SharedContextImplementation.hpp>
 #include <Windows.h>
@@ -37,7 +38,8 @@ namespace DoremiEngine
               m_aiModule(nullptr),
               m_loggingModule(nullptr),
               m_logger(nullptr),
-              m_configurationModule(nullptr)
+              m_configurationModule(nullptr),
+              m_threadPool(nullptr)
         {
         }
 
@@ -78,6 +80,12 @@ namespace DoremiEngine
                 delete m_configurationModule;
             }
 
+            // Deleted after the modules since their jobs could still be in the pool
+            if(m_threadPool != nullptr)
+            {
+                delete m_threadPool;
+            }
+
             if(m_audioLibrary != nullptr)
             {
                 DynamicLoader::FreeSharedLibrary(m_audioLibrary);
@@ -121,6 +129,13 @@ namespace DoremiEngine
             m_sharedContext->GetConfigurationModule().ReadConfigurationValuesFromFile("Configuration.txt");
             m_sharedContext->GetConfigurationModule().ReadConfigurationValuesFromFile("AIConfiguration.txt");
 
+            // The thread pool is needed by the modules when they start
+            using namespace Doremi::Utilities::Logging;
+            const int threadCount = m_sharedContext->GetConfigurationModule().GetAllConfigurationValues().WorkerThreadCount;
+            m_threadPool = new Doremi::Utilities::Threading::WorkStealingThreadPool(threadCount > 0 ? static_cast<uint32_t>(threadCount) : 0);
+            m_sharedContext->SetThreadPool(m_threadPool);
+            m_logger->LogText(LogTag::ENGINE_CORE, LogLevel::INFO, "Started thread pool with %u worker threads", m_threadPool->GetThreadCount());
+
             AssertThatRequiredLibrariesExists();
 
             if((p_flags & EngineModuleEnum::AUDIO) == EngineModuleEnum::AUDIO)
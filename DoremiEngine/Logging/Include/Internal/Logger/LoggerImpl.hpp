@@ -1,7 +1,11 @@
 #pragma once
 #include <Logger/Logger.hpp>
+#include <atomic>
+#include <condition_variable>
 #include <map>
-#include <Utility/Utilities/Include/Memory/Circlebuffer/ArbitrarySizeCirclebuffer.hpp>
+#include <mutex>
+#include <vector>
+#include <Utility/Utilities/Include/Memory/Circlebuffer/SPSCArbitrarySizeCirclebuffer.hpp>
 #include <Utility/Utilities/Include/Logging/LogTextData.hpp>
 
 namespace Doremi
@@ -11,7 +15,6 @@ namespace Doremi
         namespace IO
         {
             class FileMap;
-            class Mutex;
         }
         namespace Logging
         {
@@ -51,16 +54,81 @@ namespace DoremiEngine
             void LogTextReal(const std::string& p_function, const uint16_t& p_line, const Doremi::Utilities::Logging::LogTag& p_tag,
                              const Doremi::Utilities::Logging::LogLevel& p_vLevel, const char* p_format, ...) override;
 
+            /**
+            The actual method called when calling LogTextFast
+            */
+            void LogBinaryReal(Doremi::Utilities::Logging::LogFormatSite& p_site, const Doremi::Utilities::Logging::LogTag& p_logTag,
+                               const Doremi::Utilities::Logging::LogLevel& p_logLevel, const void* p_arguments,
+                               const uint16_t& p_argumentSize) override;
+
+            /**
+            Keeps the schema until the forwarding thread sends it with the first record using it
+            */
+            uint32_t RegisterDataSchema(const std::string& p_name, const std::vector<Doremi::Utilities::Logging::TelemetryField>& p_fields) override;
+
+            /**
+            The actual method called when calling LogData
+            */
+            void LogDataReal(const uint32_t& p_schemaId, const void* p_values, const uint16_t& p_valueSize) override;
+
         private:
+            // Copy of a LogFormatSite kept until it has been sent to the loggerprocess
+            struct FormatSiteCopy
+            {
+                std::string function;
+                std::string format;
+                uint16_t line;
+            };
+
             void* InitializeFileMap(const std::size_t& p_size);
             std::wstring BuildLoggingProcessArgumentString();
             void StartLoggingProcess();
-            Doremi::Utilities::IO::Mutex* CreateFileMapMutex();
 
-            Doremi::Utilities::Memory::ArbitrarySizeCirclebuffer* m_localBuffer;
-            Doremi::Utilities::Memory::ArbitrarySizeCirclebuffer* m_outGoingBuffer;
+            /**
+            Returns the staging buffer of the calling thread, it is created the first time the thread logs
+            */
+            Doremi::Utilities::Memory::SPSCArbitrarySizeCirclebuffer& GetStagingBuffer();
+
+            /**
+            Puts a record in the staging buffer of the calling thread, waits while it is full
+            */
+            void Stage(const Doremi::Utilities::Memory::CircleBufferHeader& p_header, const void* p_data);
+
+            /**
+            Gives the site an id, unless another thread just did
+            */
+            void RegisterFormatSite(Doremi::Utilities::Logging::LogFormatSite& p_site);
+
+            /**
+            Wakes the forwarding thread if it sleeps
+            */
+            void WakeForwardingThread();
+
+            /**
+            Runs on the forwarding thread. Moves the records of all staging buffers to the loggerprocess
+            */
+            void ThreadWork(ThreadMetaData* p_threadMetaData);
+            void Forward(const Doremi::Utilities::Memory::CircleBufferHeader& p_header, const void* p_data);
+            void ForwardFormatSites(const uint32_t& p_siteId);
+            void ForwardDataSchemas(const uint32_t& p_schemaId);
+            void WaitForStagedMessages(const std::vector<Doremi::Utilities::Memory::SPSCArbitrarySizeCirclebuffer*>& p_stagingBuffers);
+
+            // One buffer per thread that has logged, each thread is the single producer of its own
+            std::vector<Doremi::Utilities::Memory::SPSCArbitrarySizeCirclebuffer*> m_stagingBuffers;
+            std::mutex m_stagingBuffersLock;
+            std::vector<FormatSiteCopy> m_formatSites;
+            std::mutex m_formatSitesLock;
+            std::vector<Doremi::Utilities::Logging::TelemetrySchema> m_dataSchemas;
+            std::mutex m_dataSchemasLock;
+            // Only used by the forwarding thread
+            uint32_t m_forwardedFormatSiteCount;
+            uint32_t m_forwardedDataSchemaCount;
+            std::atomic<bool> m_forwardingThreadSleeping;
+            std::mutex m_forwardingWakeupLock;
+            std::condition_variable m_forwardingWakeup;
+
+            Doremi::Utilities::Memory::SPSCArbitrarySizeCirclebuffer* m_outGoingBuffer;
             Doremi::Utilities::IO::FileMap* m_fileMap;
-            Doremi::Utilities::IO::Mutex* m_mutex;
             bool* m_applicationRunning;
             ThreadMetaData* m_threadMetaData;
             int m_uniqueId;
@@ -1,7 +1,11 @@
 #pragma once
 #include <Utility/Utilities/Include/Logging/LogTag.hpp>
 #include <Utility/Utilities/Include/Logging/LogLevel.hpp>
+#include <Utility/Utilities/Include/Logging/BinaryLogData.hpp>
+#include <Utility/Utilities/Include/Logging/TelemetryData.hpp>
+#include <Utility/Utilities/Include/Constants/LoggerConstants.hpp>
 #include <string>
+#include <vector>
 
 namespace DoremiEngine
 {
@@ -21,6 +25,58 @@ namespace DoremiEngine
             */
             virtual void LogTextReal(const std::string& p_function, const uint16_t& p_line, const Doremi::Utilities::Logging::LogTag& p_logTag,
                                      const Doremi::Utilities::Logging::LogLevel& p_logLevel, const char* p_format, ...) = 0;
+
+            /**
+                The method called when calling LogTextFast. Copies the raw arguments into a buffer of the calling thread, the
+                text is formatted by the loggerprocess. Nothing is allocated or formatted and nothing is printed to this
+                process' console. Use for text logged often, e.g. every frame or for MASS_DATA_PRINT.
+                "Logger.LogTextFast(LogTag::Level, LogLevel::Level, "formatstring %d %s", 1, name);"
+                The format string needs to be a literal.
+            */
+            template <typename... Args>
+            void LogBinary(Doremi::Utilities::Logging::LogFormatSite& p_site, const Doremi::Utilities::Logging::LogTag& p_logTag,
+                           const Doremi::Utilities::Logging::LogLevel& p_logLevel, const Args&... p_arguments)
+            {
+                char arguments[Doremi::Utilities::Constants::LONGEST_BINARY_ARGUMENTS];
+                Doremi::Utilities::Logging::BinaryArgumentWriter writer(arguments, sizeof(arguments));
+                writer.Write(p_arguments...);
+                LogBinaryReal(p_site, p_logTag, p_logLevel, arguments, writer.GetSize());
+            }
+
+            /**
+                Sends arguments written by BinaryArgumentWriter, call via LogTextFast
+            */
+            virtual void LogBinaryReal(Doremi::Utilities::Logging::LogFormatSite& p_site, const Doremi::Utilities::Logging::LogTag& p_logTag,
+                                       const Doremi::Utilities::Logging::LogLevel& p_logLevel, const void* p_arguments,
+                                       const uint16_t& p_argumentSize) = 0;
+
+            /**
+                Registers the layout of a telemetry record and returns the id to log it with. The loggerprocess writes the
+                records of every schema to a telemetry file, which TelemetryReader turns into CSV. Register once, e.g. at
+                startup, registering the same name again gives a new id.
+                "uint32_t id = Logger.RegisterDataSchema("Tick", {{"updateTime", TelemetryFieldType::DOUBLE}});"
+            */
+            virtual uint32_t RegisterDataSchema(const std::string& p_name,
+                                                const std::vector<Doremi::Utilities::Logging::TelemetryField>& p_fields) = 0;
+
+            /**
+                Logs one telemetry record. The values are given in field order and their types must match the fields,
+                e.g. a double for DOUBLE and an int32_t for INT32, records not matching their schema are dropped by the
+                loggerprocess. Timestamped here, otherwise as cheap as LogTextFast.
+                "Logger.LogData(id, updateTime);"
+            */
+            template <typename... Args> void LogData(const uint32_t& p_schemaId, const Args&... p_values)
+            {
+                char values[Doremi::Utilities::Constants::LONGEST_DATA_RECORD];
+                Doremi::Utilities::Logging::TelemetryValueWriter writer(values, sizeof(values));
+                writer.Write(p_values...);
+                LogDataReal(p_schemaId, values, writer.GetSize());
+            }
+
+            /**
+                Sends values written by TelemetryValueWriter, call via LogData
+            */
+            virtual void LogDataReal(const uint32_t& p_schemaId, const void* p_values, const uint16_t& p_valueSize) = 0;
         };
     }
 }
@@ -34,4 +90,17 @@ TODORT Add possibility to turn hack off, then this method should reference anoth
 
 */
 #define LogText(...) LogTextReal(__FUNCTION__, __LINE__, ##__VA_ARGS__)
+#endif
+
+#ifndef LogTextFast
+/*
+Same hack as LogText. Every call site gets a static LogFormatSite, so only its id is sent with the arguments.
+*/
+#define LogTextFast(p_logTag, p_logLevel, p_format, ...)                                                                                             \
+    LogBinary(                                                                                                                                       \
+        [](const char* p_function) -> Doremi::Utilities::Logging::LogFormatSite& {                                                                   \
+            static Doremi::Utilities::Logging::LogFormatSite site(p_function, __LINE__, p_format);                                                   \
+            return site;                                                                                                                             \
+        }(__FUNCTION__),                                                                                                                             \
+        p_logTag, p_logLevel, ##__VA_ARGS__)
 #endif
\ No newline at end of file
@@ -6,6 +6,8 @@
 #include <Utility/Utilities/Include/Logging/LogTagConverter.hpp>
 #include <Utility/Utilities/Include/Logging/HelpFunctions.hpp>
 #include <Utility/Utilities/Include/IO/FileMap/FileMap.hpp>
+#include <Utility/Utilities/Include/Logging/BinaryLogData.hpp>
+#include <Utility/Utilities/Include/Logging/TelemetryData.hpp>
 
 #include <Utility/Utilities/Include/String/VA_ListToString.hpp>
 #include <Utility/Utilities/Include/String/StringHelper.hpp>
@@ -14,6 +16,7 @@
 #include <iostream>
 #include <algorithm>
 #include <chrono>
+#include <new>
 #include <Windows.h>
 
 namespace DoremiEngine
@@ -40,10 +43,29 @@ namespace DoremiEngine
         using namespace Doremi::Utilities;
         using namespace Doremi::Utilities::Logging;
 
-        void ThreadWork(ThreadMetaData* p_threadMetaData, Memory::ArbitrarySizeCirclebuffer* p_localBuffer, Memory::ArbitrarySizeCirclebuffer* m_outGoingBuffer);
+        namespace
+        {
+            // Staging buffer of the calling thread and the logger it belongs to
+            struct ThreadStagingBuffer
+            {
+                const LoggerImpl* logger;
+                Memory::SPSCArbitrarySizeCirclebuffer* buffer;
+            };
+            thread_local ThreadStagingBuffer t_stagingBuffer = {nullptr, nullptr};
+
+            // Reused by LogTextReal so it only allocates when a message is longer than any before on the thread
+            thread_local std::string t_message;
+            thread_local std::vector<char> t_textRecord;
+        }
 
         LoggerImpl::LoggerImpl()
-            : m_localBuffer(nullptr), m_outGoingBuffer(nullptr), m_fileMap(nullptr), m_mutex(nullptr), m_applicationRunning(nullptr), m_threadMetaData(nullptr)
+            : m_forwardedFormatSiteCount(0),
+              m_forwardedDataSchemaCount(0),
+              m_forwardingThreadSleeping(false),
+              m_outGoingBuffer(nullptr),
+              m_fileMap(nullptr),
+              m_applicationRunning(nullptr),
+              m_threadMetaData(nullptr)
         {
 #ifdef NO_LOGGER
             return;
@@ -62,6 +84,10 @@ namespace DoremiEngine
                 if(m_threadMetaData != nullptr)
                 {
                     *m_applicationRunning = false;
+                    {
+                        std::lock_guard<std::mutex> lock(m_forwardingWakeupLock);
+                        m_forwardingWakeup.notify_one();
+                    }
                     while(*m_threadMetaData->isThreadStillRunning == true)
                     {
                         using namespace std::literals;
@@ -75,9 +101,11 @@ namespace DoremiEngine
             }
 
             delete m_fileMap;
-            delete m_localBuffer;
+            for(auto& stagingBuffer : m_stagingBuffers)
+            {
+                delete stagingBuffer;
+            }
             delete m_outGoingBuffer;
-            delete m_mutex;
             delete m_threadMetaData;
             delete m_applicationRunning;
         }
@@ -87,25 +115,17 @@ namespace DoremiEngine
 #ifdef NO_LOGGER
             return;
 #endif
-            m_localBuffer = new Memory::ArbitrarySizeCirclebuffer();
-            m_outGoingBuffer = new Memory::ArbitrarySizeCirclebuffer();
-
-            // TODOXX TODORT our hardcode better value from empirical tests
-            // Create localbuffer
-            m_localBuffer->Initialize(10000);
-
-            // Create mutex
-            m_mutex = CreateFileMapMutex();
+            m_outGoingBuffer = new Memory::SPSCArbitrarySizeCirclebuffer();
 
             // Fetch shared memory from fileMap
             void* fileMapMemory = InitializeFileMap(Constants::IPC_FILEMAP_SIZE);
 
-            // Intiailize outgoing buffer with shared memory and mutex
-            m_outGoingBuffer->Initialize(fileMapMemory, Constants::IPC_FILEMAP_SIZE, m_mutex);
+            // Intiailize outgoing buffer with shared memory, the loggerprocess isn't started yet so this side resets it
+            m_outGoingBuffer->Initialize(fileMapMemory, Constants::IPC_FILEMAP_SIZE, true, Logging::BuildFileMapWakeupName(m_uniqueId));
             m_applicationRunning = new bool(true);
 
             m_threadMetaData = new ThreadMetaData(m_applicationRunning, new bool(true));
-            std::thread outGoingLoggingThread(ThreadWork, m_threadMetaData, m_localBuffer, m_outGoingBuffer);
+            std::thread outGoingLoggingThread(&LoggerImpl::ThreadWork, this, m_threadMetaData);
             outGoingLoggingThread.detach();
             StartLoggingProcess();
         }
@@ -120,25 +140,29 @@ namespace DoremiEngine
             va_start(args, p_format);
             if(p_logLevel != LogLevel::MASS_DATA_PRINT)
             {
+                // vprintf uses up its va_list, the message is built from the arguments again below
+                va_list printArgs;
+                va_copy(printArgs, args);
                 printf("[%s:%s] ", LogTagConverter::convert(p_logTag).name.c_str(), LogLevelConverter::convert(p_logLevel).name.c_str());
-                vprintf(p_format, args);
+                vprintf(p_format, printArgs);
                 printf("\n");
+                va_end(printArgs);
             }
 #ifdef NO_LOGGER
             va_end(args);
             return;
 #endif
-            std::string message;
+            std::string& message = t_message;
             String::toString(message, p_format, args);
             va_end(args);
 
-            // Allocate buffer
+            // Size buffer
             const uint16_t functionSize = p_function.size() + 1; // The plus one comes as the null terminator
             const uint16_t messageSize = message.size() + 1; // The plus one comes as the null terminator
             const uint32_t bufferSize = functionSize + messageSize + sizeof(TextMetaData);
 
-            void* buffer = malloc(bufferSize); // TODORT only use one buffer and lock this buffer
-            memset(buffer, 0, bufferSize); // Do not remove this, used to get null terminator in the strings
+            t_textRecord.assign(bufferSize, 0); // Do not remove the zeroing, used to get null terminator in the strings
+            void* buffer = t_textRecord.data();
             char* charBuffer = static_cast<char*>(buffer);
 
             // Write textmetadata
@@ -157,45 +181,126 @@ namespace DoremiEngine
             Memory::CircleBufferHeader header;
             header.packageSize = bufferSize;
             header.packageType = CircleBufferType(CircleBufferTypeEnum::TEXT);
-            bool succeed = false;
+            Stage(header, buffer);
+        }
 
-            while(!succeed)
+        void LoggerImpl::LogBinaryReal(LogFormatSite& p_site, const LogTag& p_logTag, const LogLevel& p_logLevel, const void* p_arguments,
+                                       const uint16_t& p_argumentSize)
+        {
+#ifdef NO_LOGGER
+            return;
+#endif
+            if(p_site.id.load(std::memory_order_acquire) == 0)
             {
-                succeed = m_localBuffer->Produce(header, buffer);
-                if(!succeed)
+                RegisterFormatSite(p_site);
+            }
+
+            // Site id and the arguments as they are, the loggerprocess formats them
+            char record[sizeof(BinaryTextMetaData) + Constants::LONGEST_BINARY_ARGUMENTS];
+            new(record) BinaryTextMetaData(p_site.id.load(std::memory_order_relaxed), p_logTag, p_logLevel, p_argumentSize);
+            memcpy(record + sizeof(BinaryTextMetaData), p_arguments, p_argumentSize);
+
+            Memory::CircleBufferHeader header;
+            header.packageSize = sizeof(BinaryTextMetaData) + p_argumentSize;
+            header.packageType = Memory::CircleBufferType(Memory::CircleBufferTypeEnum::BINARY_TEXT);
+            Stage(header, record);
+        }
+
+        uint32_t LoggerImpl::RegisterDataSchema(const std::string& p_name, const std::vector<TelemetryField>& p_fields)
+        {
+            std::lock_guard<std::mutex> lock(m_dataSchemasLock);
+            TelemetrySchema schema;
+            // Ids start at one like format sites
+            schema.id = static_cast<uint32_t>(m_dataSchemas.size() + 1);
+            schema.name = p_name;
+            schema.fields = p_fields;
+            m_dataSchemas.push_back(schema);
+            return schema.id;
+        }
+
+        void LoggerImpl::LogDataReal(const uint32_t& p_schemaId, const void* p_values, const uint16_t& p_valueSize)
+        {
+#ifdef NO_LOGGER
+            return;
+#endif
+            using namespace std::chrono;
+            const uint64_t timestamp = duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+
+            char record[sizeof(DataMetaData) + Constants::LONGEST_DATA_RECORD];
+            new(record) DataMetaData(timestamp, p_schemaId, p_valueSize);
+            memcpy(record + sizeof(DataMetaData), p_values, p_valueSize);
+
+            Memory::CircleBufferHeader header;
+            header.packageSize = sizeof(DataMetaData) + p_valueSize;
+            header.packageType = Memory::CircleBufferType(Memory::CircleBufferTypeEnum::DATA);
+            Stage(header, record);
+        }
+
+        Memory::SPSCArbitrarySizeCirclebuffer& LoggerImpl::GetStagingBuffer()
+        {
+            if(t_stagingBuffer.logger != this)
+            {
+                Memory::SPSCArbitrarySizeCirclebuffer* stagingBuffer = new Memory::SPSCArbitrarySizeCirclebuffer();
+                stagingBuffer->Initialize(Constants::LOGGING_STAGING_BUFFER_SIZE);
                 {
-                    std::this_thread::sleep_for(Logging::Constants::LOGGING_PRODUCE_TIME_WAIT);
+                    std::lock_guard<std::mutex> lock(m_stagingBuffersLock);
+                    m_stagingBuffers.push_back(stagingBuffer);
                 }
+                t_stagingBuffer.logger = this;
+                t_stagingBuffer.buffer = stagingBuffer;
             }
-            free(buffer);
+            return *t_stagingBuffer.buffer;
         }
 
-        void* LoggerImpl::InitializeFileMap(const std::size_t& p_size)
+        void LoggerImpl::Stage(const Memory::CircleBufferHeader& p_header, const void* p_data)
         {
-            m_fileMap = new IO::FileMap();
-            void* memory = m_fileMap->Initialize(Logging::BuildFileMapName(m_uniqueId), p_size);
-            if(memory != nullptr)
+            Memory::SPSCArbitrarySizeCirclebuffer& stagingBuffer = GetStagingBuffer();
+            while(!stagingBuffer.Produce(p_header, p_data))
             {
-                return memory;
+                WakeForwardingThread();
+                std::this_thread::sleep_for(Logging::Constants::LOGGING_PRODUCE_TIME_WAIT);
             }
-            else
+            WakeForwardingThread();
+        }
+
+        void LoggerImpl::RegisterFormatSite(LogFormatSite& p_site)
+        {
+            std::lock_guard<std::mutex> lock(m_formatSitesLock);
+            if(p_site.id.load(std::memory_order_relaxed) != 0)
             {
-                throw std::runtime_error("Failed to initialize filemap.");
+                return;
             }
+            FormatSiteCopy site;
+            site.function = p_site.function;
+            site.format = p_site.format;
+            site.line = p_site.line;
+            m_formatSites.push_back(site);
+
+            // Ids start at one, zero means not registered
+            p_site.id.store(static_cast<uint32_t>(m_formatSites.size()), std::memory_order_release);
         }
 
-        IO::Mutex* LoggerImpl::CreateFileMapMutex()
+        void LoggerImpl::WakeForwardingThread()
         {
-            IO::Mutex* mutex = new IO::FileMapMutex();
-            const bool success = mutex->Initialize(Logging::BuildFileMapMutexName(m_uniqueId));
-            if(success)
+            // Sequentially consistent with the store in WaitForStagedMessages, one of the two sees the other
+            if(m_forwardingThreadSleeping.load(std::memory_order_seq_cst))
             {
-                return mutex;
+                std::lock_guard<std::mutex> lock(m_forwardingWakeupLock);
+                m_forwardingWakeup.notify_one();
+            }
+        }
+
+        void* LoggerImpl::InitializeFileMap(const std::size_t& p_size)
+        {
+            m_fileMap = new IO::FileMap();
+            void* memory = m_fileMap->Initialize(Logging::BuildFileMapName(m_uniqueId), p_size);
+            if(memory != nullptr)
+            {
+                return memory;
             }
             else
             {
-                delete mutex;
-                throw std::runtime_error("Failed to initialize filemap mutex.");
+                throw std::runtime_error("Failed to initialize filemap.");
             }
         }
 
@@ -224,39 +329,52 @@ namespace DoremiEngine
             CloseHandle(processInformation.hThread);
         }
 
-        void ThreadWork(ThreadMetaData* p_threadMetaData, Memory::ArbitrarySizeCirclebuffer* p_localBuffer, Memory::ArbitrarySizeCirclebuffer* m_outGoingBuffer)
+        void LoggerImpl::ThreadWork(ThreadMetaData* p_threadMetaData)
         {
             try
             {
                 bool messageExist = true;
-                const uint32_t sizeofBuffer = 1000;
-                void* buffer = malloc(sizeofBuffer); // TODORT TODOXX Might need to find a better value.
+                // Anything that fit in a staging buffer fits here
+                const uint32_t sizeofBuffer = Constants::LOGGING_STAGING_BUFFER_SIZE;
+                void* buffer = malloc(sizeofBuffer);
                 Memory::CircleBufferHeader* header = new Memory::CircleBufferHeader();
-                header->packageSize = sizeofBuffer; // TODORT TODOXX Might need to find a better value.
-                bool succeed = false;
+                std::vector<Memory::SPSCArbitrarySizeCirclebuffer*> stagingBuffers;
 
                 // As long as the application is running or if there are some messages ongoing
                 while(*p_threadMetaData->isApplicationOnline || messageExist)
                 {
-                    using namespace std::literals;
-                    messageExist = p_localBuffer->Consume(header, buffer, sizeofBuffer);
-                    if(messageExist)
                     {
-                        succeed = false;
-                        while(!succeed)
+                        // Buffers are only ever added, copy the list when it has grown
+                        std::lock_guard<std::mutex> lock(m_stagingBuffersLock);
+                        if(stagingBuffers.size() != m_stagingBuffers.size())
                         {
-                            succeed = m_outGoingBuffer->Produce(*header, buffer);
-                            if(!succeed)
+                            stagingBuffers = m_stagingBuffers;
+                        }
+                    }
+
+                    messageExist = false;
+                    for(auto& stagingBuffer : stagingBuffers)
+                    {
+                        while(stagingBuffer->Consume(header, buffer, sizeofBuffer))
+                        {
+                            messageExist = true;
+                            if(header->packageType == Memory::CircleBufferTypeEnum::BINARY_TEXT)
+                            {
+                                // The loggerprocess needs the site before the first text using it
+                                ForwardFormatSites(static_cast<BinaryTextMetaData*>(buffer)->siteId);
+                            }
+                            else if(header->packageType == Memory::CircleBufferTypeEnum::DATA)
                             {
-                                std::this_thread::sleep_for(Logging::Constants::LOGGING_PRODUCE_TIME_WAIT);
+                                ForwardDataSchemas(static_cast<DataMetaData*>(buffer)->schemaId);
                             }
+                            Forward(*header, buffer);
                         }
                     }
-                    else
+
+                    if(!messageExist)
                     {
-                        // TODORT
-                        // TODOXX Might not be long enough, or might be longer than required.
-                        std::this_thread::sleep_for(Logging::Constants::LOGGING_PRODUCE_TIME_WAIT);
+                        // Sleeps until something is logged
+                        WaitForStagedMessages(stagingBuffers);
                     }
                 }
 
@@ -269,5 +387,88 @@ namespace DoremiEngine
                 *p_threadMetaData->isThreadStillRunning = false;
             }
         }
+
+        void LoggerImpl::Forward(const Memory::CircleBufferHeader& p_header, const void* p_data)
+        {
+            while(!m_outGoingBuffer->Produce(p_header, p_data))
+            {
+                std::this_thread::sleep_for(Logging::Constants::LOGGING_PRODUCE_TIME_WAIT);
+            }
+        }
+
+        void LoggerImpl::ForwardFormatSites(const uint32_t& p_siteId)
+        {
+            if(p_siteId <= m_forwardedFormatSiteCount)
+            {
+                return;
+            }
+
+            // Copied out so threads registering sites don't wait while the filemap is full
+            std::vector<FormatSiteCopy> sites;
+            {
+                std::lock_guard<std::mutex> lock(m_formatSitesLock);
+                sites.assign(m_formatSites.begin() + m_forwardedFormatSiteCount, m_formatSites.end());
+            }
+
+            std::vector<char> record;
+            for(const auto& site : sites)
+            {
+                ++m_forwardedFormatSiteCount;
+                const uint16_t functionSize = static_cast<uint16_t>(site.function.size() + 1); // The plus one comes as the null terminator
+                const uint16_t formatSize = static_cast<uint16_t>(site.format.size() + 1); // The plus one comes as the null terminator
+                record.assign(sizeof(FormatSiteMetaData) + functionSize + formatSize, 0);
+                new(record.data()) FormatSiteMetaData(m_forwardedFormatSiteCount, site.line, functionSize, formatSize);
+                site.function.copy(record.data() + sizeof(FormatSiteMetaData), functionSize);
+                site.format.copy(record.data() + sizeof(FormatSiteMetaData) + functionSize, formatSize);
+
+                Memory::CircleBufferHeader header;
+                header.packageSize = static_cast<int32_t>(record.size());
+                header.packageType = Memory::CircleBufferType(Memory::CircleBufferTypeEnum::FORMAT_SITE);
+                Forward(header, record.data());
+            }
+        }
+
+        void LoggerImpl::ForwardDataSchemas(const uint32_t& p_schemaId)
+        {
+            if(p_schemaId <= m_forwardedDataSchemaCount)
+            {
+                return;
+            }
+
+            std::vector<TelemetrySchema> schemas;
+            {
+                std::lock_guard<std::mutex> lock(m_dataSchemasLock);
+                schemas.assign(m_dataSchemas.begin() + m_forwardedDataSchemaCount, m_dataSchemas.end());
+            }
+
+            std::vector<char> record;
+            for(const auto& schema : schemas)
+            {
+                ++m_forwardedDataSchemaCount;
+                record.clear();
+                WriteDataSchema(schema, record);
+
+                Memory::CircleBufferHeader header;
+                header.packageSize = static_cast<int32_t>(record.size());
+                header.packageType = Memory::CircleBufferType(Memory::CircleBufferTypeEnum::DATA_SCHEMA);
+                Forward(header, record.data());
+            }
+        }
+
+        void LoggerImpl::WaitForStagedMessages(const std::vector<Memory::SPSCArbitrarySizeCirclebuffer*>& p_stagingBuffers)
+        {
+            std::unique_lock<std::mutex> lock(m_forwardingWakeupLock);
+            m_forwardingThreadSleeping.store(true, std::memory_order_seq_cst);
+            bool messageExist = false;
+            for(auto& stagingBuffer : p_stagingBuffers)
+            {
+                messageExist = messageExist || stagingBuffer->HasData();
+            }
+            if(!messageExist && *m_applicationRunning)
+            {
+                m_forwardingWakeup.wait_for(lock, Logging::Constants::LOGGING_CONSUME_WAKEUP_TIMEOUT);
+            }
+            m_forwardingThreadSleeping.store(false, std::memory_order_relaxed);
+        }
     }
 }
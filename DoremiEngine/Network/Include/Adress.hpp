@@ -8,6 +8,11 @@ namespace DoremiEngine
         class Adress
         {
         public:
+            /**
+                Virtual since adresses are deleted through this class
+            */
+            virtual ~Adress() {}
+
             /**
                 Returns port
             */
@@ -42,6 +42,12 @@ namespace DoremiEngine
             */
             ~AdressImplementation();
 
+            /**
+                Adresses are created and deleted every update, they come from a thread safe pool instead of the heap
+            */
+            static void* operator new(size_t p_size);
+            static void operator delete(void* p_adress);
+
             /**
                 TODOCM doct
             */
@@ -1,4 +1,5 @@
 #include <AdressImplementation.hpp>
+#include <Utility/Utilities/Include/Memory/Pool/SlabPoolAllocator.hpp>
 
 namespace DoremiEngine
 {
@@ -38,6 +39,36 @@ namespace DoremiEngine
 
         AdressImplementation::~AdressImplementation() {}
 
+        namespace
+        {
+            // Adresses a slab holds
+            const size_t ADRESSES_PER_SLAB = 256;
+
+            Doremi::Utilities::Memory::SlabPoolAllocator* CreateAdressPool()
+            {
+                Doremi::Utilities::Memory::SlabPoolAllocator* adressPool = new Doremi::Utilities::Memory::SlabPoolAllocator();
+                adressPool->Initialize(sizeof(AdressImplementation), alignof(AdressImplementation), ADRESSES_PER_SLAB);
+                return adressPool;
+            }
+
+            Doremi::Utilities::Memory::SlabPoolAllocator& GetAdressPool()
+            {
+                // Never deleted, adresses may be deleted while static objects are destroyed
+                static Doremi::Utilities::Memory::SlabPoolAllocator* adressPool = CreateAdressPool();
+                return *adressPool;
+            }
+        }
+
+        void* AdressImplementation::operator new(size_t p_size) { return GetAdressPool().Allocate(); }
+
+        void AdressImplementation::operator delete(void* p_adress)
+        {
+            if(p_adress != nullptr)
+            {
+                GetAdressPool().Free(p_adress);
+            }
+        }
+
         void AdressImplementation::SetIP(uint32_t p_a, uint32_t p_b, uint32_t p_c, uint32_t p_d)
         {
             // TODOCM maybe save IP parts, and compose string when needed
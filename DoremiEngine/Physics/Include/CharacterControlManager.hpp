@@ -1,10 +1,30 @@
 #pragma once
 #include <DirectXMath.h>
+#include <cstdint>
+#include <vector>
 using namespace DirectX;
 namespace DoremiEngine
 {
     namespace Physics
     {
+        /**
+        What a controller collided with during a move. Same values as PhysX uses*/
+        enum class ControllerCollisionFlags : uint8_t
+        {
+            none = 0x00,
+            sides = 0x01,
+            up = 0x02,
+            down = 0x04,
+        };
+
+        /**
+        One controller and how far to move it, see MoveControllers*/
+        struct ControllerMove
+        {
+            int id;
+            XMFLOAT3 displacement;
+        };
+
         class CharacterControlManager
         {
         public:
@@ -26,6 +46,12 @@ namespace DoremiEngine
             Moves the desired controller with the specified displacement*/
             virtual bool MoveController(int p_id, XMFLOAT3 p_discplacement, float p_dt) = 0;
 
+            /**
+            Moves several controllers. o_collisionFlags gets the flags of every move, at the same index as the move.
+            The controllers are moved in order of where they are, so neighbours are moved after each other*/
+            virtual void MoveControllers(const std::vector<ControllerMove>& p_moves, float p_dt,
+                                         std::vector<ControllerCollisionFlags>& o_collisionFlags) = 0;
+
             /**
             DEPRECATED!! Still works though*/
             virtual void SetCallback(int p_bodyID, int p_filterGroup, int p_filterMask) = 0;
@@ -61,8 +61,8 @@ namespace DoremiEngine
             virtual void SetParticleEmitterData(int p_id, ParticleEmitterData p_data) = 0;
 
             /**
-            Gets all drains hit by a particle of the specified particle system*/
-            virtual vector<int> GetDrainsHit(int p_id) = 0;
+            Gets all drains hit by a particle of the specified particle system, valid until the next update*/
+            virtual const vector<int>& GetDrainsHit(int p_id) = 0;
         };
     }
 }
\ No newline at end of file
@@ -0,0 +1,29 @@
+#pragma once
+// Third party
+#include <PhysX/PxPhysicsAPI.h>
+
+// Standard libraries
+#include <cstdint>
+
+namespace DoremiEngine
+{
+    namespace Physics
+    {
+        /**
+        The entity ID of every rigid body and character controller actor is kept in PxActor::userData, so whatever PhysX hands back
+        in callbacks and queries can be mapped to its entity without any lookup. The ID is stored plus one so actors we never
+        tagged, like particle systems, read as no entity
+        */
+        inline void SetActorEntityID(physx::PxActor& p_actor, const int& p_id)
+        {
+            p_actor.userData = reinterpret_cast<void*>(static_cast<intptr_t>(p_id) + 1);
+        }
+
+        /**
+        Returns the entity ID stored in the user data, or -1 if there is none
+        */
+        inline int GetEntityIDFromUserData(const void* p_userData) { return static_cast<int>(reinterpret_cast<intptr_t>(p_userData) - 1); }
+
+        inline int GetActorEntityID(const physx::PxActor* p_actor) { return p_actor != nullptr ? GetEntityIDFromUserData(p_actor->userData) : -1; }
+    }
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <PhysX/PxPhysicsAPI.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace physx;
+namespace DoremiEngine
+{
+    namespace Physics
+    {
+        /**
+        How the scene sorts out which actors might touch, and how scene queries find static geometry
+        */
+        struct BroadPhaseSettings
+        {
+            // Sweep and prune over everything, or multi box pruning with the world split into regions
+            PxBroadPhaseType::Enum type = PxBroadPhaseType::eSAP;
+            // MBP regions along x and z, the region count is the square of this
+            uint32_t subdivisions = 4;
+            // Static geometry in its own AABB tree which is only rebuilt when a level is loaded, otherwise statics share the
+            // incrementally updated tree used for dynamic actors
+            bool staticPruningStructure = true;
+        };
+
+        /**
+        Sets up the broadphase of the world scene. With MBP the regions cover the bounds of the static geometry and are
+        placed again every time a level has been loaded. Actors leaving every region stop colliding and are counted.
+        */
+        class BroadPhaseHandler : public PxBroadPhaseCallback
+        {
+        public:
+            explicit BroadPhaseHandler(const BroadPhaseSettings& p_settings);
+            virtual ~BroadPhaseHandler();
+
+            /**
+            Sets the broadphase and pruning structures of a scene about to be created
+            */
+            void SetupSceneDesc(PxSceneDesc& o_sceneDesc);
+
+            /**
+            Called once the scene exists. Places MBP regions around the origin so actors created before a level is loaded collide
+            */
+            void SceneCreated(PxScene& p_scene);
+
+            /**
+            Called when the static geometry of a level has been added. Places the MBP regions over the level and runs one
+            scene query so the static pruning structure is built now instead of at the first query in game
+            */
+            void StaticGeometryLoaded();
+
+            /**
+            Number of times an actor has left every MBP region
+            */
+            uint32_t GetOutOfBoundsCount() const { return m_outOfBoundsCount; }
+
+            /**
+            Splits p_bounds into p_subdivisions * p_subdivisions regions along x and z. Every region covers all of p_bounds along y
+            */
+            static void ComputeRegions(const PxBounds3& p_bounds, uint32_t p_subdivisions, std::vector<PxBounds3>& o_regions);
+
+            /// Implements PxBroadPhaseCallback
+            void onObjectOutOfBounds(PxShape& p_shape, PxActor& p_actor) override;
+            void onObjectOutOfBounds(PxAggregate& p_aggregate) override;
+
+        private:
+            // Replaces all MBP regions with ones covering p_bounds
+            void PlaceRegions(const PxBounds3& p_bounds);
+            // Bounds of all static actors, planes excluded since they are infinite
+            PxBounds3 ComputeStaticBounds() const;
+
+            const BroadPhaseSettings m_settings;
+            PxScene* m_scene;
+            std::vector<PxU32> m_regionHandles;
+            uint32_t m_outOfBoundsCount;
+        };
+    }
+}
@@ -1,8 +1,9 @@
 #pragma once
 #include <CharacterControlManager.hpp>
+#include <Internal/EntityIDTable.hpp>
+#include <Internal/ActorEntityID.hpp>
 #include <PhysX/PxPhysicsAPI.h>
 
-#include <unordered_map>
 using namespace std;
 using namespace physx;
 namespace DoremiEngine
@@ -20,6 +21,7 @@ namespace DoremiEngine
 
             int AddController(int p_id, int p_matID, XMFLOAT3 p_position, XMFLOAT2 p_dimensions) override;
             bool MoveController(int p_id, XMFLOAT3 p_discplacement, float p_dt) override;
+            void MoveControllers(const vector<ControllerMove>& p_moves, float p_dt, vector<ControllerCollisionFlags>& o_collisionFlags) override;
             void SetCallbackFiltering(int p_body, int p_thisIdMask, int p_notifyTouchOthersMask, int p_notifyLeaveOthersMask, int p_ignoreOthersMask) override;
             void SetCallback(int p_bodyID, int p_filterGroup, int p_filterMask) override;
             void SetDrain(int p_id, bool p_isDrain) override;
@@ -42,14 +44,30 @@ namespace DoremiEngine
             void RemoveCharacterController(int p_bodyID);
 
             /**
+            Returns the ID of the controller owning the actor, or -1 if the actor doesn't belong to a controller
             */
-            unordered_map<PxController*, int> GetIdsByControllers();
+            int GetIDByActor(const PxActor* p_actor) const;
+
+            int GetIDByController(const PxController* p_controller) const;
 
         private:
+            /**
+            A move of MoveControllers with its controller looked up and its place in the world
+            */
+            struct OrderedMove
+            {
+                uint32_t locationCode;
+                uint32_t moveIndex;
+                PxController* controller;
+            };
+
             InternalPhysicsUtils& m_utils;
 
-            unordered_map<int, PxController*> m_controllers;
-            unordered_map<PxController*, int> m_IDsByControllers;
+            // Kept between batches so no allocation is needed once big enough
+            vector<OrderedMove> m_orderedMoves;
+
+            // The ID of each controller is in the user data of its actor
+            EntityIDTable<PxController> m_controllers;
 
             PxControllerManager* m_manager;
 
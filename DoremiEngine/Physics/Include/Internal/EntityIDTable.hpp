@@ -0,0 +1,102 @@
+#pragma once
+// Standard libraries
+#include <cstdint>
+#include <vector>
+
+namespace DoremiEngine
+{
+    namespace Physics
+    {
+        /**
+        Maps entity IDs to objects owned by the physics module. Entity IDs are small and dense so the ID indexes a sparse array
+        pointing into a packed array of the objects, a lookup is two array reads instead of a hash. The packed array is kept free
+        from holes by moving the last object into the place of a removed one.
+        */
+        template <typename T> class EntityIDTable
+        {
+        public:
+            EntityIDTable() {}
+
+            /**
+            Adds the object with the given ID, replacing any object already there
+            */
+            void Insert(const int& p_id, T* p_object)
+            {
+                if(p_id < 0)
+                {
+                    return;
+                }
+                const size_t id = static_cast<size_t>(p_id);
+                if(id >= m_denseIndices.size())
+                {
+                    m_denseIndices.resize(id + 1, INVALID_INDEX);
+                }
+                if(m_denseIndices[id] != INVALID_INDEX)
+                {
+                    m_objects[m_denseIndices[id]] = p_object;
+                    return;
+                }
+                m_denseIndices[id] = static_cast<uint32_t>(m_objects.size());
+                m_objects.push_back(p_object);
+                m_ids.push_back(p_id);
+            }
+
+            /**
+            Removes the object with the given ID if there is one
+            */
+            void Erase(const int& p_id)
+            {
+                if(!Contains(p_id))
+                {
+                    return;
+                }
+                const uint32_t index = m_denseIndices[p_id];
+                const uint32_t lastIndex = static_cast<uint32_t>(m_objects.size() - 1);
+                if(index != lastIndex)
+                {
+                    m_objects[index] = m_objects[lastIndex];
+                    m_ids[index] = m_ids[lastIndex];
+                    m_denseIndices[m_ids[index]] = index;
+                }
+                m_objects.pop_back();
+                m_ids.pop_back();
+                m_denseIndices[p_id] = INVALID_INDEX;
+            }
+
+            bool Contains(const int& p_id) const
+            {
+                return p_id >= 0 && static_cast<size_t>(p_id) < m_denseIndices.size() && m_denseIndices[p_id] != INVALID_INDEX;
+            }
+
+            /**
+            Returns the object with the given ID, or nullptr if there is none
+            */
+            T* Get(const int& p_id) const { return Contains(p_id) ? m_objects[m_denseIndices[p_id]] : nullptr; }
+
+            void Clear()
+            {
+                m_denseIndices.clear();
+                m_objects.clear();
+                m_ids.clear();
+            }
+
+            size_t Size() const { return m_objects.size(); }
+
+            /**
+            Packed arrays, the object at an index has the ID at the same index. The order changes when objects are removed
+            */
+            const std::vector<T*>& GetObjects() const { return m_objects; }
+            const std::vector<int>& GetIDs() const { return m_ids; }
+
+        private:
+            static const uint32_t INVALID_INDEX = UINT32_MAX;
+
+            // Index into the packed arrays for every ID
+            std::vector<uint32_t> m_denseIndices;
+            std::vector<T*> m_objects;
+            std::vector<int> m_ids;
+        };
+
+        template <typename T> const uint32_t EntityIDTable<T>::INVALID_INDEX;
+    }
+}
@@ -22,7 +22,7 @@ namespace DoremiEngine
             void GetParticlePositions(int p_id, vector<XMFLOAT3>& o_positions) override;
             const vector<XMFLOAT3>& GetRemovedParticlesPositions(int p_id) override;
             void SetParticleEmitterData(int p_id, ParticleEmitterData p_data) override;
-            vector<int> GetDrainsHit(int p_id) override;
+            const vector<int>& GetDrainsHit(int p_id) override;
             // void CreateFluid(int p_id) override;
             // void CreateFluidParticles(int p_id, vector<XMFLOAT3>& p_positions, vector<XMFLOAT3>& p_velocities, vector<int>& p_indices) override;
 
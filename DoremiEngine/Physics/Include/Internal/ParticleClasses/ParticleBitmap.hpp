@@ -0,0 +1,66 @@
+#pragma once
+// Standard libraries
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace DoremiEngine
+{
+    namespace Physics
+    {
+        namespace ParticleBitmap
+        {
+            /**
+            Index of the lowest set bit. p_word must not be zero
+            */
+            inline uint32_t CountTrailingZeros(const uint32_t& p_word)
+            {
+#if defined(_MSC_VER)
+                unsigned long index;
+                _BitScanForward(&index, p_word);
+                return static_cast<uint32_t>(index);
+#else
+                return static_cast<uint32_t>(__builtin_ctz(p_word));
+#endif
+            }
+
+            /**
+            Number of 32 bit words needed for p_bitCount bits
+            */
+            inline size_t WordCount(const size_t& p_bitCount) { return (p_bitCount + 31) >> 5; }
+
+            /**
+            Calls p_function with the index of every set bit, lowest index first. Whole zero words are skipped
+            */
+            template <typename Function> void ForEachSetBit(const uint32_t* p_words, const size_t& p_wordCount, Function p_function)
+            {
+                for(size_t i = 0; i < p_wordCount; ++i)
+                {
+                    for(uint32_t word = p_words[i]; word != 0; word &= word - 1)
+                    {
+                        p_function(static_cast<uint32_t>(i << 5) | CountTrailingZeros(word));
+                    }
+                }
+            }
+
+            inline bool IsSet(const uint32_t* p_words, const uint32_t& p_index) { return (p_words[p_index >> 5] & (1u << (p_index & 31))) != 0; }
+
+            inline void Clear(uint32_t* p_words, const uint32_t& p_index) { p_words[p_index >> 5] &= ~(1u << (p_index & 31)); }
+
+            /**
+            Subtracts p_dt from every lifetime. Written without branches so the compiler turns it into SIMD, slots without a
+            particle are decremented too since they get a new lifetime when a particle is created in them
+            */
+            inline void DecrementLifeTimes(float* p_lifeTimes, const size_t& p_count, const float& p_dt)
+            {
+                for(size_t i = 0; i < p_count; ++i)
+                {
+                    p_lifeTimes[i] -= p_dt;
+                }
+            }
+        }
+    }
+}
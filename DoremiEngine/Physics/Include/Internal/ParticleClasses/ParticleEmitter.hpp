@@ -4,7 +4,6 @@
 #include <PhysX/PxPhysicsAPI.h>
 #include <FluidManager.hpp>
 #include <vector>
-#include <map>
 #include <random>
 
 #define PARTICLE_MAX_COUNT 20000 // TODOCONFIG
@@ -39,14 +38,15 @@ namespace DoremiEngine
             /**
             Gets all positions of particles associated with this
             particle system. Send a reference to an already defined
-            vector of XMFLOATS as argument*/
+            vector of XMFLOATS as argument. The positions are the ones
+            read in the last Update, without the particles released there*/
             void GetPositions(vector<XMFLOAT3>& o_positions);
 
             /**
             Returns a vector with the index for all drain objects
             that were hit by a particle in the previous simulation
             step*/
-            vector<int> GetDrainsHit();
+            const vector<int>& GetDrainsHit();
 
             /**
             Returns a vector with the positions of all particles
@@ -75,7 +75,7 @@ namespace DoremiEngine
                 Sets the lifetime of the particles made after this call. Should be set before every particle call just to be safe that it is the
                correct timelength
             */
-            void SetParticlesLifeTime(double p_time) { m_lifeTime = p_time; }
+            void SetParticlesLifeTime(double p_time) { m_lifeTime = static_cast<float>(p_time); }
 
         private:
             // Locks read data (do this before using the read data)
@@ -84,12 +84,20 @@ namespace DoremiEngine
             void UnlockParticleData();
 
             /**
-            UpdateLifetime of all active particles. Release particles that have lifetime < 0 */
+            Copies positions, velocities and the valid bitmap out of PhysX in one go and
+            finds the particles that collided with a drain. Everything after this works on
+            the copies so the read data is only locked for the copy*/
+            void ReadParticleData();
+            /**
+            UpdateLifetime of all active particles. Queues particles that have lifetime < 0 for release */
             void UpdateParticleLifeTimeAndRemoveExpired(float p_dt);
             /**
-            Remove particles that have collided with a drain */
+            Queues particles that have collided with a drain for release */
             void RemoveDrainCollidedParticles(float p_dt);
             /**
+            Releases the queued particles in one call and clears them from the valid bitmap*/
+            void ReleaseQueuedParticles();
+            /**
             Updates the emission of particles*/
             void UpdateParticleEmission(float p_dt);
 
@@ -99,8 +107,22 @@ namespace DoremiEngine
             PxParticleReadData* m_readData;
 
             ParticleEmitterData m_this;
-            std::map<int, double> m_particlesLifeTime;
-            double m_lifeTime;
+            // Remaining lifetime of every particle index
+            vector<float> m_particlesLifeTime;
+            float m_lifeTime;
+
+            /*
+            Particle data read in ReadParticleData, one array per attribute indexed by particle index.
+            Sized for PARTICLE_MAX_COUNT once so reading never allocates*/
+            vector<XMFLOAT3> m_positions;
+            vector<XMFLOAT3> m_velocities;
+            vector<uint32_t> m_validBitmap;
+            // Particle indices below this may be valid
+            uint32_t m_validRange;
+            // Indices of particles flagged as colliding with a drain
+            vector<PxU32> m_drainCollided;
+            // Indices of particles to release this update
+            vector<PxU32> m_indicesToRelease;
 
             // The actual PhysX particle system
             PxParticleSystem* m_particleSystem;
@@ -0,0 +1,77 @@
+#pragma once
+#include <DoremiEngine/Physics/Include/PhysicsModule.hpp>
+#include <PhysX/PxPhysicsAPI.h>
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace Threading
+        {
+            class WorkStealingThreadPool;
+        }
+    }
+}
+
+using namespace physx;
+namespace DoremiEngine
+{
+    namespace Physics
+    {
+        /**
+        Runs the PhysX simulation tasks on the engine thread pool instead of threads owned by PhysX, and times every task
+        */
+        class PhysicsCpuDispatcher : public PxCpuDispatcher
+        {
+        public:
+            explicit PhysicsCpuDispatcher(Doremi::Utilities::Threading::WorkStealingThreadPool& p_threadPool);
+            virtual ~PhysicsCpuDispatcher();
+
+            /**
+            Called by PhysX when a task is ready to run
+            */
+            void submitTask(PxBaseTask& p_task) override;
+
+            /**
+            Number of threads PhysX may expect to run its tasks on
+            */
+            PxU32 getWorkerCount() const override;
+
+            /**
+            Gathers the timing of all tasks since the last reset. Simulation time is left untouched
+            */
+            void GetStatistics(PhysicsDispatchStatistics& o_statistics) const;
+
+            void ResetStatistics();
+
+        private:
+            struct TaskTiming
+            {
+                uint32_t count = 0;
+                double totalTime = 0;
+                double maxTime = 0;
+            };
+
+            /**
+            Timings written by one worker only, the lock is just held against readers
+            */
+            struct WorkerTimings
+            {
+                std::mutex mutex;
+                // PhysX task names are string literals, so the pointer is enough as key
+                std::unordered_map<const char*, TaskTiming> tasks;
+                PhysicsWorkerStatistics worker;
+            };
+
+            void RunTask(PxBaseTask& p_task);
+
+            Doremi::Utilities::Threading::WorkStealingThreadPool& m_threadPool;
+            std::vector<std::unique_ptr<WorkerTimings>> m_workerTimings;
+        };
+    }
+}
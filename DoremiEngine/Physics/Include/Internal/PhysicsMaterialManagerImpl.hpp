@@ -1,6 +1,6 @@
 #pragma once
 #include <PhysicsMaterialManager.hpp>
-#include <unordered_map>
+#include <Internal/EntityIDTable.hpp>
 #include <PhysX/PxPhysicsAPI.h>
 using namespace std;
 using namespace physx;
@@ -24,7 +24,7 @@ namespace DoremiEngine
 
         private:
             InternalPhysicsUtils& m_utils;
-            unordered_map<int, PxMaterial*> m_materials;
+            EntityIDTable<PxMaterial> m_materials;
             int m_nextMaterial;
         };
     }
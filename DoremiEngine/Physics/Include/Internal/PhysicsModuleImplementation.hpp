@@ -6,6 +6,10 @@
 #include <Internal/CharacterControlManagerImpl.hpp>
 #include <Internal/FluidManagerImpl.hpp>
 #include <Internal/RayCastManagerImpl.hpp>
+#include <Internal/PhysicsCpuDispatcher.hpp>
+#include <Internal/BroadPhaseHandler.hpp>
+#include <Utility/Utilities/Include/Chrono/Timer.hpp>
+#include <Utility/Utilities/Include/Memory/PageSpecification.hpp>
 
 #include <PhysX/PxPhysicsAPI.h>
 #include <PhysX/pvd/PxVisualDebugger.h>
@@ -38,10 +42,20 @@ namespace DoremiEngine
                 delete m_rayCastManager;
                 m_worldScene->release();
                 m_physics->release();
-                m_dispatcher->release();
+                delete m_dispatcher;
+                delete m_broadPhaseHandler;
                 m_foundation->release();
             }
 
+            /**
+            Returns the ID of the rigid body or character controller owning the actor, or -1 if it is neither
+            */
+            int GetIDByActor(const PxActor* p_actor) const
+            {
+                const int id = m_rigidBodyManager->GetIDByActor(p_actor);
+                return id != -1 ? id : m_characterControlManager->GetIDByActor(p_actor);
+            }
+
             // Sub modules managers thingies
             RigidBodyManagerImpl* m_rigidBodyManager;
             PhysicsMaterialManagerImpl* m_physicsMaterialManager;
@@ -53,8 +67,13 @@ namespace DoremiEngine
             PxDefaultAllocator m_allocator;
             PxDefaultErrorCallback m_errorCallback;
             PxPhysics* m_physics;
-            PxDefaultCpuDispatcher* m_dispatcher;
+            PhysicsCpuDispatcher* m_dispatcher;
             PxFoundation* m_foundation;
+            // Broadphase regions and static pruning of the world scene
+            BroadPhaseHandler* m_broadPhaseHandler;
+
+            // Engine thread pool, also running the simulation tasks
+            Doremi::Utilities::Threading::WorkStealingThreadPool* m_threadPool;
 
             // The basic world. TODOJB add to some sort of scene manager?
             PxScene* m_worldScene;
@@ -71,8 +90,11 @@ namespace DoremiEngine
             void Startup() override;
             void Shutdown() override;
             /**
-            Does nothing so far TODOJB update as necessary*/
+            Simulates and fetches the result at once*/
             void Update(float p_dt) override;
+            void BeginSimulate(float p_dt) override;
+            void EndSimulate() override;
+            bool IsSimulating() const override { return m_simulating; }
 
             /**
             Get methods for sub modules*/
@@ -82,14 +104,24 @@ namespace DoremiEngine
             FluidManager& GetFluidManager() override;
             RayCastManager& GetRayCastManager() override;
 
-            vector<CollisionPair> GetCollisionPairs() override;
-            vector<CollisionPair> GetTriggerPairs() override;
-            vector<CollisionPair> GetLeftCollisionPairs() override;
+            CollisionPairSpan GetCollisionPairs() override;
+            CollisionPairSpan GetCollisionPairsForBody(int p_bodyID) override;
+            CollisionPairSpan GetTriggerPairs() override;
+            CollisionPairSpan GetLeftCollisionPairs() override;
+
+            void GetDispatchStatistics(PhysicsDispatchStatistics& o_statistics) override;
+            void ResetDispatchStatistics() override;
 
         private:
             // Creates the world as a scene. TODOJB create SceneManager somehow
             void CreateWorldScene();
 
+            // Clears all collision pairs before new ones are reported
+            void ClearCollisionPairs();
+
+            // Returns the pairs with p_id as firstID from pairs sorted by firstID
+            static CollisionPairSpan FindPairsByFirstID(const vector<CollisionPair>& p_sortedPairs, int p_id);
+
             /// Implements PxSimulationEventCallback
             // Called when contact between two bodies (i think)
             virtual void onContact(const PxContactPairHeader& pairHeader, const PxContactPair* pairs, PxU32 nbPairs);
@@ -121,6 +153,24 @@ namespace DoremiEngine
             vector<CollisionPair> m_collisionPairs;
             vector<CollisionPair> m_triggerPairs;
             vector<CollisionPair> m_leftCollisionPairs;
+            // Every collision pair twice, once from each body, sorted by firstID. Rebuilt when pairs have been added
+            vector<CollisionPair> m_collisionPairsByBody;
+
+            // Time spent simulating since the dispatch statistics were reset
+            double m_simulationTime;
+            uint32_t m_simulationCount;
+            // Started in BeginSimulate and stopped in EndSimulate
+            Doremi::Utilities::Chrono::Timer m_simulationTimer;
+            bool m_simulating;
+            // Length of the running step, logged as telemetry with the time it took
+            float m_stepLength;
+            uint32_t m_stepTelemetrySchema;
+
+            // Memory PhysX uses for its temporaries during a step before it allocates, none if m_scratch.memory is nullptr
+            Doremi::Utilities::Memory::PageAllocation m_scratch;
+            uint32_t m_scratchSize;
+            // PhysX wants the scratch block in multiples of this
+            static const uint32_t SCRATCH_GRANULARITY = 16 * 1024;
 
             Logging::Logger* m_logger;
         };
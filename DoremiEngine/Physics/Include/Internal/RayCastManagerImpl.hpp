@@ -1,5 +1,8 @@
 #pragma once
 #include <DoremiEngine/Physics/Include/RayCastManager.hpp>
+#include <PhysX/PxPhysicsAPI.h>
+
+using namespace physx;
 namespace DoremiEngine
 {
     namespace Physics
@@ -11,6 +14,7 @@ namespace DoremiEngine
             explicit RayCastManagerImpl(InternalPhysicsUtils& p_utils);
             virtual ~RayCastManagerImpl();
             int CastRay(const DirectX::XMFLOAT3& p_origin, const DirectX::XMFLOAT3& p_direction, const float& p_range) override;
+            void CastRays(const std::vector<RayCastQuery>& p_rays, std::vector<int>& o_hits) override;
             int CastRayAgainstCharacterController(const DirectX::XMFLOAT3& p_origin, const DirectX::XMFLOAT3& p_direction, const float& p_range) override;
             int CastSweep(const XMFLOAT3& p_origin, XMFLOAT3& p_direction, float p_width, const float& p_range) override;
             // DEBUG method. TODOJB remove?
@@ -18,7 +22,26 @@ namespace DoremiEngine
             std::vector<int> OverlapBoxMultipleHits(const XMFLOAT3& p_origin, const XMFLOAT3& p_halfExtents) override;
 
         private:
+            /**
+            One PxBatchQuery together with the memory it writes its results to. A batch query may only be used by one thread at a time
+            */
+            struct RayBatch
+            {
+                PxBatchQuery* query = nullptr;
+                std::vector<PxRaycastQueryResult> results;
+                // Index of the ray in the p_rays list for each result
+                std::vector<size_t> rayIndices;
+            };
+
+            // Creates a new batch query able to hold m_raysPerBatch rays
+            RayBatch* CreateRayBatch();
+            // Fills and executes one batch. Called from several threads at once, for different batches
+            void ExecuteRayBatch(const std::vector<RayCastQuery>& p_rays, size_t p_batchIndex);
+
             InternalPhysicsUtils& m_utils;
+
+            std::vector<RayBatch*> m_rayBatches;
+            const size_t m_raysPerBatch = 64;
         };
     }
-}
\ No newline at end of file
+}
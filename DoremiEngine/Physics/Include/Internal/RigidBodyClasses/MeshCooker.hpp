@@ -1,6 +1,10 @@
 #pragma once
 #include <DirectXMath.h>
 #include <PhysX/PxPhysicsAPI.h>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 using namespace std;
@@ -12,7 +16,8 @@ namespace DoremiEngine
     {
         struct InternalPhysicsUtils;
         /**
-        Class used to cook meshes into complex collision surfaces.*/
+        Class used to cook meshes into complex collision surfaces.
+        Meshes are kept by a hash of their content, so a mesh placed several times is only cooked once.*/
         class MeshCooker
         {
         public:
@@ -22,10 +27,46 @@ namespace DoremiEngine
             // Cooks a set of vertex positions into a collision mesh
             PxTriangleMesh* CookMesh(vector<XMFLOAT3>& p_pertexPositions, vector<int>& p_indices);
 
+            /**
+            Cooks several meshes on the engine thread pool, o_meshes gets one mesh per index in the same order (NULL if cooking failed).
+            Meshes cooked before are read from p_cacheFile instead of being cooked. Afterwards the file is rewritten to hold exactly
+            the meshes asked for if anything had to be cooked. An empty file name cooks without the file
+            */
+            void CookMeshes(const vector<const vector<XMFLOAT3>*>& p_vertexPositions, const vector<const vector<int>*>& p_indices,
+                            const string& p_cacheFile, vector<PxTriangleMesh*>& o_meshes);
+
+            /**
+            Hash of the vertex positions and indices, used to find meshes which were cooked before
+            */
+            static uint64_t HashMesh(const vector<XMFLOAT3>& p_vertexPositions, const vector<int>& p_indices);
 
         private:
+            /**
+            A cooked mesh as PhysX serializes it, ready for createTriangleMesh
+            */
+            struct CookedMeshStream
+            {
+                uint32_t vertexCount = 0;
+                uint32_t indexCount = 0;
+                vector<uint8_t> data;
+            };
+
+            // Cooks into a stream. PxCooking isn't shared between threads, every worker passes its own
+            static bool CookToStream(PxCooking& p_cooker, const vector<XMFLOAT3>& p_vertexPositions, const vector<int>& p_indices,
+                                     vector<uint8_t>& o_stream);
+            // Creates the mesh from the stream and remembers it by hash
+            PxTriangleMesh* CreateMesh(const uint64_t& p_hash, const vector<uint8_t>& p_stream);
+            PxCooking* CreateCooker();
+
+            // Cache files are skipped if written by another PhysX version, the cooked format may have changed
+            static void ReadCacheFile(const string& p_fileName, unordered_map<uint64_t, CookedMeshStream>& o_streams);
+            static void WriteCacheFile(const string& p_fileName, const unordered_map<uint64_t, CookedMeshStream>& p_streams);
+            static void WriteCacheStreams(ostream& p_file, const unordered_map<uint64_t, CookedMeshStream>& p_streams);
+
             InternalPhysicsUtils& m_utils;
             PxCooking* m_cooker;
+            // Meshes by content hash. They are reference counted by PhysX so every body using one can share it
+            unordered_map<uint64_t, PxTriangleMesh*> m_meshes;
         };
     }
-}
\ No newline at end of file
+}
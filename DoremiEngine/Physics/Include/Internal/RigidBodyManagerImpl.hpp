@@ -4,14 +4,13 @@
 
 // Internal
 #include <Internal/RigidBodyClasses/MeshCooker.hpp>
+#include <Internal/EntityIDTable.hpp>
+#include <Internal/ActorEntityID.hpp>
 
 // Third party
 #include <DirectXMath.h>
 #include <PhysX/PxPhysicsAPI.h>
 
-// Standard libraries
-#include <unordered_map>
-
 using namespace physx;
 using namespace std;
 using namespace DirectX;
@@ -32,6 +31,7 @@ namespace DoremiEngine
                                    int p_materialID) override;
             void AddMeshBodyDynamic(int p_id, XMFLOAT3 p_position, XMFLOAT4 p_orientation, vector<XMFLOAT3>& p_vertexPositions,
                                     vector<int>& p_indices, int p_materialID) override;
+            void AddMeshBodiesStatic(const vector<MeshBodyDescription>& p_bodies, const std::string& p_cookedMeshFile) override;
 
             int AddSphereBodyDynamic(int p_id, XMFLOAT3 p_position, float p_radius) override;
             int AddCapsuleBodyDynamic(int p_id, XMFLOAT3 p_position, XMFLOAT4 p_orientation, float p_height, float p_radius) override;
@@ -59,6 +59,8 @@ namespace DoremiEngine
             XMFLOAT3 GetBodyAngularVelocity(int p_bodyID) override;
             float GetLinearDampening(int p_bodyID) override;
 
+            size_t WriteMovedBodyTransforms(XMFLOAT3* p_positions, XMFLOAT4* p_orientations, size_t p_stride, size_t p_count) override;
+
             std::vector<int>& GetRecentlyWokenObjects() override;
             std::vector<int>& GetRecentlySleepingObjects() override;
 
@@ -68,7 +70,10 @@ namespace DoremiEngine
             void SetGravity(int p_bodyID, bool p_useGravity) override;
 
             /// Internal methods not used via interface (only used in module)
-            unordered_map<PxRigidActor*, int>& GetIDsByBodies();
+            /**
+            Returns the ID of the rigid body with the given actor, or -1 if the actor isn't one of the rigid bodies
+            */
+            int GetIDByActor(const PxActor* p_actor) const;
             // Set methods called from the callback method in PhysicsModuleImplementation
             void SetRecentlyWokenObjects(PxActor** p_actors, int p_count);
             void SetRecentlySleepingObjects(PxActor** p_actors, int p_count);
@@ -89,14 +94,18 @@ namespace DoremiEngine
 
 
         private:
+            // Creates a static body with the mesh as shape. It isn't added to the scene, returns NULL if there is no mesh
+            PxRigidStatic* CreateStaticMeshBody(int p_id, const XMFLOAT3& p_position, const XMFLOAT4& p_orientation, PxTriangleMesh* p_mesh,
+                                                int p_materialID);
+
             InternalPhysicsUtils& m_utils;
             MeshCooker* m_meshCooker;
 
             // Separate lists for dynamic and static bodies
             // unordered_map<int, PxRigidDynamic*> m_bodies;
             // unordered_map<int, PxRigidStatic*> m_staticBodies;
-            unordered_map<int, PxRigidActor*> m_bodies;
-            unordered_map<PxRigidActor*, int> m_IDsByBodies;
+            // The ID of each body is in the user data of its actor
+            EntityIDTable<PxRigidActor> m_bodies;
             vector<int> m_recentlyWokenObjects;
             vector<int> m_recentlySleepingObjects;
         };
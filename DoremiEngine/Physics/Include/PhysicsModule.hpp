@@ -2,6 +2,7 @@
 #include <DoremiEngine/Core/Include/Subsystem/EngineModule.hpp>
 #include <DoremiEngine/Core/Include/SharedContext.hpp>
 
+#include <string>
 #include <vector>
 
 #if defined(_WINDLL)
@@ -20,6 +21,59 @@ namespace DoremiEngine
             int secondID = -1;
         };
 
+        /**
+        Read only view of collision pairs stored in the physics module. It stays valid until the module adds or clears
+        pairs, which happens in EndSimulate and when character controllers move
+        */
+        struct CollisionPairSpan
+        {
+            CollisionPairSpan() : pairs(nullptr), count(0) {}
+            CollisionPairSpan(const CollisionPair* p_pairs, size_t p_count) : pairs(p_pairs), count(p_count) {}
+
+            const CollisionPair* begin() const { return pairs; }
+            const CollisionPair* end() const { return pairs + count; }
+            size_t size() const { return count; }
+            bool empty() const { return count == 0; }
+            const CollisionPair& operator[](const size_t& p_index) const { return pairs[p_index]; }
+
+            const CollisionPair* pairs;
+            size_t count;
+        };
+
+        /**
+        Timing of all PhysX tasks with the same name
+        */
+        struct PhysicsTaskStatistics
+        {
+            std::string name;
+            uint32_t count = 0;
+            double totalTime = 0;
+            double maxTime = 0;
+        };
+
+        /**
+        How many PhysX tasks a worker thread has run and how long it spent running them
+        */
+        struct PhysicsWorkerStatistics
+        {
+            uint32_t taskCount = 0;
+            double busyTime = 0;
+        };
+
+        /**
+        Timing of the PhysX tasks since the last reset. All times are in seconds.
+        Summed busy time of the workers divided by simulation time gives how many threads physics kept busy on average
+        */
+        struct PhysicsDispatchStatistics
+        {
+            std::vector<PhysicsTaskStatistics> tasks;
+            // Indexed by worker, the last entry are tasks run outside the thread pool
+            std::vector<PhysicsWorkerStatistics> workers;
+            // Time spent from the start of simulate until fetchResults returned
+            double simulationTime = 0;
+            uint32_t simulationCount = 0;
+        };
+
         class RigidBodyManager;
         class PhysicsMaterialManager;
         class CharacterControlManager;
@@ -31,10 +85,29 @@ namespace DoremiEngine
             virtual ~PhysicsModule() {}
 
             /**
-            Does nothing so far TODOJB update as necessary
+            Simulates p_dt seconds and waits for the result. Same as BeginSimulate followed by EndSimulate
             */
             virtual void Update(float p_dt) = 0;
 
+            /**
+            Starts simulating p_dt seconds on the worker threads and returns without waiting for the result.
+            Until EndSimulate is called reads and raycasts see the state from before the step, writes and
+            added or removed bodies are buffered by PhysX and applied when the step is fetched.
+            Character controllers and particles should not be used until EndSimulate has been called
+            */
+            virtual void BeginSimulate(float p_dt) = 0;
+
+            /**
+            Waits for the step started by BeginSimulate and fetches the result. The collision pairs are
+            replaced with the ones of the step. Does nothing if no step is running
+            */
+            virtual void EndSimulate() = 0;
+
+            /**
+            Returns true between BeginSimulate and EndSimulate
+            */
+            virtual bool IsSimulating() const = 0;
+
             /**
             Gets the rigid body manager. This manager handles all rigid bodies.
             It can be used to apply all kinds of forces, velocities and positions
@@ -62,20 +135,35 @@ namespace DoremiEngine
             */
             virtual RayCastManager& GetRayCastManager() = 0;
             /**
-            Gets a vector if all collision pairs. A collision pair consists of ids
+            Gets all collision pairs. A collision pair consists of ids
             of two bodies which have collided in the last simulation. This list is
             automatically cleared before each new simulation*/
-            virtual std::vector<CollisionPair> GetCollisionPairs() = 0;
+            virtual CollisionPairSpan GetCollisionPairs() = 0;
 
             /**
-            Gets a vector of all trigger collision pairs. The firstID is always the
+            Gets the collision pairs the body is part of. The firstID of every returned pair is p_bodyID
+            and the secondID is the body it collided with*/
+            virtual CollisionPairSpan GetCollisionPairsForBody(int p_bodyID) = 0;
+
+            /**
+            Gets all trigger collision pairs, sorted by trigger. The firstID is always the
             id of the trigger, and the secondID is always the id of the actor which
             collided with the trigger. It's awesome that way*/
-            virtual std::vector<CollisionPair> GetTriggerPairs() = 0;
+            virtual CollisionPairSpan GetTriggerPairs() = 0;
+
+            /**
+            Gets all objects which have recently left contact with eachother*/
+            virtual CollisionPairSpan GetLeftCollisionPairs() = 0;
 
             /**
-            Gets a vector of all objects which have recently left contact with eachother*/
-            virtual std::vector<CollisionPair> GetLeftCollisionPairs() = 0;
+            Gets the timing of the PhysX tasks run on the engine thread pool since the last reset
+            */
+            virtual void GetDispatchStatistics(PhysicsDispatchStatistics& o_statistics) = 0;
+
+            /**
+            Clears the timing of the PhysX tasks
+            */
+            virtual void ResetDispatchStatistics() = 0;
         };
     }
 }
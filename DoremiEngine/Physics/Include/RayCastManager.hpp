@@ -6,6 +6,16 @@ namespace DoremiEngine
 {
     namespace Physics
     {
+        /**
+        A single ray used by the batched raycasting functions
+        */
+        struct RayCastQuery
+        {
+            DirectX::XMFLOAT3 origin;
+            DirectX::XMFLOAT3 direction;
+            float range = 0.0f;
+        };
+
         /**
         Contains functions for raycasting TODOKO add more raycasting related stuff
         */
@@ -17,6 +27,13 @@ namespace DoremiEngine
             */
             virtual int CastRay(const DirectX::XMFLOAT3& p_origin, const DirectX::XMFLOAT3& p_direction, const float& p_range) = 0;
 
+            /**
+            Casts all the given rays using PhysX batch queries, the batches are spread over several threads if there are many rays.
+            o_hits is resized to the number of rays and hit i contains the id of the body hit by ray i, or -1 if no hit occured.
+            Works like calling CastRay for every ray but is a lot cheaper when there are many rays. Must not be called while simulating
+            */
+            virtual void CastRays(const std::vector<RayCastQuery>& p_rays, std::vector<int>& o_hits) = 0;
+
             /**
             Cast ray against Character controllers, returns -1 if the first hit was not a character controller
             */
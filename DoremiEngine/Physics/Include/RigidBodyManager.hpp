@@ -1,5 +1,6 @@
 #pragma once
 #include <DirectXMath.h>
+#include <string>
 #include <vector>
 using namespace std;
 using namespace DirectX;
@@ -7,6 +8,18 @@ namespace DoremiEngine
 {
     namespace Physics
     {
+        /**
+        A static body with a triangle mesh as collision structure, see AddMeshBodiesStatic*/
+        struct MeshBodyDescription
+        {
+            int id;
+            XMFLOAT3 position;
+            XMFLOAT4 orientation;
+            vector<XMFLOAT3> vertexPositions;
+            vector<int> indices;
+            int materialID;
+        };
+
         class RigidBodyManager
         {
         public:
@@ -26,6 +39,11 @@ namespace DoremiEngine
             virtual void AddMeshBodyStatic(int p_id, XMFLOAT3 p_position, XMFLOAT4 p_orientation, vector<XMFLOAT3>& p_vertexPositions,
                                            vector<int>& p_indices, int p_materialID) = 0;
             /**
+            Adds several static mesh bodies at once. The meshes are cooked in parallel, and meshes cooked earlier are read from
+            p_cookedMeshFile instead of being cooked again. The file is updated when anything new was cooked. Use an empty
+            file name to always cook*/
+            virtual void AddMeshBodiesStatic(const vector<MeshBodyDescription>& p_bodies, const std::string& p_cookedMeshFile) = 0;
+            /**
             NOT IMPLEMENTED. DO NOT USE TODOJB implement*/
             virtual void AddMeshBodyDynamic(int p_id, XMFLOAT3 p_position, XMFLOAT4 p_orientation, vector<XMFLOAT3>& p_vertexPositions,
                                             vector<int>& p_indices, int p_materialID) = 0;
@@ -122,6 +140,14 @@ namespace DoremiEngine
             Gets the velocity vector of the body*/
             virtual XMFLOAT3 GetBodyVelocity(int p_body) = 0;
 
+            /**
+            Writes the position and orientation of every body that moved in the last simulation step straight into an array
+            indexed by body id, in one pass over the bodies PhysX reports as active. Sleeping and static bodies are not written.
+            p_positions and p_orientations point at the position and orientation of element 0, p_stride is the size in bytes
+            of an element and p_count the number of elements. Must be called between simulations.
+            Returns the number of bodies written*/
+            virtual size_t WriteMovedBodyTransforms(XMFLOAT3* p_positions, XMFLOAT4* p_orientations, size_t p_stride, size_t p_count) = 0;
+
             /**
             Gets angular velocity of the body*/
             virtual XMFLOAT3 GetBodyAngularVelocity(int p_body) = 0;
@@ -0,0 +1,161 @@
+// This class
+#include <Internal/BroadPhaseHandler.hpp>
+
+#include <algorithm>
+#include <iostream>
+
+namespace DoremiEngine
+{
+    namespace Physics
+    {
+        namespace
+        {
+            // Area covered by regions until a level has been loaded
+            const PxBounds3 DEFAULT_WORLD_BOUNDS = PxBounds3(PxVec3(-1000.0f, -1000.0f, -1000.0f), PxVec3(1000.0f, 1000.0f, 1000.0f));
+            // Regions reach this far above and below the level, so falling and flying actors aren't lost. It includes the ground plane
+            const float REGION_HEIGHT = 100000.0f;
+            // Space added around the level along x and z, as a fraction of the level size and in units
+            const float REGION_MARGIN_FRACTION = 0.1f;
+            const float REGION_MARGIN = 50.0f;
+        }
+
+        BroadPhaseHandler::BroadPhaseHandler(const BroadPhaseSettings& p_settings) : m_settings(p_settings), m_scene(nullptr), m_outOfBoundsCount(0)
+        {
+        }
+
+        BroadPhaseHandler::~BroadPhaseHandler() {}
+
+        void BroadPhaseHandler::SetupSceneDesc(PxSceneDesc& o_sceneDesc)
+        {
+            o_sceneDesc.broadPhaseType = m_settings.type;
+            o_sceneDesc.broadPhaseCallback = this;
+            o_sceneDesc.staticStructure =
+                m_settings.staticPruningStructure ? PxPruningStructure::eSTATIC_AABB_TREE : PxPruningStructure::eDYNAMIC_AABB_TREE;
+            o_sceneDesc.dynamicStructure = PxPruningStructure::eDYNAMIC_AABB_TREE;
+        }
+
+        void BroadPhaseHandler::SceneCreated(PxScene& p_scene)
+        {
+            m_scene = &p_scene;
+            PlaceRegions(DEFAULT_WORLD_BOUNDS);
+        }
+
+        void BroadPhaseHandler::StaticGeometryLoaded()
+        {
+            const PxBounds3 staticBounds = ComputeStaticBounds();
+            if(!staticBounds.isEmpty())
+            {
+                const PxVec3 margin = staticBounds.getDimensions() * REGION_MARGIN_FRACTION + PxVec3(REGION_MARGIN);
+                PlaceRegions(PxBounds3(staticBounds.minimum - margin, staticBounds.maximum + margin));
+            }
+            // The scene builds its static tree at the first query after statics were added, forceDynamicTreeRebuild doesn't touch a
+            // static AABB tree. One short ray against the statics builds it here, during level load, instead of in the first game frame
+            PxRaycastBuffer hit;
+            m_scene->raycast(PxVec3(0.0f), PxVec3(0.0f, -1.0f, 0.0f), 1.0f, hit, PxHitFlags(PxHitFlag::eDEFAULT),
+                             PxQueryFilterData(PxQueryFlag::eSTATIC));
+        }
+
+        void BroadPhaseHandler::ComputeRegions(const PxBounds3& p_bounds, uint32_t p_subdivisions, std::vector<PxBounds3>& o_regions)
+        {
+            o_regions.clear();
+            if(p_subdivisions == 0)
+            {
+                return;
+            }
+            const PxVec3 size = p_bounds.getDimensions();
+            const float stepX = size.x / static_cast<float>(p_subdivisions);
+            const float stepZ = size.z / static_cast<float>(p_subdivisions);
+            for(uint32_t x = 0; x < p_subdivisions; ++x)
+            {
+                for(uint32_t z = 0; z < p_subdivisions; ++z)
+                {
+                    // The last region ends exactly on the bounds, no gap from rounding
+                    const float minX = p_bounds.minimum.x + stepX * x;
+                    const float minZ = p_bounds.minimum.z + stepZ * z;
+                    const float maxX = x + 1 == p_subdivisions ? p_bounds.maximum.x : minX + stepX;
+                    const float maxZ = z + 1 == p_subdivisions ? p_bounds.maximum.z : minZ + stepZ;
+                    o_regions.push_back(PxBounds3(PxVec3(minX, p_bounds.minimum.y, minZ), PxVec3(maxX, p_bounds.maximum.y, maxZ)));
+                }
+            }
+        }
+
+        void BroadPhaseHandler::onObjectOutOfBounds(PxShape& p_shape, PxActor& p_actor)
+        {
+            // The actor no longer collides with anything until it comes back, game code removes bullets and such by lifetime
+            ++m_outOfBoundsCount;
+        }
+
+        void BroadPhaseHandler::onObjectOutOfBounds(PxAggregate& p_aggregate) { ++m_outOfBoundsCount; }
+
+        void BroadPhaseHandler::PlaceRegions(const PxBounds3& p_bounds)
+        {
+            if(m_settings.type != PxBroadPhaseType::eMBP)
+            {
+                return;
+            }
+
+            PxBroadPhaseCaps caps;
+            m_scene->getBroadPhaseCaps(caps);
+            uint32_t subdivisions = std::max<uint32_t>(m_settings.subdivisions, 1);
+            while(subdivisions > 1 && subdivisions * subdivisions > caps.maxNbRegions)
+            {
+                --subdivisions;
+            }
+
+            const PxBounds3 bounds =
+                PxBounds3(PxVec3(p_bounds.minimum.x, std::min(p_bounds.minimum.y, -REGION_HEIGHT), p_bounds.minimum.z),
+                          PxVec3(p_bounds.maximum.x, std::max(p_bounds.maximum.y, REGION_HEIGHT), p_bounds.maximum.z));
+            std::vector<PxBounds3> regions;
+            ComputeRegions(bounds, subdivisions, regions);
+
+            for(auto& handle : m_regionHandles)
+            {
+                m_scene->removeBroadPhaseRegion(handle);
+            }
+            m_regionHandles.clear();
+            for(auto& regionBounds : regions)
+            {
+                PxBroadPhaseRegion region;
+                region.bounds = regionBounds;
+                region.userData = nullptr;
+                // Populating adds the actors already in the scene to the new region
+                const PxU32 handle = m_scene->addBroadPhaseRegion(region, true);
+                if(handle == 0xffffffff)
+                {
+                    std::cout << "Physics: failed to add broadphase region" << std::endl;
+                    continue;
+                }
+                m_regionHandles.push_back(handle);
+            }
+        }
+
+        PxBounds3 BroadPhaseHandler::ComputeStaticBounds() const
+        {
+            PxBounds3 bounds = PxBounds3::empty();
+            const PxU32 actorCount = m_scene->getNbActors(PxActorTypeFlag::eRIGID_STATIC);
+            std::vector<PxActor*> actors(actorCount);
+            if(actorCount == 0)
+            {
+                return bounds;
+            }
+            m_scene->getActors(PxActorTypeFlag::eRIGID_STATIC, actors.data(), actorCount);
+            std::vector<PxShape*> shapes;
+            for(auto& actor : actors)
+            {
+                PxRigidActor* rigidActor = static_cast<PxRigidActor*>(actor);
+                shapes.resize(rigidActor->getNbShapes());
+                rigidActor->getShapes(shapes.data(), static_cast<PxU32>(shapes.size()));
+                bool isPlane = false;
+                for(auto& shape : shapes)
+                {
+                    isPlane = isPlane || shape->getGeometryType() == PxGeometryType::ePLANE;
+                }
+                if(!isPlane)
+                {
+                    bounds.include(rigidActor->getWorldBounds());
+                }
+            }
+            return bounds;
+        }
+    }
+}
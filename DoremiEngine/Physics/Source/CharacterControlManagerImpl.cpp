@@ -1,5 +1,7 @@
 #include <Internal/CharacterControlManagerImpl.hpp>
 #include <Internal/PhysicsModuleImplementation.hpp>
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 
 #include <iostream>
@@ -8,6 +10,34 @@ namespace DoremiEngine
 {
     namespace Physics
     {
+        namespace
+        {
+            // Side of the cells controllers are ordered by, a bit bigger than a controller
+            const double LOCATION_CELL_SIZE = 8.0;
+
+            // Spreads the lower 16 bits out to every other bit
+            uint32_t SpreadBits(uint32_t p_value)
+            {
+                p_value &= 0x0000FFFF;
+                p_value = (p_value | (p_value << 8)) & 0x00FF00FF;
+                p_value = (p_value | (p_value << 4)) & 0x0F0F0F0F;
+                p_value = (p_value | (p_value << 2)) & 0x33333333;
+                p_value = (p_value | (p_value << 1)) & 0x55555555;
+                return p_value;
+            }
+
+            /**
+            Z-order of the cell on the ground plane the position is in. Positions close to each other get codes close to each other
+            */
+            uint32_t LocationCode(const PxExtendedVec3& p_position)
+            {
+                // Offset so the cells around origo get positive coordinates, anything outside wraps which only affects the order
+                const uint32_t x = static_cast<uint32_t>(static_cast<int32_t>(floor(p_position.x / LOCATION_CELL_SIZE)) + 0x8000);
+                const uint32_t z = static_cast<uint32_t>(static_cast<int32_t>(floor(p_position.z / LOCATION_CELL_SIZE)) + 0x8000);
+                return SpreadBits(x) | (SpreadBits(z) << 1);
+            }
+        }
+
         CharacterControlManagerImpl::CharacterControlManagerImpl(InternalPhysicsUtils& p_utils) : m_utils(p_utils)
         {
             m_manager = PxCreateControllerManager(*m_utils.m_worldScene);
@@ -16,14 +46,14 @@ namespace DoremiEngine
 
         bool CharacterControlManagerImpl::IsSleeping(int p_id)
         {
-            if(m_controllers.find(p_id) == m_controllers.end())
+            if(!m_controllers.Contains(p_id))
             {
                 cout << "Char controller IsSleeping went wrong" << endl;
                 return false;
             }
             else
             {
-                return m_controllers[p_id]->getActor()->isSleeping();
+                return m_controllers.Get(p_id)->getActor()->isSleeping();
             }
         }
 
@@ -47,8 +77,9 @@ namespace DoremiEngine
             // Hard coded up vector
             desc.upDirection = PxVec3(0, 1, 0);
 
-            m_controllers[p_id] = m_manager->createController(desc);
-            m_IDsByControllers[m_controllers[p_id]] = p_id;
+            PxController* controller = m_manager->createController(desc);
+            m_controllers.Insert(p_id, controller);
+            SetActorEntityID(*controller->getActor(), p_id);
 
             // SetCallback(p_id, (1 << 0), (1 << 0));
             SetCallbackFiltering(p_id, 1, 1, 0, 0);
@@ -65,12 +96,13 @@ namespace DoremiEngine
             // EMPTY FILTERS!
             PxControllerFilters filters;
             // Check if controller exists
-            if(m_controllers.find(p_id) == m_controllers.end())
+            if(!m_controllers.Contains(p_id))
             {
                 // Controller did not exist
                 throw std::runtime_error("No controller exists with id: " + to_string(p_id));
             }
-            PxControllerCollisionFlags flags = m_controllers[p_id]->move(PxVec3(p_discplacement.x, p_discplacement.y, p_discplacement.z), 0, p_dt, filters);
+            PxControllerCollisionFlags flags =
+                m_controllers.Get(p_id)->move(PxVec3(p_discplacement.x, p_discplacement.y, p_discplacement.z), 0, p_dt, filters);
             if(flags & PxControllerCollisionFlag::eCOLLISION_DOWN)
             {
                 return true;
@@ -79,66 +111,104 @@ namespace DoremiEngine
             return false;
         }
 
+        void CharacterControlManagerImpl::MoveControllers(const vector<ControllerMove>& p_moves, float p_dt,
+                                                          vector<ControllerCollisionFlags>& o_collisionFlags)
+        {
+            const size_t moveCount = p_moves.size();
+            o_collisionFlags.assign(moveCount, ControllerCollisionFlags::none);
+
+            // Look up every controller once and order the moves by where the controllers are. Controllers next to each other
+            // query the same part of the scene, so the data PhysX touches is more likely to still be in the cache
+            m_orderedMoves.clear();
+            for(size_t i = 0; i < moveCount; ++i)
+            {
+                PxController* controller = m_controllers.Get(p_moves[i].id);
+                if(controller == nullptr)
+                {
+                    // Controller did not exist
+                    throw std::runtime_error("No controller exists with id: " + to_string(p_moves[i].id));
+                }
+                OrderedMove move;
+                move.locationCode = LocationCode(controller->getPosition());
+                move.moveIndex = static_cast<uint32_t>(i);
+                move.controller = controller;
+                m_orderedMoves.push_back(move);
+            }
+            // Stable so controllers in the same cell keep the order they were given in, which keeps the result deterministic
+            stable_sort(m_orderedMoves.begin(), m_orderedMoves.end(),
+                        [](const OrderedMove& p_first, const OrderedMove& p_second) { return p_first.locationCode < p_second.locationCode; });
+
+            // Every controller is moved with the same (empty) filters
+            const PxControllerFilters filters;
+            for(auto& move : m_orderedMoves)
+            {
+                const XMFLOAT3& displacement = p_moves[move.moveIndex].displacement;
+                const PxVec3 pxDisplacement = PxVec3(displacement.x, displacement.y, displacement.z);
+                const PxControllerCollisionFlags flags = move.controller->move(pxDisplacement, 0, p_dt, filters);
+                o_collisionFlags[move.moveIndex] = static_cast<ControllerCollisionFlags>(static_cast<PxU8>(flags));
+            }
+        }
+
         XMFLOAT3 CharacterControlManagerImpl::GetPosition(int p_id)
         {
             // Check if controller exists
-            if(m_controllers.find(p_id) == m_controllers.end())
+            if(!m_controllers.Contains(p_id))
             {
                 // Controller did not exist
                 throw std::runtime_error("No controller exists with id: " + to_string(p_id));
             }
-            PxExtendedVec3 p = m_controllers[p_id]->getPosition();
+            PxExtendedVec3 p = m_controllers.Get(p_id)->getPosition();
             return XMFLOAT3(static_cast<float>(p.x), static_cast<float>(p.y), static_cast<float>(p.z));
         }
 
         XMFLOAT4 CharacterControlManagerImpl::GetOrientation(int p_id)
         {
             // Check if controller exists
-            if(m_controllers.find(p_id) == m_controllers.end())
+            if(!m_controllers.Contains(p_id))
             {
                 // Controller did not exist
                 throw std::runtime_error("No controller exists with id: " + to_string(p_id));
             }
-            PxQuat q = m_controllers[p_id]->getActor()->getGlobalPose().q;
+            PxQuat q = m_controllers.Get(p_id)->getActor()->getGlobalPose().q;
             return XMFLOAT4(q.x, q.y, q.z, q.w);
         }
 
         void CharacterControlManagerImpl::SetPosition(int p_id, XMFLOAT3 p_position)
         {
             // Check if controller exists
-            if(m_controllers.find(p_id) == m_controllers.end())
+            if(!m_controllers.Contains(p_id))
             {
                 // Controller did not exist
                 throw std::runtime_error("No controller exists with id: " + to_string(p_id));
             }
             if(p_id == 502)
             {
-                m_controllers[p_id]->setFootPosition(PxExtendedVec3(p_position.x, p_position.y, p_position.z));
+                m_controllers.Get(p_id)->setFootPosition(PxExtendedVec3(p_position.x, p_position.y, p_position.z));
             }
             else
             {
-                m_controllers[p_id]->setPosition(PxExtendedVec3(p_position.x, p_position.y, p_position.z));
+                m_controllers.Get(p_id)->setPosition(PxExtendedVec3(p_position.x, p_position.y, p_position.z));
             }
         }
 
         void CharacterControlManagerImpl::SetCallbackFiltering(int p_bodyID, int p_thisIdMask, int p_notifyTouchOthersMask,
                                                                int p_notifyLeaveOthersMask, int p_ignoreOthersMask)
         {
-            if(m_controllers.find(p_bodyID) == m_controllers.end())
+            if(!m_controllers.Contains(p_bodyID))
             {
                 cout << "Physics. Character Controllers. SetCallBackFiltering. No such controller exists with ID: " << p_bodyID << endl;
                 return;
             }
             PxFilterData filterData = PxFilterData(p_thisIdMask, p_notifyTouchOthersMask, p_notifyLeaveOthersMask, p_ignoreOthersMask);
             PxShape* shape;
-            m_controllers.at(p_bodyID)->getActor()->getShapes(&shape, 1);
+            m_controllers.Get(p_bodyID)->getActor()->getShapes(&shape, 1);
             shape->setSimulationFilterData(filterData);
         }
 
         void CharacterControlManagerImpl::SetCallback(int p_bodyID, int p_filterGroup, int p_filterMask)
         {
             // Check if controller exists
-            if(m_controllers.find(p_bodyID) == m_controllers.end())
+            if(!m_controllers.Contains(p_bodyID))
             {
                 // Controller did not exist
                 throw std::runtime_error("No controller exists with id: " + to_string(p_bodyID));
@@ -146,7 +216,7 @@ namespace DoremiEngine
             PxFilterData filterData;
             filterData.word0 = p_filterGroup; // Own ID
             filterData.word1 = p_filterMask; // ID mask to filter pairs that trigger contact callback
-            PxRigidActor* actor = m_controllers[p_bodyID]->getActor();
+            PxRigidActor* actor = m_controllers.Get(p_bodyID)->getActor();
             uint32_t numShapes = actor->getNbShapes();
             // Magic allocation of memory (i think)
             PxShape** shapes = (PxShape**)m_utils.m_allocator.allocate(sizeof(PxShape*) * numShapes, 0, __FILE__, __LINE__);
@@ -166,19 +236,33 @@ namespace DoremiEngine
         void CharacterControlManagerImpl::SetDrain(int p_id, bool p_isDrain)
         {
             // Check if controller exists
-            if(m_controllers.find(p_id) == m_controllers.end())
+            if(!m_controllers.Contains(p_id))
             {
                 // Controller did not exist
                 throw std::runtime_error("Physics error: Cannot set controller to drain: No controller exists with id: " + to_string(p_id));
             }
             PxShape* shape;
-            m_controllers[p_id]->getActor()->getShapes(&shape, 1);
+            m_controllers.Get(p_id)->getActor()->getShapes(&shape, 1);
             shape->setFlag(PxShapeFlag::ePARTICLE_DRAIN, true);
         }
 
         void CharacterControlManagerImpl::SetCallbackClass(PxUserControllerHitReport* p_callback) { m_controllerCallback = p_callback; }
 
-        unordered_map<PxController*, int> CharacterControlManagerImpl::GetIdsByControllers() { return m_IDsByControllers; }
+        int CharacterControlManagerImpl::GetIDByActor(const PxActor* p_actor) const
+        {
+            const int id = GetActorEntityID(p_actor);
+            PxController* controller = m_controllers.Get(id);
+            if(p_actor == nullptr || controller == nullptr || controller->getActor() != p_actor)
+            {
+                return -1;
+            }
+            return id;
+        }
+
+        int CharacterControlManagerImpl::GetIDByController(const PxController* p_controller) const
+        {
+            return p_controller != nullptr ? GetIDByActor(p_controller->getActor()) : -1;
+        }
 
         PxControllerBehaviorFlags CharacterControlManagerImpl::getBehaviorFlags(const PxShape& shape, const PxActor& actor)
         {
@@ -192,10 +276,12 @@ namespace DoremiEngine
 
         void CharacterControlManagerImpl::RemoveCharacterController(int p_bodyID)
         {
-            // Erases the character controller in both maps.
-            m_controllers[p_bodyID]->release();
-            m_IDsByControllers.erase(m_controllers[p_bodyID]);
-            m_controllers.erase(p_bodyID);
+            if(!m_controllers.Contains(p_bodyID))
+            {
+                return;
+            }
+            m_controllers.Get(p_bodyID)->release();
+            m_controllers.Erase(p_bodyID);
         }
     }
 }
\ No newline at end of file
@@ -30,7 +30,7 @@ namespace DoremiEngine
 
         void FluidManagerImpl::SetParticleEmitterData(int p_id, ParticleEmitterData p_data) { m_emitters[p_id]->SetData(p_data); }
 
-        vector<int> FluidManagerImpl::GetDrainsHit(int p_id)
+        const vector<int>& FluidManagerImpl::GetDrainsHit(int p_id)
         {
             // Secure that the emitter exists
             if(m_emitters.find(p_id) == m_emitters.end())
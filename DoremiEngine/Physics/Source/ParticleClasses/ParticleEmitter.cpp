@@ -1,10 +1,14 @@
 // This class
 #include <Internal/ParticleClasses/ParticleEmitter.hpp>
+#include <Internal/ParticleClasses/ParticleBitmap.hpp>
 //#include <FluidManager.hpp> // Included for the sake of particle data. Kinda silly, really
 #include <Internal/PhysicsModuleImplementation.hpp>
 
 // 3rd parties
 
+#include <algorithm>
+#include <bitset>
+#include <cstring>
 #include <iostream>
 using namespace std;
 
@@ -15,9 +19,15 @@ namespace DoremiEngine
     namespace Physics
     {
         ParticleEmitter::ParticleEmitter(ParticleEmitterData p_data, InternalPhysicsUtils& p_utils)
-            : m_this(p_data), m_utils(p_utils), m_timeSinceLast(0)
+            : m_this(p_data), m_lifeTime(0), m_validRange(0), m_utils(p_utils), m_timeSinceLast(0)
         {
             m_nextIndex = 0;
+            m_particlesLifeTime.resize(PARTICLE_MAX_COUNT, 0.0f);
+            m_positions.resize(PARTICLE_MAX_COUNT);
+            m_velocities.resize(PARTICLE_MAX_COUNT);
+            m_validBitmap.resize(ParticleBitmap::WordCount(PARTICLE_MAX_COUNT), 0);
+            m_drainCollided.reserve(PARTICLE_MAX_COUNT);
+            m_indicesToRelease.reserve(PARTICLE_MAX_COUNT);
             m_particleSystem = m_utils.m_physics->createParticleSystem(PARTICLE_MAX_COUNT);
             m_particleSystem->setMaxMotionDistance(PARTICLE_MAX_MOTION_DISTANCE);
             m_particleSystem->setParticleReadDataFlag(PxParticleReadDataFlag::eVELOCITY_BUFFER, true);
@@ -33,29 +43,20 @@ namespace DoremiEngine
 
         void ParticleEmitter::GetPositions(vector<XMFLOAT3>& o_positions)
         {
-            // This is a bit harder than it really ought to be...
-            // Important to lock data
-            LockParticleData();
-            // Get the positions
-            PxStrideIterator<const PxVec3> positions = m_readData->positionBuffer;
-            // And the flags (so we know that the particles are valid)
-            PxStrideIterator<const PxParticleFlags> flags = m_readData->flagsBuffer;
-
-            uint32_t numParticles = m_readData->validParticleRange;
-            for(uint32_t i = 0; i < numParticles; i++)
+            const size_t firstNew = o_positions.size();
+            size_t count = 0;
+            const size_t wordCount = ParticleBitmap::WordCount(m_validRange);
+            for(size_t i = 0; i < wordCount; ++i)
             {
-                // Check valid flag
-                if(flags[i] & PxParticleFlag::eVALID)
-                {
-                    // Save the particle position
-                    o_positions.push_back(XMFLOAT3(positions[i].x, positions[i].y, positions[i].z));
-                }
+                count += bitset<32>(m_validBitmap[i]).count();
             }
-            // Unlock once we're done
-            UnlockParticleData();
+            o_positions.resize(firstNew + count);
+            XMFLOAT3* output = o_positions.data() + firstNew;
+            ParticleBitmap::ForEachSetBit(m_validBitmap.data(), wordCount,
+                                          [this, &output](const uint32_t& p_index) { *output++ = m_positions[p_index]; });
         }
 
-        vector<int> ParticleEmitter::GetDrainsHit() { return m_drainsHit; }
+        const vector<int>& ParticleEmitter::GetDrainsHit() { return m_drainsHit; }
 
         const vector<XMFLOAT3>& ParticleEmitter::GetRemovedParticlesPositions() { return m_removedParticlesPositions; }
 
@@ -65,99 +66,116 @@ namespace DoremiEngine
 
         void ParticleEmitter::UnlockParticleData() { m_readData->unlock(); }
 
-        void ParticleEmitter::UpdateParticleLifeTimeAndRemoveExpired(float p_dt)
+        namespace
         {
-            std::vector<PxU32> t_indicesToRemove;
-            // Get particle indexData
-            PX_ASSERT(t_particleData);
-            // Kolla om vi har ngra particlar som r valid annars ondigt att ens brja uppdatera
-            if(m_readData->validParticleRange > 0)
+            // Copies p_count elements from a PhysX buffer, in one memcpy if the buffer is tightly packed
+            void CopyStrided(const PxStrideIterator<const PxVec3>& p_source, const uint32_t& p_count, XMFLOAT3* o_destination)
             {
-
-                for(PxU32 i = 0; i <= (m_readData->validParticleRange - 1) >> 5; i++)
+                static_assert(sizeof(PxVec3) == sizeof(XMFLOAT3), "PxVec3 and XMFLOAT3 have to match to copy positions");
+                if(p_count == 0 || p_source.ptr() == nullptr)
                 {
-
-                    for(PxU32 j = m_readData->validParticleBitmap[i]; j; j &= j - 1)
-                    {
-                        // TODOXX super unsafe. I am not sure what i am doing here. I was following a tutorial and a function they used was missing.
-                        // This seems to be what they did essentially but WARNING!!
-                        // Get index from physx. you have to use bitoperations from their bittable for indices. Its pretty complicated and Im not 100%
-                        // sure this code is safe
-                        unsigned long b;
-                        _BitScanForward(&b, j);
-                        PxU32 t_index = (i << 5 | (PxU32)b);
-                        // Update particle lifetime
-                        m_particlesLifeTime[t_index] -= p_dt;
-                        // CHeck if particle is still alive
-                        if((m_particlesLifeTime[t_index]) < 0.0)
-                        {
-                            m_particlesLifeTime[t_index] = 0;
-                            t_indicesToRemove.push_back(t_index);
-                        }
-                    }
+                    return;
+                }
+                if(p_source.stride() == sizeof(PxVec3))
+                {
+                    memcpy(o_destination, p_source.ptr(), sizeof(PxVec3) * p_count);
+                    return;
+                }
+                const uint8_t* source = reinterpret_cast<const uint8_t*>(p_source.ptr());
+                for(uint32_t i = 0; i < p_count; ++i)
+                {
+                    memcpy(&o_destination[i], source + i * p_source.stride(), sizeof(PxVec3));
                 }
             }
-            else
+        }
+
+        void ParticleEmitter::ReadParticleData()
+        {
+            LockParticleData();
+            m_validRange = min<uint32_t>(m_readData->validParticleRange, PARTICLE_MAX_COUNT);
+            const size_t wordCount = ParticleBitmap::WordCount(m_validRange);
+            if(m_validRange > 0)
             {
-                // Do nothing
+                CopyStrided(m_readData->positionBuffer, m_validRange, m_positions.data());
+                CopyStrided(m_readData->velocityBuffer, m_validRange, m_velocities.data());
+                memcpy(m_validBitmap.data(), m_readData->validParticleBitmap, sizeof(uint32_t) * wordCount);
             }
-            // Release the data we have been looking at
-            m_readData->unlock();
-            // Needs to not crash
-            if(t_indicesToRemove.size() > 0)
+            // PhysX leaves the bits past the range undefined
+            if((m_validRange & 31) != 0)
             {
-                // Need Stride for releaseparticle.
-                PxStrideIterator<const PxU32> t_indexData(&t_indicesToRemove[0]);
-                // Now release the particles that we want to remove
-                m_particleSystem->releaseParticles(static_cast<PxU32>(t_indicesToRemove.size()), t_indexData);
-                // TODOLH om vi skaffar indexPool kr m_indexpool->freeIndices(indices.size(), indexData);
+                m_validBitmap[wordCount - 1] &= (1u << (m_validRange & 31)) - 1;
             }
-        }
 
-        void ParticleEmitter::RemoveDrainCollidedParticles(float p_dt)
-        {
-            // This is a bit harder than it really ought to be...
-            PxStrideIterator<const PxVec3> positions = m_readData->positionBuffer;
-            PxStrideIterator<const PxVec3> velocities = m_readData->velocityBuffer;
+            // Flags are only looked at for valid particles, and only drain collisions are kept
+            m_drainCollided.clear();
             PxStrideIterator<const PxParticleFlags> flags = m_readData->flagsBuffer;
+            ParticleBitmap::ForEachSetBit(m_validBitmap.data(), wordCount, [this, &flags](const uint32_t& p_index) {
+                if(flags[p_index] & PxParticleFlag::eCOLLISION_WITH_DRAIN)
+                {
+                    m_drainCollided.push_back(p_index);
+                }
+            });
+            UnlockParticleData();
+        }
 
-            vector<int> indicesOfParticlesToBeReleased;
+        void ParticleEmitter::UpdateParticleLifeTimeAndRemoveExpired(float p_dt)
+        {
+            // Every lifetime in the range is decremented in one pass, the bitmap is only walked to find the expired ones
+            ParticleBitmap::DecrementLifeTimes(m_particlesLifeTime.data(), m_validRange, p_dt);
+            ParticleBitmap::ForEachSetBit(m_validBitmap.data(), ParticleBitmap::WordCount(m_validRange), [this](const uint32_t& p_index) {
+                if(m_particlesLifeTime[p_index] < 0.0f)
+                {
+                    m_particlesLifeTime[p_index] = 0;
+                    m_indicesToRelease.push_back(p_index);
+                    ParticleBitmap::Clear(m_validBitmap.data(), p_index);
+                }
+            });
+        }
 
-            uint32_t numParticles = m_readData->validParticleRange;
-            for(uint32_t i = 0; i < numParticles; i++)
+        void ParticleEmitter::RemoveDrainCollidedParticles(float p_dt)
+        {
+            // Only particles which were flagged are looked at
+            for(auto& index : m_drainCollided)
             {
-                // Check if particles are supposed to be removed
-                XMFLOAT3 position = XMFLOAT3(positions[i].x, positions[i].y, positions[i].z);
-                XMFLOAT3 velocity = XMFLOAT3(velocities[i].x, velocities[i].y, velocities[i].z);
-                XMVECTOR velVec = XMLoadFloat3(&velocity);
-                XMVECTOR posVec = XMLoadFloat3(&position);
+                if(!ParticleBitmap::IsSet(m_validBitmap.data(), index))
+                {
+                    // Already released since it expired
+                    continue;
+                }
+                /// Particle should be removed
+                // Add index to release list
+                m_indicesToRelease.push_back(index);
+                ParticleBitmap::Clear(m_validBitmap.data(), index);
+
+                XMFLOAT3 position = m_positions[index];
+                XMFLOAT3 velocity;
                 // posVec -= velVec; this should be necessary but somehow it isn't. Possibly related to m_this.size?
-                velVec = XMVector3Normalize(velVec);
-                XMStoreFloat3(&velocity, velVec); // TODOJB Remove normalization once it's fixed in CastRay
-                XMStoreFloat3(&position, posVec);
-                if(flags[i] & (PxParticleFlag::eCOLLISION_WITH_DRAIN)) // | PxParticleFlag::eVALID))
+                // TODOJB Remove normalization once it's fixed in CastRay
+                XMStoreFloat3(&velocity, XMVector3Normalize(XMLoadFloat3(&m_velocities[index])));
+                // m_drainsHit.push_back(m_utils.m_rayCastManager->CastRay(position, velocity, 5)); // Zero might turn up buggy
+                // Use internal method since we want to know which type of body we hit
+                int flags;
+                int id = m_utils.m_rayCastManager->CastSweep(position, velocity, m_this.m_size, 0.2f, flags);
+                m_drainsHit.push_back(id);
+                // We don't want to notify the game when particles hit kinematic objects
+                // Outcommented since it doesn't work. TODOJB fix
+                if(flags == 3)
                 {
-                    /// Particle should be removed
-                    // Add index to release list
-                    indicesOfParticlesToBeReleased.push_back(i);
-                    // m_drainsHit.push_back(m_utils.m_rayCastManager->CastRay(position, velocity, 5)); // Zero might turn up buggy
-                    // Use internal method since we want to know which type of body we hit
-                    int flags;
-                    int id = m_utils.m_rayCastManager->CastSweep(position, velocity, m_this.m_size, 0.2f, flags);
-                    m_drainsHit.push_back(id);
-                    // We don't want to notify the game when particles hit kinematic objects
-                    // Outcommented since it doesn't work. TODOJB fix
-                    if(flags == 3)
-                    {
-                        // Add the position to a the list of removed particles positions
-                        m_removedParticlesPositions.push_back(position);
-                    }
+                    // Add the position to a the list of removed particles positions
+                    m_removedParticlesPositions.push_back(position);
                 }
             }
-            if(indicesOfParticlesToBeReleased.size() != 0)
+        }
+
+        void ParticleEmitter::ReleaseQueuedParticles()
+        {
+            if(m_indicesToRelease.size() > 0)
             {
-                PxStrideIterator<const PxU32> inicesPX(reinterpret_cast<PxU32*>(&indicesOfParticlesToBeReleased[0]));
-                m_particleSystem->releaseParticles(indicesOfParticlesToBeReleased.size(), inicesPX);
+                // Need Stride for releaseparticle.
+                PxStrideIterator<const PxU32> indexData(m_indicesToRelease.data());
+                m_particleSystem->releaseParticles(static_cast<PxU32>(m_indicesToRelease.size()), indexData);
+                // TODOLH om vi skaffar indexPool kr m_indexpool->freeIndices(indices.size(), indexData);
+                m_indicesToRelease.clear();
             }
         }
 
@@ -266,16 +284,15 @@ namespace DoremiEngine
         {
             m_removedParticlesPositions.clear();
             m_drainsHit.clear();
-            // Lock the read data
-            LockParticleData();
+            // Copy the particle data, the read data is locked only while copying
+            ReadParticleData();
             // Remove old (aged) particles
             UpdateParticleLifeTimeAndRemoveExpired(p_dt);
-            // Spray new particles
-            UpdateParticleEmission(p_dt);
             // Remove particles that have collided with a drain
             RemoveDrainCollidedParticles(p_dt);
-            // Unlock particle data
-            UnlockParticleData();
+            ReleaseQueuedParticles();
+            // Spray new particles
+            UpdateParticleEmission(p_dt);
         }
     }
 }
\ No newline at end of file
@@ -0,0 +1,96 @@
+#include <Internal/PhysicsCpuDispatcher.hpp>
+
+#include <Utility/Utilities/Include/Threading/WorkStealingThreadPool.hpp>
+#include <Utility/Utilities/Include/Chrono/Timer.hpp>
+
+#include <map>
+#include <string>
+
+namespace DoremiEngine
+{
+    namespace Physics
+    {
+        PhysicsCpuDispatcher::PhysicsCpuDispatcher(Doremi::Utilities::Threading::WorkStealingThreadPool& p_threadPool) : m_threadPool(p_threadPool)
+        {
+            // One extra for tasks run by threads outside the pool
+            const uint32_t timingCount = m_threadPool.GetThreadCount() + 1;
+            for(uint32_t i = 0; i < timingCount; ++i)
+            {
+                m_workerTimings.push_back(std::unique_ptr<WorkerTimings>(new WorkerTimings()));
+            }
+        }
+
+        PhysicsCpuDispatcher::~PhysicsCpuDispatcher() {}
+
+        void PhysicsCpuDispatcher::submitTask(PxBaseTask& p_task)
+        {
+            PxBaseTask* task = &p_task;
+            m_threadPool.Submit([this, task]() { RunTask(*task); });
+        }
+
+        PxU32 PhysicsCpuDispatcher::getWorkerCount() const { return m_threadPool.GetThreadCount(); }
+
+        void PhysicsCpuDispatcher::RunTask(PxBaseTask& p_task)
+        {
+            const char* name = p_task.getName() != nullptr ? p_task.getName() : "Unnamed";
+            Doremi::Utilities::Chrono::Timer timer;
+            p_task.run();
+            const double time = timer.Tick().GetElapsedTimeInSeconds();
+
+            // Written before release, after that the simulation may have finished and the dispatcher could be gone
+            {
+                WorkerTimings& timings = *m_workerTimings[m_threadPool.GetCurrentWorkerIndex()];
+                std::lock_guard<std::mutex> lock(timings.mutex);
+                TaskTiming& taskTiming = timings.tasks[name];
+                ++taskTiming.count;
+                taskTiming.totalTime += time;
+                if(time > taskTiming.maxTime)
+                {
+                    taskTiming.maxTime = time;
+                }
+                ++timings.worker.taskCount;
+                timings.worker.busyTime += time;
+            }
+            p_task.release();
+        }
+
+        void PhysicsCpuDispatcher::GetStatistics(PhysicsDispatchStatistics& o_statistics) const
+        {
+            // Tasks with the same name from different workers are merged, sorted by name to make the output stable
+            std::map<std::string, PhysicsTaskStatistics> tasksByName;
+            o_statistics.workers.clear();
+            for(auto& timings : m_workerTimings)
+            {
+                std::lock_guard<std::mutex> lock(timings->mutex);
+                o_statistics.workers.push_back(timings->worker);
+                for(auto& task : timings->tasks)
+                {
+                    PhysicsTaskStatistics& statistics = tasksByName[task.first];
+                    statistics.count += task.second.count;
+                    statistics.totalTime += task.second.totalTime;
+                    if(task.second.maxTime > statistics.maxTime)
+                    {
+                        statistics.maxTime = task.second.maxTime;
+                    }
+                }
+            }
+
+            o_statistics.tasks.clear();
+            for(auto& task : tasksByName)
+            {
+                o_statistics.tasks.push_back(task.second);
+                o_statistics.tasks.back().name = task.first;
+            }
+        }
+
+        void PhysicsCpuDispatcher::ResetStatistics()
+        {
+            for(auto& timings : m_workerTimings)
+            {
+                std::lock_guard<std::mutex> lock(timings->mutex);
+                timings->tasks.clear();
+                timings->worker = PhysicsWorkerStatistics();
+            }
+        }
+    }
+}
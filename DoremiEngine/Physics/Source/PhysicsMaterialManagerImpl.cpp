@@ -9,11 +9,11 @@ namespace DoremiEngine
 
         int PhysicsMaterialManagerImpl::CreateMaterial(float p_staticFriction, float p_dynamicFriction, float p_restitution)
         {
-            m_materials[m_nextMaterial] = m_utils.m_physics->createMaterial(p_staticFriction, p_dynamicFriction, p_restitution);
+            m_materials.Insert(m_nextMaterial, m_utils.m_physics->createMaterial(p_staticFriction, p_dynamicFriction, p_restitution));
             m_nextMaterial++;
             return m_nextMaterial - 1;
         }
 
-        PxMaterial* PhysicsMaterialManagerImpl::GetMaterial(int p_id) { return m_materials[p_id]; }
+        PxMaterial* PhysicsMaterialManagerImpl::GetMaterial(int p_id) { return m_materials.Get(p_id); }
     }
 }
\ No newline at end of file
@@ -1,26 +1,55 @@
 #include <Internal/PhysicsModuleImplementation.hpp>
 
 #include <DoremiEngine/Core/Include/SharedContext.hpp>
+#include <DoremiEngine/Configuration/Include/ConfigurationModule.hpp>
 #include <DoremiEngine/Logging/Include/LoggingModule.hpp>
 #include <DoremiEngine/Logging/Include/SubmoduleManager.hpp>
 #include <DoremiEngine/Logging/Include/Logger/Logger.hpp>
+#include <Utility/Utilities/Include/Memory/MemoryAllocator.hpp>
+
+#include <algorithm>
 
 namespace DoremiEngine
 {
     namespace Physics
     {
-        PhysicsModuleImplementation::PhysicsModuleImplementation(const Core::SharedContext& p_sharedContext) : m_sharedContext(p_sharedContext)
+        PhysicsModuleImplementation::PhysicsModuleImplementation(const Core::SharedContext& p_sharedContext)
+            : m_sharedContext(p_sharedContext), m_simulationTime(0), m_simulationCount(0), m_simulating(false), m_stepLength(0), m_scratchSize(0)
         {
             m_logger = &m_sharedContext.GetLoggingModule().GetSubModuleManager().GetLogger();
+
+            using namespace Doremi::Utilities::Logging;
+            m_stepTelemetrySchema = m_logger->RegisterDataSchema("PhysicsStep", {{"stepLength", TelemetryFieldType::FLOAT},
+                                                                                 {"simulationTime", TelemetryFieldType::DOUBLE},
+                                                                                 {"collisionPairs", TelemetryFieldType::UINT32},
+                                                                                 {"triggerPairs", TelemetryFieldType::UINT32}});
         }
 
-        PhysicsModuleImplementation::~PhysicsModuleImplementation() {}
+        const uint32_t PhysicsModuleImplementation::SCRATCH_GRANULARITY;
+
+        PhysicsModuleImplementation::~PhysicsModuleImplementation() { Doremi::Utilities::Memory::MemoryAllocator::FreePages(m_scratch); }
 
         void PhysicsModuleImplementation::Startup()
         {
             // Start physX
             m_utils.m_foundation = PxCreateFoundation(PX_PHYSICS_VERSION, m_utils.m_allocator, m_utils.m_errorCallback);
             m_utils.m_physics = PxCreatePhysics(PX_PHYSICS_VERSION, *m_utils.m_foundation, PxTolerancesScale(), true);
+            m_utils.m_threadPool = &m_sharedContext.GetThreadPool();
+
+            const Configuration::ConfiguartionInfo& configuration = m_sharedContext.GetConfigurationModule().GetAllConfigurationValues();
+            BroadPhaseSettings broadPhaseSettings;
+            broadPhaseSettings.type = configuration.PhysicsBroadPhase == "MBP" ? PxBroadPhaseType::eMBP : PxBroadPhaseType::eSAP;
+            broadPhaseSettings.subdivisions = static_cast<uint32_t>(std::max(configuration.PhysicsBroadPhaseSubdivisions, 1));
+            broadPhaseSettings.staticPruningStructure = configuration.PhysicsStaticPruningStructure != 0;
+            m_utils.m_broadPhaseHandler = new BroadPhaseHandler(broadPhaseSettings);
+
+            // Scratch memory on the same pages and node as the big arrays of the game
+            if(configuration.PhysicsScratchKilobytes > 0)
+            {
+                using namespace Doremi::Utilities::Memory;
+                m_scratchSize = (configuration.PhysicsScratchKilobytes * 1024 + SCRATCH_GRANULARITY - 1) / SCRATCH_GRANULARITY * SCRATCH_GRANULARITY;
+                m_scratch = MemoryAllocator::AllocatePages(m_scratchSize, PageOptions(configuration.LargePages != 0, configuration.NumaNode));
+            }
 
             // Create world scene TODOJB create scene handler for this kind of job
             CreateWorldScene();
@@ -35,31 +64,97 @@ namespace DoremiEngine
             // Make some other important thingies
             m_utils.m_characterControlManager->SetCallbackClass(this);
 
-            PxVisualDebuggerConnection* theConnection =
-                PxVisualDebuggerExt::createConnection(m_utils.m_physics->getPvdConnectionManager(), "127.0.0.1", 5425, 100,
-                                                      PxVisualDebuggerExt::getAllConnectionFlags());
-            if(theConnection) theConnection->release();
+            // Only connect to a visual debugger if one is configured, trying to connect stalls startup when none is running
+            if(!configuration.PhysicsVisualDebuggerIP.empty())
+            {
+                PxVisualDebuggerConnection* theConnection = PxVisualDebuggerExt::createConnection(
+                    m_utils.m_physics->getPvdConnectionManager(), configuration.PhysicsVisualDebuggerIP.c_str(),
+                    configuration.PhysicsVisualDebuggerPort, 100, PxVisualDebuggerExt::getAllConnectionFlags());
+                if(theConnection) theConnection->release();
+            }
         }
 
         void PhysicsModuleImplementation::Shutdown()
         {
-            m_collisionPairs.clear();
-            m_triggerPairs.clear();
-            m_leftCollisionPairs.clear();
+            // A step left running would otherwise write to the scene while it is released
+            EndSimulate();
+
+            // Log how the simulation was spread over the workers
+            using namespace Doremi::Utilities::Logging;
+            PhysicsDispatchStatistics statistics;
+            GetDispatchStatistics(statistics);
+            double busyTime = 0;
+            for(size_t i = 0; i < statistics.workers.size(); ++i)
+            {
+                busyTime += statistics.workers[i].busyTime;
+                m_logger->LogText(LogTag::PHYSICS, LogLevel::INFO, "Physics worker %u: %u tasks, %f s", static_cast<uint32_t>(i),
+                                  statistics.workers[i].taskCount, statistics.workers[i].busyTime);
+            }
+            for(auto& task : statistics.tasks)
+            {
+                m_logger->LogText(LogTag::PHYSICS, LogLevel::INFO, "Physics task %s: %u runs, %f s total, %f s max", task.name.c_str(), task.count,
+                                  task.totalTime, task.maxTime);
+            }
+            if(statistics.simulationTime > 0)
+            {
+                m_logger->LogText(LogTag::PHYSICS, LogLevel::INFO, "Physics simulated %u times in %f s, on average %f workers busy",
+                                  statistics.simulationCount, statistics.simulationTime, busyTime / statistics.simulationTime);
+            }
+            if(m_utils.m_broadPhaseHandler->GetOutOfBoundsCount() > 0)
+            {
+                m_logger->LogText(LogTag::PHYSICS, LogLevel::WARNING, "Physics actors left the broadphase regions %u times",
+                                  m_utils.m_broadPhaseHandler->GetOutOfBoundsCount());
+            }
+
+            ClearCollisionPairs();
         }
 
         void PhysicsModuleImplementation::Update(float p_dt)
+        {
+            BeginSimulate(p_dt);
+            EndSimulate();
+        }
+
+        void PhysicsModuleImplementation::BeginSimulate(float p_dt)
         {
             try
             {
-                // Start by clearing the list of collision pairs (WARNING potentially bad idea)
-                m_collisionPairs.clear();
-                m_triggerPairs.clear();
-                m_leftCollisionPairs.clear();
                 m_utils.m_fluidManager->Update(p_dt);
-                m_utils.m_worldScene->simulate(p_dt);
+                m_simulationTimer.Reset();
+                m_stepLength = p_dt;
+                m_utils.m_worldScene->simulate(p_dt, nullptr, m_scratch.memory, m_scratchSize);
+                m_simulating = true;
+            }
+            catch(const std::exception& exception)
+            {
+                using namespace Doremi::Utilities::Logging;
+                m_logger->LogText(LogTag::GAME, LogLevel::FATAL_ERROR, "Exception: %s", exception.what());
+                m_sharedContext.RequestApplicationExit();
+            }
+        }
+
+        void PhysicsModuleImplementation::EndSimulate()
+        {
+            if(!m_simulating)
+            {
+                return;
+            }
+            try
+            {
+                // The pairs of the last step are kept until now so they can be read while the next step runs
+                ClearCollisionPairs();
                 m_utils.m_rigidBodyManager->ClearRecentlyWakeStatusLists();
+                // The contact callbacks are called from here
                 m_utils.m_worldScene->fetchResults(true);
+                // Triggers only get pairs from the callbacks, so they can be sorted once here. Stable to keep the order of each trigger
+                stable_sort(m_triggerPairs.begin(), m_triggerPairs.end(),
+                            [](const CollisionPair& p_first, const CollisionPair& p_second) { return p_first.firstID < p_second.firstID; });
+                m_simulating = false;
+                const double simulationTime = m_simulationTimer.Tick().GetElapsedTimeInSeconds();
+                m_simulationTime += simulationTime;
+                ++m_simulationCount;
+                m_logger->LogData(m_stepTelemetrySchema, m_stepLength, simulationTime, static_cast<uint32_t>(m_collisionPairs.size()),
+                                  static_cast<uint32_t>(m_triggerPairs.size()));
             }
             catch(const std::exception& exception)
             {
@@ -75,9 +170,72 @@ namespace DoremiEngine
         FluidManager& PhysicsModuleImplementation::GetFluidManager() { return *m_utils.m_fluidManager; }
         RayCastManager& PhysicsModuleImplementation::GetRayCastManager() { return *m_utils.m_rayCastManager; };
 
-        vector<CollisionPair> PhysicsModuleImplementation::GetCollisionPairs() { return m_collisionPairs; }
-        vector<CollisionPair> PhysicsModuleImplementation::GetTriggerPairs() { return m_triggerPairs; }
-        vector<CollisionPair> PhysicsModuleImplementation::GetLeftCollisionPairs() { return m_leftCollisionPairs; }
+        CollisionPairSpan PhysicsModuleImplementation::GetCollisionPairs()
+        {
+            return CollisionPairSpan(m_collisionPairs.data(), m_collisionPairs.size());
+        }
+
+        CollisionPairSpan PhysicsModuleImplementation::GetTriggerPairs() { return CollisionPairSpan(m_triggerPairs.data(), m_triggerPairs.size()); }
+
+        CollisionPairSpan PhysicsModuleImplementation::GetLeftCollisionPairs()
+        {
+            return CollisionPairSpan(m_leftCollisionPairs.data(), m_leftCollisionPairs.size());
+        }
+
+        CollisionPairSpan PhysicsModuleImplementation::GetCollisionPairsForBody(int p_bodyID)
+        {
+            // Character controllers add pairs when they move, so the index is rebuilt whenever it is out of date
+            if(m_collisionPairsByBody.size() != m_collisionPairs.size() * 2)
+            {
+                m_collisionPairsByBody.clear();
+                for(auto& pair : m_collisionPairs)
+                {
+                    m_collisionPairsByBody.push_back(pair);
+                    CollisionPair swapped;
+                    swapped.firstID = pair.secondID;
+                    swapped.secondID = pair.firstID;
+                    m_collisionPairsByBody.push_back(swapped);
+                }
+                stable_sort(m_collisionPairsByBody.begin(), m_collisionPairsByBody.end(),
+                            [](const CollisionPair& p_first, const CollisionPair& p_second) { return p_first.firstID < p_second.firstID; });
+            }
+            return FindPairsByFirstID(m_collisionPairsByBody, p_bodyID);
+        }
+
+        CollisionPairSpan PhysicsModuleImplementation::FindPairsByFirstID(const vector<CollisionPair>& p_sortedPairs, int p_id)
+        {
+            auto first = lower_bound(p_sortedPairs.begin(), p_sortedPairs.end(), p_id,
+                                     [](const CollisionPair& p_pair, int p_value) { return p_pair.firstID < p_value; });
+            auto last = upper_bound(first, p_sortedPairs.end(), p_id,
+                                    [](int p_value, const CollisionPair& p_pair) { return p_value < p_pair.firstID; });
+            if(first == last)
+            {
+                return CollisionPairSpan();
+            }
+            return CollisionPairSpan(&*first, static_cast<size_t>(last - first));
+        }
+
+        void PhysicsModuleImplementation::ClearCollisionPairs()
+        {
+            m_collisionPairs.clear();
+            m_triggerPairs.clear();
+            m_leftCollisionPairs.clear();
+            m_collisionPairsByBody.clear();
+        }
+
+        void PhysicsModuleImplementation::GetDispatchStatistics(PhysicsDispatchStatistics& o_statistics)
+        {
+            m_utils.m_dispatcher->GetStatistics(o_statistics);
+            o_statistics.simulationTime = m_simulationTime;
+            o_statistics.simulationCount = m_simulationCount;
+        }
+
+        void PhysicsModuleImplementation::ResetDispatchStatistics()
+        {
+            m_utils.m_dispatcher->ResetStatistics();
+            m_simulationTime = 0;
+            m_simulationCount = 0;
+        }
 
         // New fancier collision filter
         PxFilterFlags TestFilter2(PxFilterObjectAttributes attributes0, PxFilterData filterData0, PxFilterObjectAttributes attributes1,
@@ -181,16 +339,21 @@ namespace DoremiEngine
             PxSceneDesc sceneDesc(m_utils.m_physics->getTolerancesScale());
             // Gravity sounds straight forward
             sceneDesc.gravity = PxVec3(0.0f, -9.8f, 0.0f);
-            // Not too sure what this is. Probably related to how threads work
-            m_utils.m_dispatcher = PxDefaultCpuDispatcherCreate(2);
+            // PhysX runs its tasks on the engine thread pool, the number of threads is set by WorkerThreadCount in the configuration
+            m_utils.m_dispatcher = new PhysicsCpuDispatcher(m_sharedContext.GetThreadPool());
             sceneDesc.cpuDispatcher = m_utils.m_dispatcher;
             // Some way of filtering collisions. Use default shaders since we cba to write our own
             sceneDesc.filterShader = TestFilter2;
             // Notify PhysX that we want callbacks to be called here
             sceneDesc.simulationEventCallback = this;
+            // Lets the transform sync read only the bodies that moved
+            sceneDesc.flags |= PxSceneFlag::eENABLE_ACTIVETRANSFORMS;
+            // SAP or MBP, and where static geometry is kept for scene queries
+            m_utils.m_broadPhaseHandler->SetupSceneDesc(sceneDesc);
 
             // Create the scene
             m_utils.m_worldScene = m_utils.m_physics->createScene(sceneDesc);
+            m_utils.m_broadPhaseHandler->SceneCreated(*m_utils.m_worldScene);
 
             // Assign stuff to the global material (again, probably stupid to have this here)
             PxMaterial* groundMaterial = m_utils.m_physics->createMaterial(0.5, 0.5, 0.5);
@@ -212,97 +375,28 @@ namespace DoremiEngine
 
         void PhysicsModuleImplementation::onContact(const PxContactPairHeader& pairHeader, const PxContactPair* pairs, PxU32 nbPairs)
         {
-            m_utils.m_rigidBodyManager->GetIDsByBodies();
             for(size_t i = 0; i < nbPairs; i++)
             {
                 const PxContactPair& cp = pairs[i];
-                CollisionPair collisionPair;
-                // Check if this was a touch found collision callback
+                // Check if this was a touch found or touch lost collision callback
+                vector<CollisionPair>* pairList = nullptr;
                 if(cp.events & PxPairFlag::eNOTIFY_TOUCH_FOUND)
                 {
-                    /// Add first ID to collision pair
-                    // Check if the first actor was a rigid body
-                    if(m_utils.m_rigidBodyManager->GetIDsByBodies().find(pairHeader.actors[0]) != m_utils.m_rigidBodyManager->GetIDsByBodies().end())
-                    {
-                        collisionPair.firstID = m_utils.m_rigidBodyManager->GetIDsByBodies().find(pairHeader.actors[0])->second;
-                    }
-                    /*
-                    Wasn't a rigid body. Assume it is a character controller (pretty risky but should be fine as long as no one decides
-                    to assign a bunch of flags to particle systems. But that shouldn't happen. That's my country! Get out!)*/
-                    else
-                    {
-                        unordered_map<PxController*, int> idsByControllers = m_utils.m_characterControlManager->GetIdsByControllers();
-                        for(auto const& controller : idsByControllers)
-                        {
-                            if(controller.first->getActor() == pairHeader.actors[0])
-                            {
-                                collisionPair.firstID = controller.second;
-                            }
-                        }
-                    }
-                    /// Add second ID to collision pair
-                    // Check if the first actor was a rigid body
-                    if(m_utils.m_rigidBodyManager->GetIDsByBodies().find(pairHeader.actors[1]) != m_utils.m_rigidBodyManager->GetIDsByBodies().end())
-                    {
-                        collisionPair.secondID = m_utils.m_rigidBodyManager->GetIDsByBodies().find(pairHeader.actors[1])->second;
-                    }
-                    // Wasn't rigid body. Assume it is a character controller. Again, this should be fine
-                    else
-                    {
-                        unordered_map<PxController*, int> idsByControllers = m_utils.m_characterControlManager->GetIdsByControllers();
-                        for(auto const& controller : idsByControllers)
-                        {
-                            if(controller.first->getActor() == pairHeader.actors[1])
-                            {
-                                collisionPair.secondID = controller.second;
-                            }
-                        }
-                    }
-                    m_collisionPairs.push_back(collisionPair);
+                    pairList = &m_collisionPairs;
                 }
-                // Check if it was a touch lost collision (copy paste, yo!)
                 else if(cp.events & PxPairFlag::eNOTIFY_TOUCH_LOST)
                 {
-                    /// Add first ID to collision pair
-                    // Check if the first actor was a rigid body
-                    if(m_utils.m_rigidBodyManager->GetIDsByBodies().find(pairHeader.actors[0]) != m_utils.m_rigidBodyManager->GetIDsByBodies().end())
-                    {
-                        collisionPair.firstID = m_utils.m_rigidBodyManager->GetIDsByBodies().find(pairHeader.actors[0])->second;
-                    }
-                    /*
-                    Wasn't a rigid body. Assume it is a character controller (pretty risky but should be fine as long as no one decides
-                    to assign a bunch of flags to particle systems. But that shouldn't happen. That's my country! Get out!)*/
-                    else
-                    {
-                        unordered_map<PxController*, int> idsByControllers = m_utils.m_characterControlManager->GetIdsByControllers();
-                        for(auto const& controller : idsByControllers)
-                        {
-                            if(controller.first->getActor() == pairHeader.actors[0])
-                            {
-                                collisionPair.firstID = controller.second;
-                            }
-                        }
-                    }
-                    /// Add second ID to collision pair
-                    // Check if the first actor was a rigid body
-                    if(m_utils.m_rigidBodyManager->GetIDsByBodies().find(pairHeader.actors[1]) != m_utils.m_rigidBodyManager->GetIDsByBodies().end())
-                    {
-                        collisionPair.secondID = m_utils.m_rigidBodyManager->GetIDsByBodies().find(pairHeader.actors[1])->second;
-                    }
-                    // Wasn't rigid body. Assume it is a character controller. Again, this should be fine
-                    else
-                    {
-                        unordered_map<PxController*, int> idsByControllers = m_utils.m_characterControlManager->GetIdsByControllers();
-                        for(auto const& controller : idsByControllers)
-                        {
-                            if(controller.first->getActor() == pairHeader.actors[1])
-                            {
-                                collisionPair.secondID = controller.second;
-                            }
-                        }
-                    }
-                    m_leftCollisionPairs.push_back(collisionPair);
+                    pairList = &m_leftCollisionPairs;
                 }
+                else
+                {
+                    continue;
+                }
+                // Both rigid bodies and character controllers have their ID in the actor
+                CollisionPair collisionPair;
+                collisionPair.firstID = m_utils.GetIDByActor(pairHeader.actors[0]);
+                collisionPair.secondID = m_utils.GetIDByActor(pairHeader.actors[1]);
+                pairList->push_back(collisionPair);
             }
         }
 
@@ -316,28 +410,9 @@ namespace DoremiEngine
                 {
                     CollisionPair collisionPair;
                     // Get trigger ID
-                    collisionPair.firstID = m_utils.m_rigidBodyManager->GetIDsByBodies().find(pairs->triggerActor)->second;
-                    // Determine whether other actor is controller or rigid body
-                    if(m_utils.m_rigidBodyManager->GetIDsByBodies().find(pairs->otherActor) == m_utils.m_rigidBodyManager->GetIDsByBodies().end())
-                    {
-                        /*
-                        Was controller
-                        Loop through all controllers to see which it is. This is silly, but because PxController and PxActor are two
-                        Entierly different things, we have to do it this way. I think...*/
-                        unordered_map<PxController*, int> idsByControllers = m_utils.m_characterControlManager->GetIdsByControllers();
-                        for(auto const& controller : idsByControllers)
-                        {
-                            if(controller.first->getActor() == pairs->otherActor)
-                            {
-                                collisionPair.secondID = controller.second;
-                            }
-                        }
-                    }
-                    else
-                    {
-                        // Has to be a rigid body. Possibly dangerous to assume...
-                        collisionPair.secondID = m_utils.m_rigidBodyManager->GetIDsByBodies().find(pairs->otherActor)->second;
-                    }
+                    collisionPair.firstID = m_utils.m_rigidBodyManager->GetIDByActor(cp.triggerActor);
+                    // The other actor is either a controller or a rigid body
+                    collisionPair.secondID = m_utils.GetIDByActor(cp.otherActor);
                     m_triggerPairs.push_back(collisionPair);
                 }
             }
@@ -362,10 +437,8 @@ namespace DoremiEngine
         void PhysicsModuleImplementation::onControllerHit(const PxControllersHit& hit)
         {
             CollisionPair collisionPair;
-            unordered_map<PxController*, int> idsByControllers = m_utils.m_characterControlManager->GetIdsByControllers();
-
-            collisionPair.firstID = m_utils.m_characterControlManager->GetIdsByControllers().find(hit.controller)->second;
-            collisionPair.secondID = m_utils.m_characterControlManager->GetIdsByControllers().find(hit.other)->second;
+            collisionPair.firstID = m_utils.m_characterControlManager->GetIDByController(hit.controller);
+            collisionPair.secondID = m_utils.m_characterControlManager->GetIDByController(hit.other);
             m_collisionPairs.push_back(collisionPair);
         }
     }
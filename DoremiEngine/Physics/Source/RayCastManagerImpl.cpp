@@ -1,6 +1,15 @@
 #include <DoremiEngine/Physics/Include/Internal/RayCastManagerImpl.hpp>
 #include <DoremiEngine/Physics/Include/Internal/PhysicsModuleImplementation.hpp>
 
+#include <Utility/Utilities/Include/Threading/WorkStealingThreadPool.hpp>
+
+// Standard
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+
 // DEBUG
 #include <iostream>
 using namespace std;
@@ -9,8 +18,33 @@ namespace DoremiEngine
     namespace Physics
     {
 
+        namespace
+        {
+            /**
+            Shared by the calling thread and the jobs of one CastRays. A job may start after every batch is taken and CastRays has
+            returned, so it owns the state together with the caller and touches nothing else unless it takes a batch
+            */
+            struct RayBatchProgress
+            {
+                std::atomic<size_t> nextBatch;
+                size_t finishedBatches;
+                mutex finishedMutex;
+                condition_variable finishedCondition;
+                RayBatchProgress() : nextBatch(0), finishedBatches(0) {}
+            };
+        }
+
         RayCastManagerImpl::RayCastManagerImpl(InternalPhysicsUtils& p_utils) : m_utils(p_utils) {}
-        RayCastManagerImpl::~RayCastManagerImpl() {}
+
+        RayCastManagerImpl::~RayCastManagerImpl()
+        {
+            for(auto batch : m_rayBatches)
+            {
+                batch->query->release();
+                delete batch;
+            }
+            m_rayBatches.clear();
+        }
         int RayCastManagerImpl::CastRay(const DirectX::XMFLOAT3& p_origin, const DirectX::XMFLOAT3& p_direction, const float& p_range)
         {
             if(p_range <= 0.0f)
@@ -33,27 +67,119 @@ namespace DoremiEngine
                 return -1;
             }
 
-            // Start with checking static and dynamic rigid bodies
-            unordered_map<PxRigidActor*, int> idsByRigidBody = m_utils.m_rigidBodyManager->GetIDsByBodies();
-            if(idsByRigidBody.find(hit.block.actor) != idsByRigidBody.end())
+            // Rigid bodies and character controllers both have their ID in the actor
+            return m_utils.GetIDByActor(hit.block.actor);
+        }
+
+        void RayCastManagerImpl::CastRays(const std::vector<RayCastQuery>& p_rays, std::vector<int>& o_hits)
+        {
+            const size_t rayCount = p_rays.size();
+            o_hits.assign(rayCount, -1);
+            if(rayCount == 0)
+            {
+                return;
+            }
+
+            // Make sure we have enough batch queries for all the rays. They are kept between calls
+            const size_t batchCount = (rayCount + m_raysPerBatch - 1) / m_raysPerBatch;
+            while(m_rayBatches.size() < batchCount)
             {
-                return idsByRigidBody.find(hit.block.actor)->second;
+                m_rayBatches.push_back(CreateRayBatch());
             }
-            else
+
+            // The scene is only read during the queries so the batches can be executed concurrently on the thread pool. Every thread takes
+            // batches until there are none left, so the calling thread never waits on a job which hasn't started
+            Doremi::Utilities::Threading::WorkStealingThreadPool& threadPool = *m_utils.m_threadPool;
+            shared_ptr<RayBatchProgress> progress = make_shared<RayBatchProgress>();
+            auto executeBatches = [this, &p_rays, progress, batchCount]() {
+                size_t executed = 0;
+                for(size_t batchIndex = progress->nextBatch++; batchIndex < batchCount; batchIndex = progress->nextBatch++)
+                {
+                    ExecuteRayBatch(p_rays, batchIndex);
+                    ++executed;
+                }
+                if(executed > 0)
+                {
+                    lock_guard<mutex> lock(progress->finishedMutex);
+                    progress->finishedBatches += executed;
+                    if(progress->finishedBatches == batchCount)
+                    {
+                        progress->finishedCondition.notify_one();
+                    }
+                }
+            };
+            // A worker waiting for other jobs could stall the pool, so from a worker everything runs here
+            if(threadPool.GetCurrentWorkerIndex() == threadPool.GetThreadCount())
+            {
+                const size_t jobCount = min(batchCount - 1, static_cast<size_t>(threadPool.GetThreadCount()));
+                for(size_t i = 0; i < jobCount; ++i)
+                {
+                    threadPool.Submit(executeBatches);
+                }
+            }
+            executeBatches();
             {
-                // Nothing
+                unique_lock<mutex> lock(progress->finishedMutex);
+                progress->finishedCondition.wait(lock, [&progress, batchCount]() { return progress->finishedBatches == batchCount; });
             }
-            // Now comes the difficult task of checking vs character controllers
-            unordered_map<PxController*, int> idsByCharacterController = m_utils.m_characterControlManager->GetIdsByControllers();
-            for(auto pairs : idsByCharacterController) // Loop through every pair in the list
+
+            // Translate the hit actors into ids
+            for(size_t batchIndex = 0; batchIndex < batchCount; ++batchIndex)
             {
-                if(pairs.first->getActor() == hit.block.actor) // The first part contains the actor pointer
+                RayBatch& batch = *m_rayBatches[batchIndex];
+                const size_t resultCount = batch.rayIndices.size();
+                for(size_t i = 0; i < resultCount; ++i)
                 {
-                    return pairs.second; // If this is true we found a hit vs character controller, second contains ID
+                    const PxRaycastQueryResult& result = batch.results[i];
+                    if(!result.hasBlock)
+                    {
+                        continue;
+                    }
+                    o_hits[batch.rayIndices[i]] = m_utils.GetIDByActor(result.block.actor);
                 }
             }
+        }
+
+        RayCastManagerImpl::RayBatch* RayCastManagerImpl::CreateRayBatch()
+        {
+            RayBatch* batch = new RayBatch();
+            batch->results.resize(m_raysPerBatch);
+            batch->rayIndices.reserve(m_raysPerBatch);
+
+            // Only raycasts, and only the closest (blocking) hit is wanted so no touch buffer is needed
+            PxBatchQueryDesc desc(static_cast<PxU32>(m_raysPerBatch), 0, 0);
+            desc.queryMemory.userRaycastResultBuffer = batch->results.data();
+            desc.queryMemory.userRaycastTouchBuffer = nullptr;
+            desc.queryMemory.raycastTouchBufferSize = 0;
+            batch->query = m_utils.m_worldScene->createBatchQuery(desc);
+            return batch;
+        }
 
-            return -1;
+        void RayCastManagerImpl::ExecuteRayBatch(const std::vector<RayCastQuery>& p_rays, size_t p_batchIndex)
+        {
+            const size_t rayCount = p_rays.size();
+            RayBatch& batch = *m_rayBatches[p_batchIndex];
+            batch.rayIndices.clear();
+            const size_t firstRay = p_batchIndex * m_raysPerBatch;
+            const size_t lastRay = min(firstRay + m_raysPerBatch, rayCount);
+            for(size_t i = firstRay; i < lastRay; ++i)
+            {
+                const RayCastQuery& ray = p_rays[i];
+                // Same rules as CastRay, bad rays are never sent to PhysX and simply miss
+                if(ray.range <= 0.0f)
+                {
+                    continue;
+                }
+                PxVec3 direction = PxVec3(ray.direction.x, ray.direction.y, ray.direction.z);
+                if(direction.normalize() == 0.0f)
+                {
+                    continue;
+                }
+                PxVec3 origin = PxVec3(ray.origin.x, ray.origin.y, ray.origin.z);
+                batch.query->raycast(origin, direction, ray.range, 0, PxHitFlag::eMESH_BOTH_SIDES);
+                batch.rayIndices.push_back(i);
+            }
+            batch.query->execute();
         }
 
         int RayCastManagerImpl::CastSweep(const XMFLOAT3& p_origin, XMFLOAT3& p_direction, float p_width, const float& p_range)
@@ -78,27 +204,8 @@ namespace DoremiEngine
                 return -1;
             }
 
-            // Start with checking static and dynamic rigid bodies
-            unordered_map<PxRigidActor*, int> idsByRigidBody = m_utils.m_rigidBodyManager->GetIDsByBodies();
-            if(idsByRigidBody.find(hit.block.actor) != idsByRigidBody.end())
-            {
-                return idsByRigidBody.find(hit.block.actor)->second;
-            }
-            else
-            {
-                // Nothing
-            }
-            // Now comes the difficult task of checking vs character controllers
-            unordered_map<PxController*, int> idsByCharacterController = m_utils.m_characterControlManager->GetIdsByControllers();
-            for(auto pairs : idsByCharacterController) // Loop through every pair in the list
-            {
-                if(pairs.first->getActor() == hit.block.actor) // The first part contains the actor pointer
-                {
-                    return pairs.second; // If this is true we found a hit vs character controller, second contains ID
-                }
-            }
-
-            return -1;
+            // Rigid bodies and character controllers both have their ID in the actor
+            return m_utils.GetIDByActor(hit.block.actor);
         }
 
         int RayCastManagerImpl::CastSweep(const XMFLOAT3& p_origin, XMFLOAT3& p_direction, float p_width, const float& p_range, int& o_flag)
@@ -124,8 +231,8 @@ namespace DoremiEngine
             }
 
             // Start with checking static and dynamic rigid bodies
-            unordered_map<PxRigidActor*, int> idsByRigidBody = m_utils.m_rigidBodyManager->GetIDsByBodies();
-            if(idsByRigidBody.find(hit.block.actor) != idsByRigidBody.end())
+            const int rigidBodyID = m_utils.m_rigidBodyManager->GetIDByActor(hit.block.actor);
+            if(rigidBodyID != -1)
             {
                 PxRigidActor* actorAsRigic = (PxRigidActor*)hit.block.actor;
                 if(actorAsRigic->isRigidDynamic())
@@ -140,24 +247,15 @@ namespace DoremiEngine
                 {
                     o_flag = 3;
                 }
-                return idsByRigidBody.find(hit.block.actor)->second;
+                return rigidBodyID;
             }
-            else
+            // Then character controllers
+            const int controllerID = m_utils.m_characterControlManager->GetIDByActor(hit.block.actor);
+            if(controllerID != -1)
             {
-                // Nothing
+                o_flag = 1;
             }
-            // Now comes the difficult task of checking vs character controllers
-            unordered_map<PxController*, int> idsByCharacterController = m_utils.m_characterControlManager->GetIdsByControllers();
-            for(auto pairs : idsByCharacterController) // Loop through every pair in the list
-            {
-                if(pairs.first->getActor() == hit.block.actor) // The first part contains the actor pointer
-                {
-                    o_flag = 1;
-                    return pairs.second; // If this is true we found a hit vs character controller, second contains ID
-                }
-            }
-
-            return -1;
+            return controllerID;
         }
 
         std::vector<int> RayCastManagerImpl::OverlapBoxMultipleHits(const XMFLOAT3& p_origin, const XMFLOAT3& p_halfExtents)
@@ -173,26 +271,17 @@ namespace DoremiEngine
             // PxGeometry* geometry
             bool status = m_utils.m_worldScene->overlap(box, position, hit);
             size_t numberOfHits = hit.getNbAnyHits();
+            if(numberOfHits == 0)
+            {
+                return returnVec;
+            }
+            // This is called from several threads when potential fields are baked so nothing may be written here, the lookups only read
             for(size_t i = 0; i < numberOfHits; i++)
             {
-                // Start with checking static and dynamic rigid bodies
-                unordered_map<PxRigidActor*, int> idsByRigidBody = m_utils.m_rigidBodyManager->GetIDsByBodies();
-                if(idsByRigidBody.find(hit.getAnyHit(i).actor) != idsByRigidBody.end())
-                {
-                    returnVec.push_back(idsByRigidBody.find(hit.getAnyHit(i).actor)->second);
-                }
-                else
+                const int id = m_utils.GetIDByActor(hit.getAnyHit(i).actor);
+                if(id != -1)
                 {
-                    // Nothing
-                }
-                // Now comes the difficult task of checking vs character controllers
-                unordered_map<PxController*, int> idsByCharacterController = m_utils.m_characterControlManager->GetIdsByControllers();
-                for(auto pairs : idsByCharacterController) // Loop through every pair in the list
-                {
-                    if(pairs.first->getActor() == hit.getAnyHit(i).actor) // The first part contains the actor pointer
-                    {
-                        returnVec.push_back(pairs.second); // If this is true we found a hit vs character controller, second contains ID
-                    }
+                    returnVec.push_back(id);
                 }
             }
             return returnVec;
@@ -220,17 +309,8 @@ namespace DoremiEngine
                 return -1;
             }
 
-            // Now comes the difficult task of checking vs character controllers
-            unordered_map<PxController*, int> idsByCharacterController = m_utils.m_characterControlManager->GetIdsByControllers();
-            for(auto pairs : idsByCharacterController) // Loop through every pair in the list
-            {
-                if(pairs.first->getActor() == hit.block.actor) // The first part contains the actor pointer
-                {
-                    return pairs.second; // If this is true we found a hit vs character controller, second contains ID
-                }
-            }
-
-            return -1;
+            // Only character controllers count
+            return m_utils.m_characterControlManager->GetIDByActor(hit.block.actor);
         }
     }
 }
\ No newline at end of file
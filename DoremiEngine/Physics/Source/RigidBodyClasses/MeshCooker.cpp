@@ -2,14 +2,46 @@
 #include <Internal/RigidBodyClasses/MeshCooker.hpp>
 
 #include <Internal/PhysicsModuleImplementation.hpp>
+#include <Utility/Utilities/Include/Threading/WorkStealingThreadPool.hpp>
+
+#include <condition_variable>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#endif
 
 namespace DoremiEngine
 {
     namespace Physics
     {
+        namespace
+        {
+            // Start of every cache file, "DCMS"
+            const uint32_t CACHE_FILE_MAGIC = 0x534D4344;
+
+            const uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+            const uint64_t FNV_PRIME = 1099511628211ULL;
+
+            uint64_t HashBytes(uint64_t p_hash, const void* p_data, const size_t& p_size)
+            {
+                const uint8_t* bytes = static_cast<const uint8_t*>(p_data);
+                for(size_t i = 0; i < p_size; ++i)
+                {
+                    p_hash = (p_hash ^ bytes[i]) * FNV_PRIME;
+                }
+                return p_hash;
+            }
+        }
+
         MeshCooker::MeshCooker(InternalPhysicsUtils& p_utils) : m_utils(p_utils)
         {
-            m_cooker = PxCreateCooking(PX_PHYSICS_VERSION, *m_utils.m_foundation, PxCookingParams(m_utils.m_physics->getTolerancesScale()));
+            m_cooker = CreateCooker();
             if(!m_cooker)
             {
                 // shit happened
@@ -17,37 +49,296 @@ namespace DoremiEngine
             }
         }
 
-        MeshCooker::~MeshCooker() { m_cooker->release(); }
+        MeshCooker::~MeshCooker()
+        {
+            // Bodies still using a mesh hold references of their own
+            for(auto& mesh : m_meshes)
+            {
+                mesh.second->release();
+            }
+            m_cooker->release();
+        }
+
+        PxCooking* MeshCooker::CreateCooker()
+        {
+            return PxCreateCooking(PX_PHYSICS_VERSION, *m_utils.m_foundation, PxCookingParams(m_utils.m_physics->getTolerancesScale()));
+        }
+
+        uint64_t MeshCooker::HashMesh(const vector<XMFLOAT3>& p_vertexPositions, const vector<int>& p_indices)
+        {
+            // Counts are included so a mesh can't hash like another with the data split differently
+            const uint64_t counts[2] = {p_vertexPositions.size(), p_indices.size()};
+            uint64_t hash = HashBytes(FNV_OFFSET_BASIS, counts, sizeof(counts));
+            if(!p_vertexPositions.empty())
+            {
+                hash = HashBytes(hash, &p_vertexPositions[0], sizeof(XMFLOAT3) * p_vertexPositions.size());
+            }
+            if(!p_indices.empty())
+            {
+                hash = HashBytes(hash, &p_indices[0], sizeof(int) * p_indices.size());
+            }
+            return hash;
+        }
 
         PxTriangleMesh* MeshCooker::CookMesh(vector<XMFLOAT3>& p_vertexPositions, vector<int>& p_indices)
         {
-            // Cast vectors into pointers
-            PxVec3* positionsPX = reinterpret_cast<PxVec3*>(&p_vertexPositions[0]);
-            PxU32* indicesPX = reinterpret_cast<PxU32*>(&p_indices[0]);
+            const uint64_t hash = HashMesh(p_vertexPositions, p_indices);
+            auto cooked = m_meshes.find(hash);
+            if(cooked != m_meshes.end())
+            {
+                return cooked->second;
+            }
+
+            vector<uint8_t> stream;
+            if(!CookToStream(*m_cooker, p_vertexPositions, p_indices, stream))
+            {
+                return NULL;
+            }
+            return CreateMesh(hash, stream);
+        }
+
+        void MeshCooker::CookMeshes(const vector<const vector<XMFLOAT3>*>& p_vertexPositions, const vector<const vector<int>*>& p_indices,
+                                    const string& p_cacheFile, vector<PxTriangleMesh*>& o_meshes)
+        {
+            const size_t meshCount = p_vertexPositions.size();
+            o_meshes.assign(meshCount, NULL);
+
+            unordered_map<uint64_t, CookedMeshStream> fileStreams;
+            if(!p_cacheFile.empty())
+            {
+                ReadCacheFile(p_cacheFile, fileStreams);
+            }
+
+            // Sort out what has to be cooked. Meshes already created or in the file are not cooked again
+            vector<uint64_t> hashes(meshCount);
+            unordered_map<uint64_t, CookedMeshStream> usedStreams;
+            vector<size_t> toCook;
+            for(size_t i = 0; i < meshCount; ++i)
+            {
+                hashes[i] = HashMesh(*p_vertexPositions[i], *p_indices[i]);
+                if(usedStreams.count(hashes[i]) != 0)
+                {
+                    continue;
+                }
+                auto fileStream = fileStreams.find(hashes[i]);
+                if(fileStream != fileStreams.end() && fileStream->second.vertexCount == p_vertexPositions[i]->size() &&
+                   fileStream->second.indexCount == p_indices[i]->size())
+                {
+                    usedStreams[hashes[i]] = move(fileStream->second);
+                }
+                else if(m_meshes.count(hashes[i]) == 0)
+                {
+                    CookedMeshStream& stream = usedStreams[hashes[i]];
+                    stream.vertexCount = static_cast<uint32_t>(p_vertexPositions[i]->size());
+                    stream.indexCount = static_cast<uint32_t>(p_indices[i]->size());
+                    toCook.push_back(i);
+                }
+                // Else the mesh is already created and missing from the file, it's left out of the file until it's cooked again
+            }
+
+            // Cook the misses on the thread pool. The streams are all created before any job starts so the map isn't changed meanwhile
+            if(!toCook.empty())
+            {
+                Doremi::Utilities::Threading::WorkStealingThreadPool& threadPool = *m_utils.m_threadPool;
+                vector<PxCooking*> cookers(threadPool.GetThreadCount() + 1, nullptr);
+                for(auto& cooker : cookers)
+                {
+                    cooker = CreateCooker();
+                }
+
+                mutex doneMutex;
+                condition_variable doneCondition;
+                size_t remaining = toCook.size();
+                for(auto& index : toCook)
+                {
+                    const vector<XMFLOAT3>* vertexPositions = p_vertexPositions[index];
+                    const vector<int>* indices = p_indices[index];
+                    vector<uint8_t>* data = &usedStreams[hashes[index]].data;
+                    threadPool.Submit([&, vertexPositions, indices, data]() {
+                        PxCooking& cooker = *cookers[threadPool.GetCurrentWorkerIndex()];
+                        if(!CookToStream(cooker, *vertexPositions, *indices, *data))
+                        {
+                            data->clear();
+                        }
+                        lock_guard<mutex> lock(doneMutex);
+                        if(--remaining == 0)
+                        {
+                            doneCondition.notify_one();
+                        }
+                    });
+                }
+                {
+                    unique_lock<mutex> lock(doneMutex);
+                    doneCondition.wait(lock, [&remaining]() { return remaining == 0; });
+                }
+
+                for(auto& cooker : cookers)
+                {
+                    cooker->release();
+                }
+            }
+
+            // Creating the meshes is done here, one at a time
+            for(size_t i = 0; i < meshCount; ++i)
+            {
+                auto created = m_meshes.find(hashes[i]);
+                if(created != m_meshes.end())
+                {
+                    o_meshes[i] = created->second;
+                    continue;
+                }
+                const vector<uint8_t>& data = usedStreams[hashes[i]].data;
+                if(!data.empty())
+                {
+                    o_meshes[i] = CreateMesh(hashes[i], data);
+                }
+            }
+
+            // Rewrite the file if something was cooked, or if it holds meshes no longer in the level
+            if(!p_cacheFile.empty() && (!toCook.empty() || fileStreams.size() != usedStreams.size()))
+            {
+                WriteCacheFile(p_cacheFile, usedStreams);
+            }
+        }
+
+        bool MeshCooker::CookToStream(PxCooking& p_cooker, const vector<XMFLOAT3>& p_vertexPositions, const vector<int>& p_indices,
+                                      vector<uint8_t>& o_stream)
+        {
+            if(p_vertexPositions.empty() || p_indices.empty())
+            {
+                return false;
+            }
 
             // Create the mesh data description
             PxTriangleMeshDesc meshDesc;
             meshDesc.setToDefault();
-            meshDesc.points.count = p_vertexPositions.size();
+            meshDesc.points.count = static_cast<PxU32>(p_vertexPositions.size());
             meshDesc.points.stride = sizeof(PxVec3);
-            meshDesc.points.data = positionsPX;
+            meshDesc.points.data = &p_vertexPositions[0];
 
-            meshDesc.triangles.count = p_indices.size() / 3;
+            meshDesc.triangles.count = static_cast<PxU32>(p_indices.size() / 3);
             meshDesc.triangles.stride = sizeof(PxU32) * 3;
-            meshDesc.triangles.data = indicesPX;
+            meshDesc.triangles.data = &p_indices[0];
             meshDesc.flags = PxMeshFlags(0);
 
             // Cook the mesh
             PxDefaultMemoryOutputStream writeBuffer;
-            bool status = m_cooker->cookTriangleMesh(meshDesc, writeBuffer);
-            if(!status)
+            if(!p_cooker.cookTriangleMesh(meshDesc, writeBuffer))
             {
-                return NULL;
+                return false;
+            }
+            o_stream.assign(writeBuffer.getData(), writeBuffer.getData() + writeBuffer.getSize());
+            return true;
+        }
+
+        PxTriangleMesh* MeshCooker::CreateMesh(const uint64_t& p_hash, const vector<uint8_t>& p_stream)
+        {
+            PxDefaultMemoryInputData readBuffer(const_cast<PxU8*>(&p_stream[0]), static_cast<PxU32>(p_stream.size()));
+            PxTriangleMesh* mesh = m_utils.m_physics->createTriangleMesh(readBuffer);
+            if(mesh != NULL)
+            {
+                m_meshes[p_hash] = mesh;
             }
+            return mesh;
+        }
 
-            // Get the data and return
-            PxDefaultMemoryInputData readBuffer(writeBuffer.getData(), writeBuffer.getSize());
-            return m_utils.m_physics->createTriangleMesh(readBuffer);
+        void MeshCooker::ReadCacheFile(const string& p_fileName, unordered_map<uint64_t, CookedMeshStream>& o_streams)
+        {
+            ifstream file(p_fileName, ifstream::in | ifstream::binary);
+            if(!file.is_open())
+            {
+                return;
+            }
+
+            uint32_t magic = 0;
+            uint32_t version = 0;
+            uint32_t count = 0;
+            file.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+            file.read(reinterpret_cast<char*>(&version), sizeof(version));
+            file.read(reinterpret_cast<char*>(&count), sizeof(count));
+            if(!file || magic != CACHE_FILE_MAGIC || version != PX_PHYSICS_VERSION)
+            {
+                return;
+            }
+
+            for(uint32_t i = 0; i < count; ++i)
+            {
+                uint64_t hash = 0;
+                uint32_t size = 0;
+                CookedMeshStream stream;
+                file.read(reinterpret_cast<char*>(&hash), sizeof(hash));
+                file.read(reinterpret_cast<char*>(&stream.vertexCount), sizeof(stream.vertexCount));
+                file.read(reinterpret_cast<char*>(&stream.indexCount), sizeof(stream.indexCount));
+                file.read(reinterpret_cast<char*>(&size), sizeof(size));
+                if(!file || size == 0)
+                {
+                    // Truncated file, whatever was read completely is still fine
+                    return;
+                }
+                stream.data.resize(size);
+                file.read(reinterpret_cast<char*>(&stream.data[0]), size);
+                if(!file)
+                {
+                    return;
+                }
+                o_streams[hash] = move(stream);
+            }
+        }
+
+        void MeshCooker::WriteCacheFile(const string& p_fileName, const unordered_map<uint64_t, CookedMeshStream>& p_streams)
+        {
+            // Written to another file first and then moved, so a reader never sees a half written file
+            const string temporaryFileName = p_fileName + ".tmp";
+            {
+                ofstream file(temporaryFileName, ofstream::out | ofstream::binary | ofstream::trunc);
+                if(!file.is_open())
+                {
+                    return;
+                }
+                WriteCacheStreams(file, p_streams);
+                if(!file)
+                {
+                    file.close();
+                    remove(temporaryFileName.c_str());
+                    return;
+                }
+            }
+            // Replaces the old file in one step, there is never a moment without a cache file
+#if defined(_WIN32)
+            MoveFileExA(temporaryFileName.c_str(), p_fileName.c_str(), MOVEFILE_REPLACE_EXISTING);
+#else
+            rename(temporaryFileName.c_str(), p_fileName.c_str());
+#endif
+        }
+
+        void MeshCooker::WriteCacheStreams(ostream& p_file, const unordered_map<uint64_t, CookedMeshStream>& p_streams)
+        {
+            // Meshes which failed to cook aren't saved, they are tried again next time
+            uint32_t count = 0;
+            for(auto& stream : p_streams)
+            {
+                if(!stream.second.data.empty())
+                {
+                    ++count;
+                }
+            }
+            const uint32_t version = PX_PHYSICS_VERSION;
+            p_file.write(reinterpret_cast<const char*>(&CACHE_FILE_MAGIC), sizeof(CACHE_FILE_MAGIC));
+            p_file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+            p_file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+            for(auto& stream : p_streams)
+            {
+                if(stream.second.data.empty())
+                {
+                    continue;
+                }
+                const uint32_t size = static_cast<uint32_t>(stream.second.data.size());
+                p_file.write(reinterpret_cast<const char*>(&stream.first), sizeof(stream.first));
+                p_file.write(reinterpret_cast<const char*>(&stream.second.vertexCount), sizeof(stream.second.vertexCount));
+                p_file.write(reinterpret_cast<const char*>(&stream.second.indexCount), sizeof(stream.second.indexCount));
+                p_file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+                p_file.write(reinterpret_cast<const char*>(&stream.second.data[0]), size);
+            }
         }
     }
-}
\ No newline at end of file
+}
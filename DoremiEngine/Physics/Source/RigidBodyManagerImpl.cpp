@@ -50,8 +50,8 @@ namespace DoremiEngine
             m_utils.m_worldScene->addActor(*body);
 
             // Finally add the body to our list
-            m_bodies[p_id] = body;
-            m_IDsByBodies[body] = p_id;
+            m_bodies.Insert(p_id, body);
+            SetActorEntityID(*body, p_id);
 
             /*
             And now we have added a box to the world at the given position
@@ -97,8 +97,8 @@ namespace DoremiEngine
             // We're done with the shape. Release itS
 
             // Finally add the body to our list
-            m_bodies[p_id] = body;
-            m_IDsByBodies[body] = p_id;
+            m_bodies.Insert(p_id, body);
+            SetActorEntityID(*body, p_id);
 
             // Hax to get callbacks to work (Set a common flag on every object)
             SetCallback(p_id, (1 << 0), (1 << 0));
@@ -114,26 +114,26 @@ namespace DoremiEngine
 
         void RigidBodyManagerImpl::SetKinematicActor(int p_bodyID, bool p_kinematic)
         {
-            if(m_bodies.find(p_bodyID) == m_bodies.end())
+            if(!m_bodies.Contains(p_bodyID))
             {
                 cout << "shit went wrong" << endl;
             }
             // TODOXX det kan krngla om man antar att det r en PxRigidDynamic* om det r en static. Borde kollas om det r en dynamic.
-            ((PxRigidDynamic*)m_bodies[p_bodyID])->setRigidBodyFlag(PxRigidBodyFlag::eKINEMATIC, p_kinematic);
+            ((PxRigidDynamic*)m_bodies.Get(p_bodyID))->setRigidBodyFlag(PxRigidBodyFlag::eKINEMATIC, p_kinematic);
         }
 
         void RigidBodyManagerImpl::MoveKinematicActor(int p_bodyID, XMFLOAT3 p_moveVector)
         {
-            if(m_bodies.find(p_bodyID) == m_bodies.end())
+            if(!m_bodies.Contains(p_bodyID))
             {
                 cout << "shit went wrong" << endl;
             }
-            if((uint32_t)((PxRigidDynamic*)m_bodies[p_bodyID])->getRigidBodyFlags() & PxRigidBodyFlag::eKINEMATIC == PxRigidBodyFlag::eKINEMATIC)
+            if((uint32_t)((PxRigidDynamic*)m_bodies.Get(p_bodyID))->getRigidBodyFlags() & PxRigidBodyFlag::eKINEMATIC == PxRigidBodyFlag::eKINEMATIC)
             {
-                PxVec3 currentPos = ((PxRigidDynamic*)m_bodies[p_bodyID])->getGlobalPose().p;
+                PxVec3 currentPos = ((PxRigidDynamic*)m_bodies.Get(p_bodyID))->getGlobalPose().p;
                 PxVec3 targetPos = PxVec3(p_moveVector.x, p_moveVector.y, p_moveVector.z);
                 targetPos += currentPos;
-                ((PxRigidDynamic*)m_bodies[p_bodyID])->setKinematicTarget(PxTransform(targetPos));
+                ((PxRigidDynamic*)m_bodies.Get(p_bodyID))->setKinematicTarget(PxTransform(targetPos));
             }
             else
             {
@@ -143,14 +143,14 @@ namespace DoremiEngine
 
         void RigidBodyManagerImpl::SetWorldPositionKinematic(int p_bodyID, XMFLOAT3 p_position)
         {
-            if(m_bodies.find(p_bodyID) == m_bodies.end())
+            if(!m_bodies.Contains(p_bodyID))
             {
                 cout << "shit went wrong" << endl;
             }
-            if((uint32_t)((PxRigidDynamic*)m_bodies[p_bodyID])->getRigidBodyFlags() & PxRigidBodyFlag::eKINEMATIC == PxRigidBodyFlag::eKINEMATIC)
+            if((uint32_t)((PxRigidDynamic*)m_bodies.Get(p_bodyID))->getRigidBodyFlags() & PxRigidBodyFlag::eKINEMATIC == PxRigidBodyFlag::eKINEMATIC)
             {
 
-                ((PxRigidDynamic*)m_bodies[p_bodyID])->setKinematicTarget(PxTransform(p_position.x, p_position.y, p_position.z));
+                ((PxRigidDynamic*)m_bodies.Get(p_bodyID))->setKinematicTarget(PxTransform(p_position.x, p_position.y, p_position.z));
             }
             else
             {
@@ -163,9 +163,64 @@ namespace DoremiEngine
         {
             // Get a mesh
             PxTriangleMesh* mesh = m_meshCooker->CookMesh(p_vertexPositions, p_indices);
+            PxRigidStatic* body = CreateStaticMeshBody(p_id, p_position, p_orientation, mesh, p_materialID);
+            if(body != NULL)
+            {
+                m_utils.m_worldScene->addActor(*body);
+            }
+        }
+
+        void RigidBodyManagerImpl::AddMeshBodiesStatic(const vector<MeshBodyDescription>& p_bodies, const std::string& p_cookedMeshFile)
+        {
+            vector<const vector<XMFLOAT3>*> vertexPositions;
+            vector<const vector<int>*> indices;
+            vertexPositions.reserve(p_bodies.size());
+            indices.reserve(p_bodies.size());
+            for(auto& body : p_bodies)
+            {
+                vertexPositions.push_back(&body.vertexPositions);
+                indices.push_back(&body.indices);
+            }
+
+            vector<PxTriangleMesh*> meshes;
+            m_meshCooker->CookMeshes(vertexPositions, indices, p_cookedMeshFile, meshes);
+            vector<PxActor*> actors;
+            actors.reserve(p_bodies.size());
+            for(size_t i = 0; i < p_bodies.size(); ++i)
+            {
+                const MeshBodyDescription& body = p_bodies[i];
+                PxRigidStatic* actor = CreateStaticMeshBody(body.id, body.position, body.orientation, meshes[i], body.materialID);
+                if(actor != NULL)
+                {
+                    actors.push_back(actor);
+                }
+            }
+            // The level goes into the scene in one call, then the broadphase regions and static pruning are set up for it
+            const PxU32 staticCountBefore = m_utils.m_worldScene->getNbActors(PxActorTypeFlag::eRIGID_STATIC);
+            if(!actors.empty())
+            {
+                m_utils.m_worldScene->addActors(&actors[0], static_cast<PxU32>(actors.size()));
+            }
+            // The regions are sized from the statics in the scene, so every level mesh has to be there
+            const PxU32 staticCountAdded = m_utils.m_worldScene->getNbActors(PxActorTypeFlag::eRIGID_STATIC) - staticCountBefore;
+            if(staticCountAdded != p_bodies.size())
+            {
+                cout << "Physics: " << staticCountAdded << " of " << p_bodies.size() << " static level meshes were added to the scene" << endl;
+            }
+            m_utils.m_broadPhaseHandler->StaticGeometryLoaded();
+        }
+
+        PxRigidStatic* RigidBodyManagerImpl::CreateStaticMeshBody(int p_id, const XMFLOAT3& p_position, const XMFLOAT4& p_orientation,
+                                                                  PxTriangleMesh* p_mesh, int p_materialID)
+        {
+            if(p_mesh == NULL)
+            {
+                cout << "Physics: mesh for rigid body ID: " << p_id << " could not be cooked" << endl;
+                return NULL;
+            }
             // Get it into a geometry
             PxTriangleMeshGeometry meshGeometry;
-            meshGeometry.triangleMesh = mesh;
+            meshGeometry.triangleMesh = p_mesh;
 
             // Create the transform
             PxVec3 position = PxVec3(p_position.x, p_position.y, p_position.z);
@@ -178,17 +233,16 @@ namespace DoremiEngine
             PxMaterial* material = m_utils.m_physicsMaterialManager->GetMaterial(p_materialID);
             // Create a shape
             body->createShape(meshGeometry, *material);
-            // Add to scene
-            m_utils.m_worldScene->addActor(*body);
 
             // Finally add the body to our list
-            m_bodies[p_id] = body;
-            m_IDsByBodies[body] = p_id;
+            m_bodies.Insert(p_id, body);
+            SetActorEntityID(*body, p_id);
 
             // Hax to get callbacks to work (Set a common flag on every object)
             // SetCallback(p_id, (1 << 0), (1 << 0));
             // TODOJB don't hard-code this
             SetCallbackFiltering(p_id, 1, 0, 0, 0);
+            return body;
         }
         void RigidBodyManagerImpl::AddMeshBodyDynamic(int p_id, XMFLOAT3 p_position, XMFLOAT4 p_orientation, vector<XMFLOAT3>& p_vertexPositions,
                                                       vector<int>& p_indices, int p_materialID)
@@ -213,8 +267,8 @@ namespace DoremiEngine
             m_utils.m_worldScene->addActor(*body);
 
             // Finally add the body to our list
-            m_bodies[p_id] = body;
-            m_IDsByBodies[body] = p_id;
+            m_bodies.Insert(p_id, body);
+            SetActorEntityID(*body, p_id);
 
             SetCallback(p_id, (1 << 0), (1 << 0));
             return p_id;
@@ -238,8 +292,8 @@ namespace DoremiEngine
             m_utils.m_worldScene->addActor(*body);
 
             // Finally add the body to our list
-            m_bodies[p_id] = body;
-            m_IDsByBodies[body] = p_id;
+            m_bodies.Insert(p_id, body);
+            SetActorEntityID(*body, p_id);
 
             SetCallback(p_id, (1 << 0), (1 << 0));
             return p_id;
@@ -247,50 +301,50 @@ namespace DoremiEngine
 
         void RigidBodyManagerImpl::SetTrigger(int p_id, bool p_isTrigger)
         {
-            if(m_bodies.find(p_id) == m_bodies.end())
+            if(!m_bodies.Contains(p_id))
             {
                 cout << "shit went wrong" << endl;
             }
             PxShape* shape;
-            m_bodies[p_id]->getShapes(&shape, 1);
+            m_bodies.Get(p_id)->getShapes(&shape, 1);
             shape->setFlag(PxShapeFlag::eSIMULATION_SHAPE, false);
             shape->setFlag(PxShapeFlag::eTRIGGER_SHAPE, true);
         }
 
         void RigidBodyManagerImpl::SetDrain(int p_id, bool p_isDrain)
         {
-            if(m_bodies.find(p_id) == m_bodies.end())
+            if(!m_bodies.Contains(p_id))
             {
                 cout << "shit went wrong" << endl;
             }
             PxShape* shape;
-            m_bodies[p_id]->getShapes(&shape, 1);
+            m_bodies.Get(p_id)->getShapes(&shape, 1);
             shape->setFlag(PxShapeFlag::ePARTICLE_DRAIN, p_isDrain);
         }
 
         void RigidBodyManagerImpl::SetCallbackFiltering(int p_bodyID, int p_thisIdMask, int p_notifyTouchOthersMask, int p_notifyLeaveOthersMask, int p_ignoreOthersMask)
         {
-            if(m_bodies.find(p_bodyID) == m_bodies.end())
+            if(!m_bodies.Contains(p_bodyID))
             {
                 cout << "Physics. Rigid bodies. SetCallBackFiltering. No such body exists with ID: " << p_bodyID << endl;
                 return;
             }
             PxFilterData filterData = PxFilterData(p_thisIdMask, p_notifyTouchOthersMask, p_notifyLeaveOthersMask, p_ignoreOthersMask);
             PxShape* shape;
-            m_bodies.at(p_bodyID)->getShapes(&shape, 1);
+            m_bodies.Get(p_bodyID)->getShapes(&shape, 1);
             shape->setSimulationFilterData(filterData);
         }
 
         void RigidBodyManagerImpl::SetCallback(int p_bodyID, int p_filterGroup, int p_filterMask)
         {
-            if(m_bodies.find(p_bodyID) == m_bodies.end())
+            if(!m_bodies.Contains(p_bodyID))
             {
                 cout << "shit went wrong" << endl;
             }
             PxFilterData filterData;
             filterData.word0 = p_filterGroup; // Own ID
             filterData.word1 = p_filterMask; // ID mask to filter pairs that trigger contact callback
-            PxRigidActor* actor = m_bodies[p_bodyID];
+            PxRigidActor* actor = m_bodies.Get(p_bodyID);
             uint32_t numShapes = actor->getNbShapes();
             // Magic allocation of memory (i think)
             PxShape** shapes = (PxShape**)m_utils.m_allocator.allocate(sizeof(PxShape*) * numShapes, 0, __FILE__, __LINE__);
@@ -310,28 +364,28 @@ namespace DoremiEngine
 
         void RigidBodyManagerImpl::SetIgnoredDEBUG(int p_bodyID)
         {
-            if(m_bodies.find(p_bodyID) == m_bodies.end())
+            if(!m_bodies.Contains(p_bodyID))
             {
                 cout << "Physics. Rigid bodies. SetIgnore. No such body with ID found. ID: " << p_bodyID << endl;
                 return;
             }
             PxShape* shape;
-            m_bodies.find(p_bodyID)->second->getShapes(&shape, 1);
+            m_bodies.Get(p_bodyID)->getShapes(&shape, 1);
             PxFilterData data = PxFilterData(1, 0, 0, 1);
             shape->setSimulationFilterData(data);
             shape->setFlag(PxShapeFlag::eSCENE_QUERY_SHAPE, false);
-            m_bodies.find(p_bodyID)->second->setActorFlag(PxActorFlag::eDISABLE_GRAVITY, true);
+            m_bodies.Get(p_bodyID)->setActorFlag(PxActorFlag::eDISABLE_GRAVITY, true);
         }
 
         void RigidBodyManagerImpl::AddForceToBody(int p_bodyID, XMFLOAT3 p_force)
         {
-            if(m_bodies.find(p_bodyID) == m_bodies.end())
+            if(!m_bodies.Contains(p_bodyID))
             {
                 cout << "shit went wrong" << endl;
             }
-            if(m_bodies[p_bodyID]->isRigidDynamic())
+            if(m_bodies.Get(p_bodyID)->isRigidDynamic())
             {
-                ((PxRigidDynamic*)m_bodies[p_bodyID])->addForce(PxVec3(p_force.x, p_force.y, p_force.z));
+                ((PxRigidDynamic*)m_bodies.Get(p_bodyID))->addForce(PxVec3(p_force.x, p_force.y, p_force.z));
             }
             else
             {
@@ -341,13 +395,13 @@ namespace DoremiEngine
 
         void RigidBodyManagerImpl::AddTorqueToBody(int p_bodyID, XMFLOAT3 p_torque)
         {
-            if(m_bodies.find(p_bodyID) == m_bodies.end())
+            if(!m_bodies.Contains(p_bodyID))
             {
                 cout << "shit went wrong" << endl;
             }
-            if(m_bodies[p_bodyID]->isRigidDynamic())
+            if(m_bodies.Get(p_bodyID)->isRigidDynamic())
             {
-                ((PxRigidDynamic*)m_bodies[p_bodyID])->addTorque(PxVec3(p_torque.x, p_torque.y, p_torque.z));
+                ((PxRigidDynamic*)m_bodies.Get(p_bodyID))->addTorque(PxVec3(p_torque.x, p_torque.y, p_torque.z));
             }
             else
             {
@@ -357,13 +411,13 @@ namespace DoremiEngine
 
         void RigidBodyManagerImpl::SetBodyVelocity(int p_bodyID, XMFLOAT3 p_v)
         {
-            if(m_bodies.find(p_bodyID) == m_bodies.end())
+            if(!m_bodies.Contains(p_bodyID))
             {
                 cout << "shit went wrong" << endl;
             }
-            if(m_bodies[p_bodyID]->isRigidDynamic())
+            if(m_bodies.Get(p_bodyID)->isRigidDynamic())
             {
-                ((PxRigidDynamic*)m_bodies[p_bodyID])->setLinearVelocity(PxVec3(p_v.x, p_v.y, p_v.z));
+                ((PxRigidDynamic*)m_bodies.Get(p_bodyID))->setLinearVelocity(PxVec3(p_v.x, p_v.y, p_v.z));
             }
             else
             {
@@ -373,15 +427,15 @@ namespace DoremiEngine
 
         void RigidBodyManagerImpl::SetBodyAngularVelocity(int p_bodyID, XMFLOAT3 p_v)
         {
-            if(m_bodies.find(p_bodyID) == m_bodies.end())
+            if(!m_bodies.Contains(p_bodyID))
             {
                 cout << "shit went wrong" << endl;
             }
             // PxTransform pose = ((PxRigidDynamic*)m_bodisssssses[p_bodyID])->setMaxAngularVelocity(0);
             // pose.q = PxQuat(0, 0, 0, 1);
-            if(m_bodies[p_bodyID]->isRigidDynamic())
+            if(m_bodies.Get(p_bodyID)->isRigidDynamic())
             {
-                ((PxRigidDynamic*)m_bodies[p_bodyID])->setAngularVelocity(PxVec3(p_v.x, p_v.y, p_v.z));
+                ((PxRigidDynamic*)m_bodies.Get(p_bodyID))->setAngularVelocity(PxVec3(p_v.x, p_v.y, p_v.z));
             }
             else
             {
@@ -391,7 +445,7 @@ namespace DoremiEngine
 
         void RigidBodyManagerImpl::SetBodyPosition(int p_bodyID, XMFLOAT3 p_v, XMFLOAT4 p_o)
         {
-            if(m_bodies.find(p_bodyID) == m_bodies.end())
+            if(!m_bodies.Contains(p_bodyID))
             {
                 cout << "shit went wrong" << endl;
             }
@@ -400,99 +454,135 @@ namespace DoremiEngine
             PxTransform trans;
             trans.p = position;
             trans.q = orientation;
-            m_bodies[p_bodyID]->setGlobalPose(trans);
-            PxVec3 pos = m_bodies[p_bodyID]->getGlobalPose().p;
+            m_bodies.Get(p_bodyID)->setGlobalPose(trans);
+            PxVec3 pos = m_bodies.Get(p_bodyID)->getGlobalPose().p;
         }
 
         void RigidBodyManagerImpl::SetLinearDampening(int p_bodyID, float p_dampening)
         {
-            if(m_bodies.find(p_bodyID) == m_bodies.end())
+            if(!m_bodies.Contains(p_bodyID))
             {
                 cout << "shit went wrong" << endl;
             }
-            ((PxRigidDynamic*)m_bodies[p_bodyID])->setLinearDamping(p_dampening);
+            ((PxRigidDynamic*)m_bodies.Get(p_bodyID))->setLinearDamping(p_dampening);
         }
 
         XMFLOAT3 RigidBodyManagerImpl::GetBodyPosition(int p_bodyID)
         {
-            if(m_bodies.find(p_bodyID) == m_bodies.end())
+            if(!m_bodies.Contains(p_bodyID))
             {
                 cout << "shit went wrong" << endl;
             }
-            PxVec3 p = m_bodies[p_bodyID]->getGlobalPose().p;
+            PxVec3 p = m_bodies.Get(p_bodyID)->getGlobalPose().p;
             return XMFLOAT3(p.x, p.y, p.z);
         }
 
         XMFLOAT4 RigidBodyManagerImpl::GetBodyOrientation(int p_bodyID)
         {
-            if(m_bodies.find(p_bodyID) == m_bodies.end())
+            if(!m_bodies.Contains(p_bodyID))
             {
                 cout << "shit went wrong" << endl;
             }
-            PxQuat q = m_bodies[p_bodyID]->getGlobalPose().q;
+            PxQuat q = m_bodies.Get(p_bodyID)->getGlobalPose().q;
             return XMFLOAT4(q.x, q.y, q.z, q.w);
         }
 
+        size_t RigidBodyManagerImpl::WriteMovedBodyTransforms(XMFLOAT3* p_positions, XMFLOAT4* p_orientations, size_t p_stride, size_t p_count)
+        {
+            // Only bodies that moved are in the list, the poses come along so no getGlobalPose is needed
+            PxU32 activeCount = 0;
+            const PxActiveTransform* activeTransforms = m_utils.m_worldScene->getActiveTransforms(activeCount);
+
+            uint8_t* positions = reinterpret_cast<uint8_t*>(p_positions);
+            uint8_t* orientations = reinterpret_cast<uint8_t*>(p_orientations);
+            size_t written = 0;
+            for(PxU32 i = 0; i < activeCount; ++i)
+            {
+                const PxActiveTransform& activeTransform = activeTransforms[i];
+                // The user data of the actor comes along, so the ID is known without touching the actor
+                const int id = GetEntityIDFromUserData(activeTransform.userData);
+                // Character controllers have actors of their own which aren't rigid bodies here
+                if(id < 0 || static_cast<size_t>(id) >= p_count || m_bodies.Get(id) != activeTransform.actor)
+                {
+                    continue;
+                }
+                const PxTransform& pose = activeTransform.actor2World;
+                *reinterpret_cast<XMFLOAT3*>(positions + id * p_stride) = XMFLOAT3(pose.p.x, pose.p.y, pose.p.z);
+                *reinterpret_cast<XMFLOAT4*>(orientations + id * p_stride) = XMFLOAT4(pose.q.x, pose.q.y, pose.q.z, pose.q.w);
+                ++written;
+            }
+            return written;
+        }
+
         XMFLOAT3 RigidBodyManagerImpl::GetBodyVelocity(int p_bodyID)
         {
-            if(m_bodies.find(p_bodyID) == m_bodies.end())
+            if(!m_bodies.Contains(p_bodyID))
             {
                 cout << "shit went wrong" << endl;
             }
-            PxVec3 v = ((PxRigidDynamic*)m_bodies[p_bodyID])->getLinearVelocity();
+            PxVec3 v = ((PxRigidDynamic*)m_bodies.Get(p_bodyID))->getLinearVelocity();
             return XMFLOAT3(v.x, v.y, v.z);
         }
 
         XMFLOAT3 RigidBodyManagerImpl::GetBodyAngularVelocity(int p_bodyID)
         {
-            if(m_bodies.find(p_bodyID) == m_bodies.end())
+            if(!m_bodies.Contains(p_bodyID))
             {
                 cout << "shit went wrong" << endl;
             }
-            PxVec3 v = ((PxRigidDynamic*)m_bodies[p_bodyID])->getAngularVelocity();
+            PxVec3 v = ((PxRigidDynamic*)m_bodies.Get(p_bodyID))->getAngularVelocity();
             return XMFLOAT3(v.x, v.y, v.z);
         }
 
-        float RigidBodyManagerImpl::GetLinearDampening(int p_bodyID) { return ((PxRigidDynamic*)m_bodies[p_bodyID])->getLinearDamping(); }
+        float RigidBodyManagerImpl::GetLinearDampening(int p_bodyID) { return ((PxRigidDynamic*)m_bodies.Get(p_bodyID))->getLinearDamping(); }
 
         std::vector<int>& RigidBodyManagerImpl::GetRecentlyWokenObjects() { return m_recentlyWokenObjects; }
         std::vector<int>& RigidBodyManagerImpl::GetRecentlySleepingObjects() { return m_recentlySleepingObjects; }
 
         bool RigidBodyManagerImpl::IsSleeping(int p_bodyID)
         {
-            if(m_bodies.find(p_bodyID) == m_bodies.end())
+            if(!m_bodies.Contains(p_bodyID))
             {
                 cout << "shit went wrong" << endl;
             }
             bool isSleeping = true;
-            if(m_bodies[p_bodyID]->isRigidDynamic())
+            if(m_bodies.Get(p_bodyID)->isRigidDynamic())
             {
-                isSleeping = ((PxRigidDynamic*)m_bodies[p_bodyID])->isSleeping();
+                isSleeping = ((PxRigidDynamic*)m_bodies.Get(p_bodyID))->isSleeping();
             }
             return isSleeping;
         }
 
         void RigidBodyManagerImpl::RemoveBody(int p_bodyID)
         {
-            if(m_bodies.find(p_bodyID) == m_bodies.end())
+            if(!m_bodies.Contains(p_bodyID))
             {
                 cout << "Physics: couldn't remove rigid body ID: " << p_bodyID << " since it did not exist" << endl;
                 return;
             }
-            m_bodies[p_bodyID]->release();
-            m_IDsByBodies.erase(m_bodies[p_bodyID]);
-            m_bodies.erase(p_bodyID);
+            m_bodies.Get(p_bodyID)->release();
+            m_bodies.Erase(p_bodyID);
         }
 
-        unordered_map<PxRigidActor*, int>& RigidBodyManagerImpl::GetIDsByBodies() { return m_IDsByBodies; }
+        int RigidBodyManagerImpl::GetIDByActor(const PxActor* p_actor) const
+        {
+            const int id = GetActorEntityID(p_actor);
+            // Controller actors carry an ID as well, so make sure the body with the ID is this actor
+            if(p_actor == nullptr || m_bodies.Get(id) != p_actor)
+            {
+                return -1;
+            }
+            return id;
+        }
 
         void RigidBodyManagerImpl::SetRecentlyWokenObjects(PxActor** p_actors, int p_count)
         {
             for(size_t i = 0; i < p_count; i++)
             {
-                if(p_actors[i]->isRigidBody())
+                const int id = GetIDByActor(p_actors[i]);
+                if(id != -1)
                 {
-                    m_recentlyWokenObjects.push_back(m_IDsByBodies.find((PxRigidActor*)p_actors[i])->second);
+                    m_recentlyWokenObjects.push_back(id);
                 }
             }
         }
@@ -500,9 +590,10 @@ namespace DoremiEngine
         {
             for(size_t i = 0; i < p_count; i++)
             {
-                if(p_actors[i]->isRigidBody())
+                const int id = GetIDByActor(p_actors[i]);
+                if(id != -1)
                 {
-                    m_recentlySleepingObjects.push_back(m_IDsByBodies.find((PxRigidActor*)p_actors[i])->second);
+                    m_recentlySleepingObjects.push_back(id);
                 }
             }
         }
@@ -515,13 +606,13 @@ namespace DoremiEngine
 
         void RigidBodyManagerImpl::SetGravity(int p_bodyID, bool p_useGravity)
         {
-            if (m_bodies.count(p_bodyID) == 0)
+            if (!m_bodies.Contains(p_bodyID))
             {
                 // No body with that id, log error!
                 cout << "Physics: couldn't set gravity on rigid body ID: " << p_bodyID << " since it did not exist" << endl;
             }
             // !p_useGravity since we want to disable gravity if p_usegravity is false. Double negativity and shit
-            m_bodies.find(p_bodyID)->second->setActorFlag(PxActorFlag::eDISABLE_GRAVITY, !p_useGravity);
+            m_bodies.Get(p_bodyID)->setActorFlag(PxActorFlag::eDISABLE_GRAVITY, !p_useGravity);
         }
         void RigidBodyManagerImpl::CreateArbitraryBody(int p_id)
         {
@@ -531,8 +622,8 @@ namespace DoremiEngine
             // Add to scene
             m_utils.m_worldScene->addActor(*body);
 
-            m_bodies[p_id] = body;
-            m_IDsByBodies[body] = p_id;
+            m_bodies.Insert(p_id, body);
+            SetActorEntityID(*body, p_id);
         }
         void RigidBodyManagerImpl::AddShapeToBody(int p_id, XMFLOAT3 p_position)
         {
@@ -596,7 +687,7 @@ namespace DoremiEngine
                 // Check if there is a body to remove
                 if(m_bigBodyShapes[m_triggerCounter])
                 {
-                    m_bodies[p_id]->detachShape(*m_bigBodyShapes[m_triggerCounter]);
+                    m_bodies.Get(p_id)->detachShape(*m_bigBodyShapes[m_triggerCounter]);
                 }
                 else
                 {
@@ -604,7 +695,7 @@ namespace DoremiEngine
                 }
                 m_bigBodyShapes[m_triggerCounter] =
                     m_utils.m_physics->createShape(PxSphereGeometry(1), *m_utils.m_physics->createMaterial(0, 0, 0), true, PxShapeFlag::eTRIGGER_SHAPE);
-                m_bodies[p_id]->attachShape(*m_bigBodyShapes[m_triggerCounter]);
+                m_bodies.Get(p_id)->attachShape(*m_bigBodyShapes[m_triggerCounter]);
                 m_bigBodyShapes[m_triggerCounter]->setLocalPose(PxTransform(particlePos));
                 // Update trigger
                 m_triggerCounter++;
@@ -715,7 +806,7 @@ namespace DoremiEngine
         }
         void RigidBodyManagerImpl::AddTriggerToBody(int p_id)
         {
-            PxRigidBody* body = (PxRigidBody*)m_bodies[p_id];
+            PxRigidBody* body = (PxRigidBody*)m_bodies.Get(p_id);
             PxShape* mainShape;
             body->getShapes(&mainShape, 1);
             PxGeometryType::Enum geometryType = mainShape->getGeometryType();
@@ -745,7 +836,7 @@ namespace DoremiEngine
             }
 
 
-            m_bodies[p_id]->attachShape(*triggerShape);
+            m_bodies.Get(p_id)->attachShape(*triggerShape);
         }
     }
 }
\ No newline at end of file
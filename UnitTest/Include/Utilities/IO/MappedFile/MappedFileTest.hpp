@@ -0,0 +1,18 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <Utility/Utilities/Include/IO/MappedFile/MappedFile.hpp>
+
+using namespace Doremi::Utilities::IO;
+
+class MappedFileTest : public testing::Test
+{
+public:
+    MappedFileTest() : m_mappedFile(nullptr) {}
+    virtual ~MappedFileTest() {}
+
+    MappedFile* m_mappedFile;
+
+    void SetUp() override { m_mappedFile = new MappedFile(); }
+
+    void TearDown() override { delete m_mappedFile; }
+};
@@ -0,0 +1,19 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <Utility/Utilities/Include/Memory/Circlebuffer/SPSCArbitrarySizeCirclebuffer.hpp>
+#include <Utilities/Memory/TestStruct64.hpp>
+
+using namespace Doremi::Utilities::Memory;
+
+class SPSCArbitrarySizeCirclebufferTest : public testing::Test
+{
+public:
+    SPSCArbitrarySizeCirclebufferTest() {}
+    virtual ~SPSCArbitrarySizeCirclebufferTest() {}
+
+    SPSCArbitrarySizeCirclebuffer* m_circleBuffer;
+
+    void SetUp() override { m_circleBuffer = new SPSCArbitrarySizeCirclebuffer(); }
+
+    void TearDown() override { delete m_circleBuffer; }
+};
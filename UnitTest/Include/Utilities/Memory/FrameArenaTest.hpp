@@ -0,0 +1,22 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <Utility/Utilities/Include/Memory/Frame/FrameArena.hpp>
+#include <Utility/Utilities/Include/Memory/Frame/FrameAllocator.hpp>
+
+using namespace Doremi::Utilities::Memory;
+class FrameArenaTest : public testing::Test
+{
+public:
+    FrameArenaTest() {}
+    virtual ~FrameArenaTest() {}
+
+    FrameArena* m_frameArena;
+
+    void SetUp() override { m_frameArena = new FrameArena(); }
+
+    void TearDown() override
+    {
+        m_frameArena->Clear();
+        delete m_frameArena;
+    }
+};
@@ -0,0 +1,30 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <Utility/Utilities/Include/Memory/MemoryAllocator.hpp>
+
+using namespace Doremi::Utilities::Memory;
+class PageAllocationTest : public testing::Test
+{
+public:
+    PageAllocationTest() {}
+    virtual ~PageAllocationTest() {}
+
+    PageAllocation m_allocation;
+
+    void SetUp() override { m_allocation = PageAllocation(); }
+
+    void TearDown() override { MemoryAllocator::FreePages(m_allocation); }
+};
+
+/**
+Takes its chunk from pages, to test that path of MemoryAllocator
+*/
+class PageBackedAllocator : public MemoryAllocator
+{
+public:
+    void Initialize(const size_t& p_memorySize, const PageOptions& p_pageOptions) { MemoryAllocator::Initialize(p_memorySize, 16, p_pageOptions); }
+
+    void Clear() override {}
+
+    void* GetStart() const { return GetAdressStartAligned(); }
+};
@@ -0,0 +1,18 @@
+#pragma once
+#include <gtest/gtest.h>
+#include <Utility/Utilities/Include/Memory/Pool/SlabPoolAllocator.hpp>
+#include <Utilities/Memory/TestStruct64.hpp>
+
+using namespace Doremi::Utilities::Memory;
+class SlabPoolAllocatorTest : public testing::Test
+{
+public:
+    SlabPoolAllocatorTest() {}
+    virtual ~SlabPoolAllocatorTest() {}
+
+    SlabPoolAllocator* m_slabPool;
+
+    void SetUp() override { m_slabPool = new SlabPoolAllocator(); }
+
+    void TearDown() override { delete m_slabPool; }
+};
@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <Doremi/Core/Include/Timing/AllocationTracker.hpp>
+
+#include <cstdint>
+#include <vector>
+
+using namespace Doremi::Core;
+
+namespace
+{
+    // Counters of a scope, all zero if it has not allocated
+    ScopeAllocations FindScope(const uint32_t& p_timerID)
+    {
+        for(const auto& scope : AllocationTracker::GetScopes())
+        {
+            if(scope.timerID == p_timerID)
+            {
+                return scope;
+            }
+        }
+        ScopeAllocations empty = {p_timerID, 0, 0, 0};
+        return empty;
+    }
+}
+
+TEST(AllocationTrackerTest, scopesNest)
+{
+    const uint32_t outside = AllocationTracker::EnterScope(12);
+    EXPECT_EQ(12, AllocationTracker::EnterScope(13));
+    EXPECT_EQ(13, AllocationTracker::EnterScope(AllocationTracker::MAX_SCOPES + 5));
+    // Too high ids count as outside any timer
+    EXPECT_EQ(0, AllocationTracker::EnterScope(14));
+    AllocationTracker::LeaveScope(0);
+    AllocationTracker::LeaveScope(13);
+    AllocationTracker::LeaveScope(12);
+    EXPECT_EQ(12, AllocationTracker::EnterScope(outside));
+    AllocationTracker::LeaveScope(outside);
+}
+
+TEST(AllocationTrackerTest, countsLiveBytesOfScope)
+{
+    if(!AllocationTracker::IsBuiltIn())
+    {
+        AllocationTracker::SetTracking(true);
+        EXPECT_FALSE(AllocationTracker::IsTracking());
+        return;
+    }
+
+    const uint32_t scopeID = AllocationTracker::MAX_SCOPES - 1;
+    const bool wasTracking = AllocationTracker::IsTracking();
+    const ScopeAllocations before = FindScope(scopeID);
+
+    AllocationTracker::SetTracking(true);
+    const uint32_t outerScope = AllocationTracker::EnterScope(scopeID);
+    // The vector and its buffer
+    std::vector<char>* kept = new std::vector<char>(1000);
+    AllocationTracker::LeaveScope(outerScope);
+
+    const ScopeAllocations during = FindScope(scopeID);
+    EXPECT_EQ(before.liveBytes + static_cast<int64_t>(sizeof(std::vector<char>) + 1000), during.liveBytes);
+    EXPECT_EQ(before.liveAllocations + 2, during.liveAllocations);
+    EXPECT_EQ(before.allocations + 2, during.allocations);
+
+    // Freed while not tracking, still subtracted
+    AllocationTracker::SetTracking(false);
+    delete kept;
+    const ScopeAllocations after = FindScope(scopeID);
+    EXPECT_EQ(before.liveBytes, after.liveBytes);
+    EXPECT_EQ(before.liveAllocations, after.liveAllocations);
+    AllocationTracker::SetTracking(wasTracking);
+}
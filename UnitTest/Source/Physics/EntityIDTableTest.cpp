@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <DoremiEngine/Physics/Include/Internal/EntityIDTable.hpp>
+
+#include <random>
+#include <unordered_map>
+
+using namespace DoremiEngine::Physics;
+
+TEST(EntityIDTableTest, insertGetErase)
+{
+    int objects[4] = {0, 1, 2, 3};
+    EntityIDTable<int> table;
+    ASSERT_EQ(nullptr, table.Get(0));
+    ASSERT_EQ(nullptr, table.Get(-1));
+
+    table.Insert(3, &objects[0]);
+    table.Insert(10, &objects[1]);
+    table.Insert(7, &objects[2]);
+    ASSERT_EQ(3u, table.Size());
+    ASSERT_EQ(&objects[0], table.Get(3));
+    ASSERT_EQ(&objects[1], table.Get(10));
+    ASSERT_EQ(&objects[2], table.Get(7));
+    ASSERT_FALSE(table.Contains(4));
+
+    // Replacing keeps the size
+    table.Insert(10, &objects[3]);
+    ASSERT_EQ(3u, table.Size());
+    ASSERT_EQ(&objects[3], table.Get(10));
+
+    // Removing the first moves the last into its place
+    table.Erase(3);
+    ASSERT_EQ(2u, table.Size());
+    ASSERT_FALSE(table.Contains(3));
+    ASSERT_EQ(&objects[3], table.Get(10));
+    ASSERT_EQ(&objects[2], table.Get(7));
+
+    // Erasing something missing does nothing
+    table.Erase(3);
+    table.Erase(1000);
+    ASSERT_EQ(2u, table.Size());
+}
+
+TEST(EntityIDTableTest, packedArraysMatch)
+{
+    std::vector<int> objects(1000);
+    EntityIDTable<int> table;
+    for(int i = 0; i < 1000; ++i)
+    {
+        table.Insert(i, &objects[i]);
+    }
+    for(int i = 0; i < 1000; i += 3)
+    {
+        table.Erase(i);
+    }
+
+    const std::vector<int*>& packed = table.GetObjects();
+    const std::vector<int>& ids = table.GetIDs();
+    ASSERT_EQ(packed.size(), ids.size());
+    ASSERT_EQ(666u, table.Size());
+    for(size_t i = 0; i < packed.size(); ++i)
+    {
+        ASSERT_NE(0, ids[i] % 3);
+        ASSERT_EQ(&objects[ids[i]], packed[i]);
+        ASSERT_EQ(packed[i], table.Get(ids[i]));
+    }
+}
+
+TEST(EntityIDTableTest, lookupsMatchUnorderedMap)
+{
+    // Roughly what the game has in a level, with every third entity removed
+    const int entityCount = 4000;
+    const int callCount = 100000;
+    std::vector<int> objects(entityCount);
+    EntityIDTable<int> table;
+    std::unordered_map<int, int*> map;
+    for(int i = 0; i < entityCount; ++i)
+    {
+        objects[i] = i;
+        table.Insert(i, &objects[i]);
+        map[i] = &objects[i];
+    }
+    for(int i = 0; i < entityCount; i += 3)
+    {
+        table.Erase(i);
+        map.erase(i);
+    }
+
+    std::mt19937 generator(1337);
+    std::uniform_int_distribution<int> distribution(-10, entityCount + 10);
+    for(int i = 0; i < callCount; ++i)
+    {
+        const int id = distribution(generator);
+        auto found = map.find(id);
+        if(found != map.end())
+        {
+            ASSERT_TRUE(table.Contains(id));
+            ASSERT_EQ(found->second, table.Get(id));
+        }
+        else
+        {
+            ASSERT_FALSE(table.Contains(id));
+            ASSERT_EQ(nullptr, table.Get(id));
+        }
+    }
+}
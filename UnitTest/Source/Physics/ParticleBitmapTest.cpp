@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+#include <DoremiEngine/Physics/Include/Internal/ParticleClasses/ParticleBitmap.hpp>
+
+#include <vector>
+
+using namespace DoremiEngine::Physics;
+
+TEST(ParticleBitmapTest, countTrailingZeros)
+{
+    for(uint32_t i = 0; i < 32; ++i)
+    {
+        ASSERT_EQ(i, ParticleBitmap::CountTrailingZeros(1u << i));
+        ASSERT_EQ(i, ParticleBitmap::CountTrailingZeros(0xFFFFFFFFu << i));
+    }
+}
+
+TEST(ParticleBitmapTest, forEachSetBitVisitsSetBitsInOrder)
+{
+    // Bits spread over several words, including the first and last bit of a word
+    const std::vector<uint32_t> expected = {0, 5, 31, 32, 63, 64, 100, 127};
+    std::vector<uint32_t> words(ParticleBitmap::WordCount(128), 0);
+    ASSERT_EQ(4u, words.size());
+    for(auto& index : expected)
+    {
+        words[index >> 5] |= 1u << (index & 31);
+    }
+
+    std::vector<uint32_t> visited;
+    ParticleBitmap::ForEachSetBit(words.data(), words.size(), [&visited](const uint32_t& p_index) { visited.push_back(p_index); });
+    ASSERT_EQ(expected, visited);
+
+    ParticleBitmap::Clear(words.data(), 63);
+    ASSERT_FALSE(ParticleBitmap::IsSet(words.data(), 63));
+    ASSERT_TRUE(ParticleBitmap::IsSet(words.data(), 64));
+}
+
+TEST(ParticleBitmapTest, decrementLifeTimes)
+{
+    std::vector<float> lifeTimes = {1.0f, 0.5f, 0.0f, 2.0f, 0.25f};
+    ParticleBitmap::DecrementLifeTimes(lifeTimes.data(), 4, 0.5f);
+    ASSERT_FLOAT_EQ(0.5f, lifeTimes[0]);
+    ASSERT_FLOAT_EQ(0.0f, lifeTimes[1]);
+    ASSERT_FLOAT_EQ(-0.5f, lifeTimes[2]);
+    ASSERT_FLOAT_EQ(1.5f, lifeTimes[3]);
+    // Past the count nothing is touched
+    ASSERT_FLOAT_EQ(0.25f, lifeTimes[4]);
+}
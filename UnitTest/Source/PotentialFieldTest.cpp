@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include <DoremiEngine/AI/Include/Interface/PotentialField/PhermoneTrail.hpp>
+
+using namespace DoremiEngine::AI;
+using namespace DirectX;
+
+TEST(PhermoneTrailTest, pushAndWrap)
+{
+    PhermoneTrail trail;
+    trail.SetLength(3);
+    ASSERT_EQ(0, trail.Size());
+    PhermoneDeposit dropped;
+    for(int i = 0; i < 3; ++i)
+    {
+        ASSERT_FALSE(trail.Push(PhermoneDeposit(XMINT2(i, i * 2), i, nullptr), dropped));
+    }
+    // Full, the oldest is handed back
+    ASSERT_TRUE(trail.Push(PhermoneDeposit(XMINT2(3, 6), 3, nullptr), dropped));
+    ASSERT_EQ(0, dropped.quad.x);
+    ASSERT_TRUE(trail.Push(PhermoneDeposit(XMINT2(4, 8), 4, nullptr), dropped));
+    ASSERT_EQ(1, dropped.quad.x);
+    ASSERT_EQ(1.0, dropped.time);
+
+    // Only the last three remain, oldest first
+    ASSERT_EQ(3, trail.Size());
+    ASSERT_EQ(2, trail[0].quad.x);
+    ASSERT_EQ(3, trail[1].quad.x);
+    ASSERT_EQ(4, trail[2].quad.x);
+    ASSERT_EQ(8, trail.Newest().quad.y);
+
+    trail.PopOldest();
+    ASSERT_EQ(2, trail.Size());
+    ASSERT_EQ(3, trail[0].quad.x);
+}
+
+TEST(PhermoneTrailTest, lengthIsClampedAndShrinks)
+{
+    const size_t maxLength = PhermoneTrail::MAX_LENGTH;
+    PhermoneTrail trail;
+    trail.SetLength(maxLength + 10);
+    ASSERT_EQ(maxLength, trail.GetLength());
+    PhermoneDeposit dropped;
+    for(int i = 0; i < 100; ++i)
+    {
+        trail.Push(PhermoneDeposit(XMINT2(i, 0), 0, nullptr), dropped);
+    }
+    ASSERT_EQ(maxLength, trail.Size());
+    ASSERT_EQ(99, trail.Newest().quad.x);
+
+    // Shrinking drops the oldest
+    trail.SetLength(2);
+    ASSERT_EQ(2, trail.Size());
+    ASSERT_EQ(98, trail[0].quad.x);
+    ASSERT_EQ(99, trail[1].quad.x);
+
+    trail.SetLength(0);
+    ASSERT_EQ(1, trail.GetLength());
+    trail.PopOldest();
+    trail.PopOldest();
+    ASSERT_EQ(0, trail.Size());
+}
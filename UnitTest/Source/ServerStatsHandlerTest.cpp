@@ -0,0 +1,29 @@
+#include <gtest/gtest.h>
+#include <Doremi/Core/Include/ServerStatsHandler.hpp>
+
+#include <vector>
+
+using namespace Doremi::Core;
+
+TEST(ServerStatsHandlerTest, percentiles)
+{
+    std::vector<double> samples;
+    ASSERT_EQ(0.0, ServerStatsHandler::GetPercentile(samples, 0.5));
+
+    // 1 to 100 in an order that isn't sorted
+    for(int i = 0; i < 100; ++i)
+    {
+        samples.push_back(static_cast<double>((i * 37) % 100 + 1));
+    }
+    ASSERT_EQ(50.0, ServerStatsHandler::GetPercentile(samples, 0.5));
+    ASSERT_EQ(90.0, ServerStatsHandler::GetPercentile(samples, 0.9));
+    ASSERT_EQ(99.0, ServerStatsHandler::GetPercentile(samples, 0.99));
+    ASSERT_EQ(100.0, ServerStatsHandler::GetPercentile(samples, 1.0));
+    ASSERT_EQ(1.0, ServerStatsHandler::GetPercentile(samples, 0.0));
+
+    // A single spike shows in the highest percentile only
+    std::vector<double> updates(999, 0.016);
+    updates.push_back(0.2);
+    ASSERT_EQ(0.016, ServerStatsHandler::GetPercentile(updates, 0.99));
+    ASSERT_EQ(0.2, ServerStatsHandler::GetPercentile(updates, 1.0));
+}
@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include <Doremi/Core/Include/Helper/SpatialHash.hpp>
+
+#include <algorithm>
+#include <random>
+
+using namespace Doremi::Core;
+using namespace DirectX;
+
+namespace
+{
+    float DistanceSquared(const XMFLOAT3& p_first, const XMFLOAT3& p_second)
+    {
+        float x = p_first.x - p_second.x;
+        float y = p_first.y - p_second.y;
+        float z = p_first.z - p_second.z;
+        return x * x + y * y + z * z;
+    }
+
+    std::vector<XMFLOAT3> CreateRandomPositions(size_t p_count, float p_worldSize, unsigned p_seed)
+    {
+        std::mt19937 generator(p_seed);
+        std::uniform_real_distribution<float> distribution(-p_worldSize, p_worldSize);
+        std::vector<XMFLOAT3> positions(p_count);
+        for(auto& position : positions)
+        {
+            position = XMFLOAT3(distribution(generator), distribution(generator) * 0.1f, distribution(generator));
+        }
+        return positions;
+    }
+
+    void BruteForceRadius(const std::vector<XMFLOAT3>& p_positions, const XMFLOAT3& p_center, float p_radius, std::vector<uint32_t>& o_entities)
+    {
+        const size_t length = p_positions.size();
+        for(size_t i = 0; i < length; ++i)
+        {
+            if(DistanceSquared(p_positions[i], p_center) <= p_radius * p_radius)
+            {
+                o_entities.push_back(static_cast<uint32_t>(i));
+            }
+        }
+    }
+}
+
+TEST(SpatialHashTest, insertUpdateRemove)
+{
+    SpatialHash hash(10.0f, 2.0f);
+    hash.UpdateEntity(3, XMFLOAT3(0, 0, 0));
+    hash.UpdateEntity(7, XMFLOAT3(5, 0, 0));
+    ASSERT_EQ(2, hash.GetEntityCount());
+    ASSERT_TRUE(hash.Contains(3));
+    ASSERT_FALSE(hash.Contains(4));
+
+    // Move far away, should not be found at the old position anymore
+    hash.UpdateEntity(3, XMFLOAT3(100, 0, 0));
+    std::vector<uint32_t> result;
+    hash.QueryRadius(XMFLOAT3(0, 0, 0), 6.0f, result);
+    ASSERT_EQ(1, result.size());
+    ASSERT_EQ(7, result[0]);
+
+    hash.RemoveEntity(7);
+    hash.RemoveEntity(7);
+    ASSERT_EQ(1, hash.GetEntityCount());
+    result.clear();
+    hash.QueryRadius(XMFLOAT3(0, 0, 0), 6.0f, result);
+    ASSERT_TRUE(result.empty());
+}
+
+TEST(SpatialHashTest, looseMarginKeepsEntityInCell)
+{
+    // Entity just outside its cell, but within the loose margin, must still be found by queries on the other side of the cell border
+    SpatialHash hash(10.0f, 5.0f);
+    hash.UpdateEntity(1, XMFLOAT3(9.0f, 0, 0));
+    hash.UpdateEntity(1, XMFLOAT3(13.0f, 0, 0));
+    std::vector<uint32_t> result;
+    hash.QueryRadius(XMFLOAT3(14.0f, 0, 0), 1.5f, result);
+    ASSERT_EQ(1, result.size());
+    result.clear();
+    hash.QueryAABB(XMFLOAT3(12.5f, -1, -1), XMFLOAT3(13.5f, 1, 1), result);
+    ASSERT_EQ(1, result.size());
+}
+
+TEST(SpatialHashTest, kNearest)
+{
+    SpatialHash hash(10.0f, 2.0f);
+    for(uint32_t i = 0; i < 20; ++i)
+    {
+        hash.UpdateEntity(i, XMFLOAT3(static_cast<float>(i) * 7.0f, 0, 0));
+    }
+    std::vector<uint32_t> result;
+    hash.QueryKNearest(XMFLOAT3(71.0f, 0, 0), 3, 1000.0f, result);
+    ASSERT_EQ(3, result.size());
+    ASSERT_EQ(10, result[0]);
+    ASSERT_EQ(11, result[1]);
+    ASSERT_EQ(9, result[2]);
+
+    // Limited by max radius
+    result.clear();
+    hash.QueryKNearest(XMFLOAT3(71.0f, 0, 0), 3, 2.0f, result);
+    ASSERT_EQ(1, result.size());
+}
+
+TEST(SpatialHashTest, matchesBruteForce)
+{
+    const size_t entityCount = 10000;
+    const float radius = 40.0f;
+    std::vector<XMFLOAT3> positions = CreateRandomPositions(entityCount, 1000.0f, 1337);
+    SpatialHash hash(50.0f, 10.0f);
+    for(size_t i = 0; i < entityCount; ++i)
+    {
+        hash.UpdateEntity(static_cast<uint32_t>(i), positions[i]);
+    }
+    // Move everything a bit so some entities end up outside their cells
+    std::vector<XMFLOAT3> movedPositions = CreateRandomPositions(entityCount, 8.0f, 42);
+    for(size_t i = 0; i < entityCount; ++i)
+    {
+        positions[i] = XMFLOAT3(positions[i].x + movedPositions[i].x, positions[i].y, positions[i].z + movedPositions[i].z);
+        hash.UpdateEntity(static_cast<uint32_t>(i), positions[i]);
+    }
+
+    std::vector<XMFLOAT3> centers = CreateRandomPositions(200, 1000.0f, 7);
+    for(auto& center : centers)
+    {
+        std::vector<uint32_t> expected;
+        std::vector<uint32_t> result;
+        BruteForceRadius(positions, center, radius, expected);
+        hash.QueryRadius(center, radius, result);
+        std::sort(result.begin(), result.end());
+        ASSERT_EQ(expected, result);
+    }
+}
+
+TEST(SpatialHashTest, manyQueriesMatchBruteForce)
+{
+    const size_t entityCount = 10000;
+    const float radius = 40.0f;
+    std::vector<XMFLOAT3> positions = CreateRandomPositions(entityCount, 1000.0f, 1337);
+    std::vector<XMFLOAT3> centers = CreateRandomPositions(entityCount, 1000.0f, 7);
+    SpatialHash hash(50.0f, 10.0f);
+    for(size_t i = 0; i < entityCount; ++i)
+    {
+        hash.UpdateEntity(static_cast<uint32_t>(i), positions[i]);
+    }
+
+    // One radius query per entity, like an AI checking its surroundings every update
+    size_t hashHits = 0;
+    size_t bruteForceHits = 0;
+    std::vector<uint32_t> result;
+    for(auto& center : centers)
+    {
+        result.clear();
+        hash.QueryRadius(center, radius, result);
+        hashHits += result.size();
+        result.clear();
+        BruteForceRadius(positions, center, radius, result);
+        bruteForceHits += result.size();
+    }
+    ASSERT_EQ(bruteForceHits, hashHits);
+}
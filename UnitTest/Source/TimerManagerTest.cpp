@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+#include <Doremi/Core/Include/Timing/TimerManager.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+
+using namespace Doremi::Core;
+
+namespace
+{
+    // Finds the child of a node by the name of its timer, NO_PARENT if there is none
+    uint32_t FindChild(TimerManager& p_timerManager, const FrameProfile& p_profile, const uint32_t& p_parent, const std::string& p_name)
+    {
+        uint32_t child = p_parent == FrameProfile::NO_PARENT ? p_profile.firstRoot : p_profile.nodes[p_parent].firstChild;
+        for(; child != FrameProfile::NO_PARENT; child = p_profile.nodes[child].nextSibling)
+        {
+            if(p_timerManager.GetTimerName(p_profile.nodes[child].timerID) == p_name)
+            {
+                return child;
+            }
+        }
+        return FrameProfile::NO_PARENT;
+    }
+}
+
+TEST(TimerManagerTest, nestedTimersBuildCallTree)
+{
+    TimerManager timerManager;
+    const uint32_t update = timerManager.RegisterTimer("Update");
+    const uint32_t physics = timerManager.RegisterTimer("Physics");
+    const uint32_t ai = timerManager.RegisterTimer("AI");
+    ASSERT_EQ(update, timerManager.RegisterTimer("Update"));
+
+    timerManager.StartTimer(update);
+    for(int i = 0; i < 3; ++i)
+    {
+        timerManager.StartTimer(physics);
+        timerManager.StopTimer(physics);
+    }
+    timerManager.StartTimer(ai);
+    timerManager.StopTimer(ai);
+    timerManager.StopTimer(update);
+    // Same timer outside the first one is a different node
+    timerManager.StartTimer(physics);
+    timerManager.StopTimer(physics);
+    timerManager.EndFrame();
+
+    const FrameProfile& frame = timerManager.GetLastFrame();
+    ASSERT_EQ(1u, frame.frameCount);
+    const uint32_t thread = FindChild(timerManager, frame, FrameProfile::NO_PARENT, "Thread");
+    ASSERT_NE(FrameProfile::NO_PARENT, thread);
+    ASSERT_EQ(frame.frameTicks, frame.nodes[thread].ticks);
+
+    const uint32_t updateNode = FindChild(timerManager, frame, thread, "Update");
+    ASSERT_NE(FrameProfile::NO_PARENT, updateNode);
+    ASSERT_EQ(1u, frame.nodes[updateNode].calls);
+    const uint32_t physicsNode = FindChild(timerManager, frame, updateNode, "Physics");
+    ASSERT_NE(FrameProfile::NO_PARENT, physicsNode);
+    ASSERT_EQ(3u, frame.nodes[physicsNode].calls);
+    ASSERT_LE(frame.nodes[physicsNode].ticks, frame.nodes[updateNode].ticks);
+    // Children keep the order they first ran in
+    ASSERT_EQ(FindChild(timerManager, frame, updateNode, "AI"), frame.nodes[physicsNode].nextSibling);
+
+    const uint32_t outerPhysics = FindChild(timerManager, frame, thread, "Physics");
+    ASSERT_NE(FrameProfile::NO_PARENT, outerPhysics);
+    ASSERT_NE(physicsNode, outerPhysics);
+    ASSERT_EQ(1u, frame.nodes[outerPhysics].calls);
+}
+
+TEST(TimerManagerTest, runningTimerIsSplitBetweenFrames)
+{
+    TimerManager timerManager;
+    const uint32_t loop = timerManager.RegisterTimer("Loop");
+    const uint32_t step = timerManager.RegisterTimer("Step");
+
+    timerManager.StartTimer(loop);
+    for(int i = 0; i < 2; ++i)
+    {
+        timerManager.StartTimer(step);
+        timerManager.StopTimer(step);
+        timerManager.EndFrame();
+
+        const FrameProfile& frame = timerManager.GetLastFrame();
+        const uint32_t thread = FindChild(timerManager, frame, FrameProfile::NO_PARENT, "Thread");
+        const uint32_t loopNode = FindChild(timerManager, frame, thread, "Loop");
+        ASSERT_NE(FrameProfile::NO_PARENT, loopNode);
+        // Not stopped yet, but its time so far is in the frame
+        ASSERT_EQ(0u, frame.nodes[loopNode].calls);
+        ASSERT_GT(frame.nodes[loopNode].ticks, 0u);
+        const uint32_t stepNode = FindChild(timerManager, frame, loopNode, "Step");
+        ASSERT_NE(FrameProfile::NO_PARENT, stepNode);
+        ASSERT_EQ(1u, frame.nodes[stepNode].calls);
+    }
+    timerManager.StopTimer(loop);
+    timerManager.EndFrame();
+
+    const FrameProfile& total = timerManager.GetTotal();
+    ASSERT_EQ(3u, total.frameCount);
+    const uint32_t thread = FindChild(timerManager, total, FrameProfile::NO_PARENT, "Thread");
+    const uint32_t loopNode = FindChild(timerManager, total, thread, "Loop");
+    ASSERT_EQ(1u, total.nodes[loopNode].calls);
+    ASSERT_EQ(2u, total.nodes[FindChild(timerManager, total, loopNode, "Step")].calls);
+}
+
+TEST(TimerManagerTest, threadsGetTheirOwnRoot)
+{
+    TimerManager timerManager;
+    const uint32_t work = timerManager.RegisterTimer("Work");
+
+    timerManager.StartTimer(work);
+    timerManager.StopTimer(work);
+    std::thread worker([&]() {
+        for(int i = 0; i < 4; ++i)
+        {
+            timerManager.StartTimer(work);
+            timerManager.StopTimer(work);
+        }
+    });
+    worker.join();
+    timerManager.EndFrame();
+
+    const FrameProfile& frame = timerManager.GetLastFrame();
+    uint32_t roots = 0;
+    uint32_t calls = 0;
+    for(uint32_t root = frame.firstRoot; root != FrameProfile::NO_PARENT; root = frame.nodes[root].nextSibling)
+    {
+        ++roots;
+        calls += frame.nodes[FindChild(timerManager, frame, root, "Work")].calls;
+    }
+    ASSERT_EQ(2u, roots);
+    ASSERT_EQ(5u, calls);
+}
+
+TEST(TimerManagerTest, fullRingSkipsWholeScopes)
+{
+    TimerManager timerManager;
+    const uint32_t outer = timerManager.RegisterTimer("Outer");
+    const uint32_t inner = timerManager.RegisterTimer("Inner");
+
+    timerManager.StartTimer(outer);
+    // Far more than fits, the ones that don't are dropped along with everything inside them
+    for(uint32_t i = 0; i < TimerManager::THREAD_RING_SIZE; ++i)
+    {
+        timerManager.StartTimer(inner);
+        timerManager.StartTimer(inner);
+        timerManager.StopTimer(inner);
+        timerManager.StopTimer(inner);
+    }
+    timerManager.StopTimer(outer);
+    timerManager.EndFrame();
+
+    const FrameProfile& frame = timerManager.GetLastFrame();
+    const uint32_t thread = FindChild(timerManager, frame, FrameProfile::NO_PARENT, "Thread");
+    const uint32_t outerNode = FindChild(timerManager, frame, thread, "Outer");
+    ASSERT_EQ(1u, frame.nodes[outerNode].calls);
+    const uint32_t innerNode = FindChild(timerManager, frame, outerNode, "Inner");
+    const uint32_t innerInnerNode = FindChild(timerManager, frame, innerNode, "Inner");
+    ASSERT_GT(frame.nodes[innerNode].calls, 0u);
+    ASSERT_LT(frame.nodes[innerNode].calls, TimerManager::THREAD_RING_SIZE);
+    // Only the last recorded one can have lost its nested timer
+    ASSERT_LE(frame.nodes[innerInnerNode].calls, frame.nodes[innerNode].calls);
+    ASSERT_GE(frame.nodes[innerInnerNode].calls + 1, frame.nodes[innerNode].calls);
+
+    // Empty again after the frame
+    timerManager.StartTimer(inner);
+    timerManager.StopTimer(inner);
+    timerManager.EndFrame();
+    const FrameProfile& nextFrame = timerManager.GetLastFrame();
+    const uint32_t nextThread = FindChild(timerManager, nextFrame, FrameProfile::NO_PARENT, "Thread");
+    ASSERT_EQ(1u, nextFrame.nodes[FindChild(timerManager, nextFrame, nextThread, "Inner")].calls);
+}
+
+TEST(TimerManagerTest, traceHasCompleteEvents)
+{
+    TimerManager timerManager;
+    const uint32_t loop = timerManager.RegisterTimer("Loop");
+    const uint32_t step = timerManager.RegisterTimer("Step \"quoted\"");
+    const std::string fileName = "timerManagerTest.json";
+    ASSERT_FALSE(timerManager.WriteTrace(fileName));
+
+    timerManager.StartTraceCapture(60.0, 0.0);
+    timerManager.StartTimer(loop);
+    for(int i = 0; i < 3; ++i)
+    {
+        timerManager.StartTimer(step);
+        timerManager.StopTimer(step);
+        timerManager.EndFrame();
+    }
+    ASSERT_TRUE(timerManager.WriteTrace(fileName));
+    timerManager.StopTimer(loop);
+
+    std::ifstream file(fileName);
+    const std::string trace((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+    std::remove(fileName.c_str());
+
+    size_t steps = 0;
+    for(size_t position = trace.find("\"Step \\\"quoted\\\"\""); position != std::string::npos;
+        position = trace.find("\"Step \\\"quoted\\\"\"", position + 1))
+    {
+        ++steps;
+    }
+    ASSERT_EQ(3u, steps);
+    // Still running, so it ends with the trace
+    ASSERT_NE(std::string::npos, trace.find("\"name\":\"Loop\""));
+    ASSERT_NE(std::string::npos, trace.find("\"thread_name\""));
+    ASSERT_EQ("]}", trace.substr(trace.size() - 3, 2));
+}
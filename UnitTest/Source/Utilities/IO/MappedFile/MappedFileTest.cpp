@@ -0,0 +1,53 @@
+#include <UnitTest/Include/Utilities/IO/MappedFile/MappedFileTest.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+TEST_F(MappedFileTest, missingFile)
+{
+    void* pointer = m_mappedFile->Initialize("mappedFileTestMissing.bin");
+
+    ASSERT_EQ(nullptr, pointer);
+    ASSERT_EQ(0, m_mappedFile->GetSize());
+}
+
+TEST_F(MappedFileTest, readContent)
+{
+    const std::string content = "testing text";
+    {
+        std::ofstream file("mappedFileTest.bin", std::ofstream::out | std::ofstream::binary);
+        file.write(content.c_str(), content.size());
+    }
+
+    void* pointer = m_mappedFile->Initialize("mappedFileTest.bin");
+    ASSERT_NE(nullptr, pointer);
+    ASSERT_EQ(content.size(), m_mappedFile->GetSize());
+    ASSERT_EQ(content, std::string(static_cast<char*>(pointer), m_mappedFile->GetSize()));
+
+    m_mappedFile->Close();
+    ASSERT_EQ(nullptr, m_mappedFile->GetMemory());
+    std::remove("mappedFileTest.bin");
+}
+
+TEST_F(MappedFileTest, writesStayPrivate)
+{
+    const std::string content = "testing text";
+    {
+        std::ofstream file("mappedFileTestPrivate.bin", std::ofstream::out | std::ofstream::binary);
+        file.write(content.c_str(), content.size());
+    }
+
+    char* pointer = static_cast<char*>(m_mappedFile->Initialize("mappedFileTestPrivate.bin"));
+    ASSERT_NE(nullptr, pointer);
+    pointer[0] = 'X';
+    m_mappedFile->Close();
+
+    // The file on disk must not have changed
+    MappedFile second;
+    char* secondPointer = static_cast<char*>(second.Initialize("mappedFileTestPrivate.bin"));
+    ASSERT_NE(nullptr, secondPointer);
+    ASSERT_EQ('t', secondPointer[0]);
+    second.Close();
+    std::remove("mappedFileTestPrivate.bin");
+}
@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include <Utility/Utilities/Include/Logging/BinaryLogData.hpp>
+#include <Utility/Utilities/Include/Logging/BinaryTextFormatter.hpp>
+#include <cstdio>
+#include <string>
+
+using namespace Doremi::Utilities::Logging;
+
+namespace
+{
+    template <typename... Args> std::string WriteAndFormat(const char* p_format, const Args&... p_arguments)
+    {
+        char buffer[256];
+        BinaryArgumentWriter writer(buffer, sizeof(buffer));
+        writer.Write(p_arguments...);
+        return FormatBinaryText(p_format, buffer, writer.GetSize());
+    }
+
+    template <typename... Args> std::string Printf(const char* p_format, const Args&... p_arguments)
+    {
+        char buffer[256];
+        snprintf(buffer, sizeof(buffer), p_format, p_arguments...);
+        return buffer;
+    }
+}
+
+TEST(BinaryTextFormatterTest, matchesPrintf)
+{
+    ASSERT_EQ(Printf("%s:%s:%d, %f", "file.cpp", "Function", 42, 0.125), WriteAndFormat("%s:%s:%d, %f", "file.cpp", "Function", 42, 0.125f));
+    ASSERT_EQ(Printf("%5.2f|%-4d|%04x|%c", 3.14159, 7, 255u, 'a'), WriteAndFormat("%5.2f|%-4d|%04x|%c", 3.14159, 7, 255u, 'a'));
+    ASSERT_EQ(Printf("%lld %llu", -5000000000ll, 5000000000ull), WriteAndFormat("%lld %llu", -5000000000ll, 5000000000ull));
+    ASSERT_EQ(Printf("100%% %.3s", "abcdef"), WriteAndFormat("100%% %.3s", std::string("abcdef")));
+}
+
+TEST(BinaryTextFormatterTest, lengthModifierFollowsStoredArgument)
+{
+    // %d with a 64 bit value and %ld with a 32 bit value still print the value
+    ASSERT_EQ("5000000000 7", WriteAndFormat("%d %ld", 5000000000ll, 7));
+}
+
+TEST(BinaryTextFormatterTest, missingArgumentsAndTruncation)
+{
+    ASSERT_EQ("1 <?>", WriteAndFormat("%d %d", 1));
+
+    // A string longer than the buffer is cut to what fits
+    char buffer[16];
+    BinaryArgumentWriter writer(buffer, sizeof(buffer));
+    writer.Write("a string that is too long", 5);
+    ASSERT_EQ(sizeof(buffer), writer.GetSize());
+    ASSERT_EQ("a string that [<?>]", FormatBinaryText("%s [%d]", buffer, writer.GetSize()));
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <Utility/Utilities/Include/Logging/TelemetryData.hpp>
+#include <Utility/Utilities/Include/Logging/TelemetryFile.hpp>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace Doremi::Utilities::Logging;
+
+namespace
+{
+    TelemetrySchema BuildTickSchema()
+    {
+        TelemetrySchema schema;
+        schema.id = 1;
+        schema.name = "Tick";
+        schema.fields = {{"updateTime", TelemetryFieldType::DOUBLE}, {"entityCount", TelemetryFieldType::INT32}};
+        return schema;
+    }
+
+    template <typename... Args> std::vector<char> WriteValues(const Args&... p_values)
+    {
+        char buffer[64];
+        TelemetryValueWriter writer(buffer, sizeof(buffer));
+        writer.Write(p_values...);
+        return std::vector<char>(buffer, buffer + writer.GetSize());
+    }
+}
+
+TEST(TelemetryFileTest, schemaRoundtrip)
+{
+    const TelemetrySchema schema = BuildTickSchema();
+    std::vector<char> bytes;
+    WriteDataSchema(schema, bytes);
+
+    TelemetrySchema read;
+    ASSERT_TRUE(ReadDataSchema(bytes.data(), bytes.size(), read));
+    ASSERT_EQ(schema.id, read.id);
+    ASSERT_EQ(schema.name, read.name);
+    ASSERT_EQ(2u, read.fields.size());
+    ASSERT_EQ("entityCount", read.fields[1].name);
+    ASSERT_EQ(TelemetryFieldType::INT32, read.fields[1].type);
+    ASSERT_EQ(12u, read.GetRowSize());
+
+    // Cut short
+    ASSERT_FALSE(ReadDataSchema(bytes.data(), bytes.size() - 1, read));
+}
+
+TEST(TelemetryFileTest, rowsRoundtripThroughChunks)
+{
+    const std::string fileName = "telemetryFileTest.drmt";
+    {
+        // Three rows per chunk, so seven rows give two full chunks and one written when closing
+        TelemetryFileWriter writer(3);
+        ASSERT_TRUE(writer.Open(fileName));
+        writer.AddSchema(BuildTickSchema());
+        for(int32_t i = 0; i < 7; ++i)
+        {
+            const std::vector<char> values = WriteValues(0.5 * i, i * 10);
+            ASSERT_TRUE(writer.AddRow(1, 1000 + i, values.data(), static_cast<uint32_t>(values.size())));
+        }
+        // Unknown schema and wrong size are dropped
+        const std::vector<char> values = WriteValues(1.0, 2);
+        ASSERT_FALSE(writer.AddRow(2, 0, values.data(), static_cast<uint32_t>(values.size())));
+        ASSERT_FALSE(writer.AddRow(1, 0, values.data(), 4));
+    }
+
+    TelemetryFileReader reader;
+    ASSERT_TRUE(reader.Open(fileName));
+    TelemetryChunk chunk;
+    std::vector<uint32_t> rowCounts;
+    int32_t row = 0;
+    while(reader.ReadChunk(chunk))
+    {
+        const TelemetrySchema* schema = reader.GetSchema(chunk.schemaId);
+        ASSERT_NE(nullptr, schema);
+        rowCounts.push_back(chunk.rowCount);
+        for(uint32_t i = 0; i < chunk.rowCount; ++i, ++row)
+        {
+            ASSERT_EQ(static_cast<uint64_t>(1000 + row), chunk.timestamps[i]);
+            ASSERT_EQ(0.5 * row, *static_cast<const double*>(chunk.GetValue(*schema, 0, i)));
+            ASSERT_EQ(std::to_string(row * 10), TelemetryFileReader::FormatValue(TelemetryFieldType::INT32, chunk.GetValue(*schema, 1, i)));
+        }
+    }
+    ASSERT_EQ(std::vector<uint32_t>({3, 3, 1}), rowCounts);
+    std::remove(fileName.c_str());
+}
+
+TEST(TelemetryFileTest, stopsAtCutBlock)
+{
+    const std::string fileName = "telemetryFileTestCut.drmt";
+    {
+        TelemetryFileWriter writer(1);
+        ASSERT_TRUE(writer.Open(fileName));
+        writer.AddSchema(BuildTickSchema());
+        const std::vector<char> values = WriteValues(1.0, 2);
+        writer.AddRow(1, 0, values.data(), static_cast<uint32_t>(values.size()));
+        writer.AddRow(1, 1, values.data(), static_cast<uint32_t>(values.size()));
+    }
+    {
+        // Like a crash in the middle of writing the last chunk
+        std::ifstream file(fileName, std::ifstream::binary);
+        std::vector<char> content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        file.close();
+        std::ofstream cut(fileName, std::ofstream::binary | std::ofstream::trunc);
+        cut.write(content.data(), content.size() - 5);
+    }
+
+    TelemetryFileReader reader;
+    ASSERT_TRUE(reader.Open(fileName));
+    TelemetryChunk chunk;
+    ASSERT_TRUE(reader.ReadChunk(chunk));
+    ASSERT_EQ(0u, chunk.timestamps[0]);
+    ASSERT_FALSE(reader.ReadChunk(chunk));
+    std::remove(fileName.c_str());
+}
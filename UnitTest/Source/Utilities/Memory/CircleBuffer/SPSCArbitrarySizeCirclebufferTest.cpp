@@ -0,0 +1,156 @@
+#include <Utilities/Memory/CircleBuffer/SPSCArbitrarySizeCirclebufferTest.hpp>
+#include <Utility/Utilities/Include/Memory/Circlebuffer/SPSCStaticData.hpp>
+#include <Utility/Utilities/Include/IO/FileMap/FileMap.hpp>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// Room for two TestStruct64 records of 72 bytes each
+const uint32_t TWO_RECORD_SIZE = sizeof(SPSCStaticData) + 2 * (sizeof(CircleBufferHeader) + sizeof(TestStruct64));
+
+TEST_F(SPSCArbitrarySizeCirclebufferTest, emptyConsume)
+{
+    m_circleBuffer->Initialize(TWO_RECORD_SIZE);
+
+    CircleBufferHeader* returnHeader = new CircleBufferHeader();
+    TestStruct64* returnData = new TestStruct64();
+    const bool res = m_circleBuffer->Consume(returnHeader, returnData, sizeof(TestStruct64));
+
+    ASSERT_FALSE(res);
+    delete returnHeader;
+    delete returnData;
+}
+
+TEST_F(SPSCArbitrarySizeCirclebufferTest, toManyProduce)
+{
+    m_circleBuffer->Initialize(TWO_RECORD_SIZE);
+
+    CircleBufferHeader sendHeader;
+    sendHeader.packageSize = sizeof(TestStruct64);
+    TestStruct64 sendData;
+
+    ASSERT_TRUE(m_circleBuffer->Produce(sendHeader, &sendData));
+    ASSERT_TRUE(m_circleBuffer->Produce(sendHeader, &sendData));
+    ASSERT_FALSE(m_circleBuffer->Produce(sendHeader, &sendData));
+}
+
+TEST_F(SPSCArbitrarySizeCirclebufferTest, wrapAroundWithDifferentSizes)
+{
+    // Record sizes which don't divide the capacity, so records end up split over the end of the buffer
+    m_circleBuffer->Initialize(sizeof(SPSCStaticData) + 200);
+
+    CircleBufferHeader* returnHeader = new CircleBufferHeader();
+    std::vector<uint8_t> sendData(64);
+    std::vector<uint8_t> returnData(64);
+    for(int i = 0; i < 200; ++i)
+    {
+        CircleBufferHeader sendHeader;
+        sendHeader.packageType = CircleBufferType(i % 2 == 0 ? CircleBufferTypeEnum::TEXT : CircleBufferTypeEnum::DATA);
+        sendHeader.packageSize = 1 + (i * 7) % 64;
+        for(int j = 0; j < sendHeader.packageSize; ++j)
+        {
+            sendData[j] = static_cast<uint8_t>(i + j);
+        }
+        ASSERT_TRUE(m_circleBuffer->Produce(sendHeader, sendData.data()));
+
+        ASSERT_TRUE(m_circleBuffer->Consume(returnHeader, returnData.data(), static_cast<uint32_t>(returnData.size())));
+        ASSERT_EQ(sendHeader.packageSize, returnHeader->packageSize);
+        ASSERT_EQ(CircleBufferType(sendHeader.packageType).typeValue, CircleBufferType(returnHeader->packageType).typeValue);
+        for(int j = 0; j < sendHeader.packageSize; ++j)
+        {
+            ASSERT_EQ(static_cast<uint8_t>(i + j), returnData[j]);
+        }
+    }
+    ASSERT_FALSE(m_circleBuffer->Consume(returnHeader, returnData.data(), static_cast<uint32_t>(returnData.size())));
+    delete returnHeader;
+}
+
+TEST_F(SPSCArbitrarySizeCirclebufferTest, tooLargeRecordIsSkipped)
+{
+    m_circleBuffer->Initialize(300);
+
+    CircleBufferHeader sendHeader;
+    sendHeader.packageSize = sizeof(TestStruct64);
+    TestStruct64 sendData;
+    sendData.f1 = 4;
+    m_circleBuffer->Produce(sendHeader, &sendData);
+    sendHeader.packageSize = sizeof(float);
+    m_circleBuffer->Produce(sendHeader, &sendData);
+
+    CircleBufferHeader* returnHeader = new CircleBufferHeader();
+    float returnData = 0;
+    ASSERT_TRUE(m_circleBuffer->Consume(returnHeader, &returnData, sizeof(float)));
+    ASSERT_EQ(4, returnData);
+    ASSERT_EQ(1, m_circleBuffer->GetDroppedCount());
+    delete returnHeader;
+}
+
+TEST_F(SPSCArbitrarySizeCirclebufferTest, twoBuffersUsingOneFileMapToMemory)
+{
+    using namespace Doremi::Utilities::IO;
+    FileMap fileMap;
+    void* memory = fileMap.Initialize("spsctest", TWO_RECORD_SIZE);
+    ASSERT_NE(nullptr, memory); // Assert not null
+
+    // One side resets, like the game does before starting the loggerprocess
+    m_circleBuffer->Initialize(memory, TWO_RECORD_SIZE, true, "spsctest_wakeup");
+    SPSCArbitrarySizeCirclebuffer* otherBuffer = new SPSCArbitrarySizeCirclebuffer();
+    otherBuffer->Initialize(memory, TWO_RECORD_SIZE, false, "spsctest_wakeup");
+
+    CircleBufferHeader sendHeader;
+    sendHeader.packageSize = sizeof(TestStruct64);
+    TestStruct64 sendData;
+    CircleBufferHeader* returnHeader = new CircleBufferHeader();
+    TestStruct64* returnData = new TestStruct64();
+
+    for(int i = 0; i < 10; ++i)
+    {
+        sendData.f1 = static_cast<float>(i);
+        ASSERT_TRUE(m_circleBuffer->Produce(sendHeader, &sendData));
+        ASSERT_TRUE(otherBuffer->WaitForData(std::chrono::milliseconds(0)));
+        ASSERT_TRUE(otherBuffer->Consume(returnHeader, returnData, sizeof(TestStruct64)));
+        ASSERT_EQ(i, returnData->f1);
+    }
+    ASSERT_FALSE(otherBuffer->Consume(returnHeader, returnData, sizeof(TestStruct64)));
+
+    delete otherBuffer;
+    delete returnHeader;
+    delete returnData;
+}
+
+TEST_F(SPSCArbitrarySizeCirclebufferTest, producerAndConsumerThreadsKeepOrder)
+{
+    m_circleBuffer->Initialize(1024);
+    const uint32_t count = 100000;
+
+    std::thread producer([this, count]() {
+        CircleBufferHeader sendHeader;
+        for(uint32_t i = 0; i < count; ++i)
+        {
+            // Varying size so records wrap at different offsets
+            uint32_t sendData[4] = {i, i, i, i};
+            sendHeader.packageSize = sizeof(uint32_t) * (1 + i % 4);
+            while(!m_circleBuffer->Produce(sendHeader, sendData))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    CircleBufferHeader* returnHeader = new CircleBufferHeader();
+    uint32_t returnData[4];
+    uint32_t expected = 0;
+    while(expected < count)
+    {
+        if(!m_circleBuffer->Consume(returnHeader, returnData, sizeof(returnData)))
+        {
+            m_circleBuffer->WaitForData(std::chrono::milliseconds(100));
+            continue;
+        }
+        ASSERT_EQ(sizeof(uint32_t) * (1 + expected % 4), returnHeader->packageSize);
+        ASSERT_EQ(expected, returnData[0]);
+        ++expected;
+    }
+    producer.join();
+    delete returnHeader;
+}
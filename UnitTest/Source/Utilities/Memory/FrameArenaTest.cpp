@@ -0,0 +1,83 @@
+#include <Utilities/Memory/FrameArenaTest.hpp>
+#include <Utilities/Memory/TestStruct64.hpp>
+
+TEST_F(FrameArenaTest, basicInitialization)
+{
+    m_frameArena->Initialize(1024);
+    ASSERT_EQ(1024u, m_frameArena->GetFrameMemorySize());
+    ASSERT_EQ(0u, m_frameArena->GetMemorySpecification().occupied);
+    ASSERT_EQ(2064u, m_frameArena->GetMemorySpecification().total);
+}
+
+TEST_F(FrameArenaTest, allocationAlignment)
+{
+    m_frameArena->Initialize(1024);
+    void* first = m_frameArena->Allocate(3, 1);
+    void* second = m_frameArena->Allocate(sizeof(TestStruct64), 16);
+    ASSERT_EQ(0u, reinterpret_cast<size_t>(first) % 16);
+    ASSERT_EQ(0u, reinterpret_cast<size_t>(second) % 16);
+    // Padded up to the alignment of the second allocation
+    ASSERT_EQ(16u + sizeof(TestStruct64), m_frameArena->GetMemorySpecification().occupied);
+    ASSERT_THROW(m_frameArena->Allocate(8, 3), std::runtime_error);
+}
+
+TEST_F(FrameArenaTest, lastFrameStaysValid)
+{
+    m_frameArena->Initialize(1024);
+    int* first = static_cast<int*>(m_frameArena->Allocate(sizeof(int), alignof(int)));
+    *first = 1;
+    m_frameArena->SwapFrames();
+    int* second = static_cast<int*>(m_frameArena->Allocate(sizeof(int), alignof(int)));
+    *second = 2;
+    ASSERT_NE(first, second);
+    ASSERT_EQ(1, *first);
+    ASSERT_EQ(1u, m_frameArena->GetLastFrameStatistics().allocations);
+
+    // The third frame reuses the memory of the first
+    m_frameArena->SwapFrames();
+    ASSERT_EQ(first, m_frameArena->Allocate(sizeof(int), alignof(int)));
+    ASSERT_EQ(2, *second);
+}
+
+TEST_F(FrameArenaTest, fullFrameGoesToHeap)
+{
+    m_frameArena->Initialize(64);
+    m_frameArena->Allocate(48, 16);
+    void* overflow = m_frameArena->Allocate(sizeof(TestStruct64), 16);
+    ASSERT_NE(nullptr, overflow);
+    ASSERT_EQ(0u, reinterpret_cast<size_t>(overflow) % 16);
+    m_frameArena->SwapFrames();
+
+    const FrameArenaStatistics& statistics = m_frameArena->GetLastFrameStatistics();
+    ASSERT_EQ(2u, statistics.allocations);
+    ASSERT_EQ(48u + sizeof(TestStruct64), statistics.allocatedBytes);
+    ASSERT_EQ(1u, statistics.overflowAllocations);
+    ASSERT_EQ(sizeof(TestStruct64), statistics.overflowBytes);
+    ASSERT_EQ(48u + sizeof(TestStruct64), m_frameArena->GetPeakFrameBytes());
+    ASSERT_EQ(1u, m_frameArena->GetTotalOverflowAllocations());
+}
+
+TEST_F(FrameArenaTest, containersUseTheArena)
+{
+    m_frameArena->Initialize(4096);
+    {
+        FrameVector<int> numbers(*m_frameArena);
+        numbers.reserve(16);
+        for(int i = 0; i < 16; ++i)
+        {
+            numbers.push_back(i);
+        }
+        FrameMap<int, float> damage(*m_frameArena);
+        damage[3] += 10.0f;
+        damage[3] += 2.0f;
+        FrameSet<int> removed(*m_frameArena);
+        removed.insert(7);
+
+        ASSERT_EQ(15, numbers.back());
+        ASSERT_EQ(12.0f, damage[3]);
+        ASSERT_EQ(1u, removed.count(7));
+    }
+    m_frameArena->SwapFrames();
+    ASSERT_GE(m_frameArena->GetLastFrameStatistics().allocations, 3u);
+    ASSERT_EQ(0u, m_frameArena->GetLastFrameStatistics().overflowAllocations);
+}
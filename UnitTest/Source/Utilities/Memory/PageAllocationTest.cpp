@@ -0,0 +1,57 @@
+#include <Utilities/Memory/PageAllocationTest.hpp>
+#include <cstdint>
+
+TEST_F(PageAllocationTest, regularPagesAreZeroed)
+{
+    m_allocation = MemoryAllocator::AllocatePages(10000, PageOptions());
+    ASSERT_NE(nullptr, m_allocation.memory);
+    ASSERT_FALSE(m_allocation.largePages);
+    ASSERT_LE(10000u, m_allocation.size);
+    // Whole pages
+    ASSERT_EQ(0u, m_allocation.size % 4096);
+    ASSERT_EQ(0u, reinterpret_cast<size_t>(m_allocation.memory) % 4096);
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(m_allocation.memory);
+    for(size_t i = 0; i < m_allocation.size; ++i)
+    {
+        ASSERT_EQ(0, bytes[i]);
+    }
+}
+
+TEST_F(PageAllocationTest, largePagesFallBack)
+{
+    // Gets large pages only if the system has some to give, regular pages otherwise
+    const size_t size = 3 * 1024 * 1024;
+    m_allocation = MemoryAllocator::AllocatePages(size, PageOptions(true, -1));
+    ASSERT_NE(nullptr, m_allocation.memory);
+    ASSERT_LE(size, m_allocation.size);
+    if(m_allocation.largePages)
+    {
+        ASSERT_EQ(0u, m_allocation.size % MemoryAllocator::GetLargePageSize());
+    }
+    static_cast<uint8_t*>(m_allocation.memory)[size - 1] = 1;
+}
+
+TEST_F(PageAllocationTest, smallBlocksGetRegularPages)
+{
+    m_allocation = MemoryAllocator::AllocatePages(1000, PageOptions(true, -1));
+    ASSERT_NE(nullptr, m_allocation.memory);
+    ASSERT_FALSE(m_allocation.largePages);
+}
+
+TEST_F(PageAllocationTest, numaNodeFallsBack)
+{
+    // A node the machine hardly has, the pages are placed elsewhere
+    m_allocation = MemoryAllocator::AllocatePages(64 * 1024, PageOptions(false, 60));
+    ASSERT_NE(nullptr, m_allocation.memory);
+    static_cast<uint8_t*>(m_allocation.memory)[0] = 1;
+}
+
+TEST_F(PageAllocationTest, allocatorOnPages)
+{
+    PageBackedAllocator allocator;
+    allocator.Initialize(1024 * 1024, PageOptions(true, 0));
+    ASSERT_NE(nullptr, allocator.GetStart());
+    ASSERT_EQ(0u, reinterpret_cast<size_t>(allocator.GetStart()) % 16);
+    ASSERT_EQ(0, *static_cast<uint8_t*>(allocator.GetStart()));
+}
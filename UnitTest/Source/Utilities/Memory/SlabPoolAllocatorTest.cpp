@@ -0,0 +1,160 @@
+#include <Utilities/Memory/SlabPoolAllocatorTest.hpp>
+#include <Utility/Utilities/Include/Memory/Pool/SlabPoolResource.hpp>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    struct CountedObject
+    {
+        explicit CountedObject(int& p_counter, const int& p_value) : counter(p_counter), value(p_value) { ++counter; }
+        ~CountedObject() { --counter; }
+        int& counter;
+        int value;
+    };
+}
+
+TEST_F(SlabPoolAllocatorTest, growsInsteadOfRunningOut)
+{
+    m_slabPool->Initialize(sizeof(TestStruct64), 16, 64);
+    ASSERT_EQ(0u, m_slabPool->GetSlabCount());
+
+    std::vector<void*> blocks;
+    for(int i = 0; i < 1000; ++i)
+    {
+        void* block = m_slabPool->Allocate();
+        ASSERT_EQ(0u, reinterpret_cast<size_t>(block) % 16);
+        blocks.push_back(block);
+    }
+    ASSERT_GE(m_slabPool->GetCapacity(), 1000u);
+    const size_t slabCount = m_slabPool->GetSlabCount();
+
+    std::sort(blocks.begin(), blocks.end());
+    ASSERT_EQ(blocks.end(), std::adjacent_find(blocks.begin(), blocks.end()));
+    for(size_t i = 1; i < blocks.size(); ++i)
+    {
+        // Blocks never overlap
+        ASSERT_GE(reinterpret_cast<size_t>(blocks[i]) - reinterpret_cast<size_t>(blocks[i - 1]), sizeof(TestStruct64));
+    }
+
+    // Freed blocks are reused before the pool grows again
+    for(auto& block : blocks)
+    {
+        m_slabPool->Free(block);
+    }
+    for(int i = 0; i < 1000; ++i)
+    {
+        m_slabPool->Allocate();
+    }
+    ASSERT_EQ(slabCount, m_slabPool->GetSlabCount());
+}
+
+TEST_F(SlabPoolAllocatorTest, blocksMoveBetweenThreads)
+{
+    m_slabPool->Initialize(sizeof(int), alignof(int), 128);
+    const int blockCount = 10000;
+    std::vector<void*> blocks(blockCount);
+    std::thread producer([&]() {
+        for(int i = 0; i < blockCount; ++i)
+        {
+            blocks[i] = m_slabPool->Allocate();
+            *static_cast<int*>(blocks[i]) = i;
+        }
+    });
+    producer.join();
+
+    // Freed on another thread than allocated, which then allocates them again
+    std::thread consumer([&]() {
+        for(int i = 0; i < blockCount; ++i)
+        {
+            ASSERT_EQ(i, *static_cast<int*>(blocks[i]));
+            m_slabPool->Free(blocks[i]);
+        }
+        for(int i = 0; i < blockCount; ++i)
+        {
+            blocks[i] = m_slabPool->Allocate();
+        }
+    });
+    consumer.join();
+
+    std::sort(blocks.begin(), blocks.end());
+    ASSERT_EQ(blocks.end(), std::adjacent_find(blocks.begin(), blocks.end()));
+}
+
+TEST(ObjectPoolTest, constructsInPlace)
+{
+    int counter = 0;
+    ObjectPool<CountedObject> pool(16);
+    CountedObject* first = pool.Create(counter, 1);
+    CountedObject* second = pool.Create(counter, 2);
+    ASSERT_EQ(2, counter);
+    ASSERT_EQ(1, first->value);
+    ASSERT_EQ(2, second->value);
+
+    pool.Destroy(first);
+    pool.Destroy(second);
+    ASSERT_EQ(0, counter);
+}
+
+TEST(SlabPoolResourceTest, sizesArePooledByPowerOfTwo)
+{
+    SlabPoolResource resource(64);
+    ASSERT_EQ(16u, resource.GetPool(1)->GetBlockSize());
+    ASSERT_EQ(16u, resource.GetPool(16)->GetBlockSize());
+    ASSERT_EQ(32u, resource.GetPool(17)->GetBlockSize());
+    ASSERT_EQ(SlabPoolResource::LARGEST_SIZE, resource.GetPool(SlabPoolResource::LARGEST_SIZE)->GetBlockSize());
+    ASSERT_EQ(nullptr, resource.GetPool(SlabPoolResource::LARGEST_SIZE + 1));
+
+    void* small = resource.Allocate(24);
+    void* large = resource.Allocate(SlabPoolResource::LARGEST_SIZE + 1);
+    ASSERT_EQ(0u, reinterpret_cast<size_t>(small) % SlabPoolResource::SMALLEST_SIZE);
+    ASSERT_EQ(1u, resource.GetPool(24)->GetSlabCount());
+    resource.Deallocate(small, 24);
+    resource.Deallocate(large, SlabPoolResource::LARGEST_SIZE + 1);
+}
+
+TEST_F(SlabPoolAllocatorTest, threadsNeverShareBlocks)
+{
+    // Like events, short lived objects created and deleted by several threads at once
+    const int threadCount = 4;
+    const int roundCount = 2000;
+    const int objectsPerRound = 64;
+    m_slabPool->Initialize(sizeof(int), alignof(int), 1024);
+
+    std::vector<std::thread> threads;
+    std::vector<int> failures(threadCount, 0);
+    for(int thread = 0; thread < threadCount; ++thread)
+    {
+        threads.push_back(std::thread([&, thread]() {
+            std::vector<void*> objects(objectsPerRound);
+            for(int round = 0; round < roundCount; ++round)
+            {
+                const int mark = thread * roundCount + round;
+                for(auto& object : objects)
+                {
+                    object = m_slabPool->Allocate();
+                    *static_cast<int*>(object) = mark;
+                }
+                // Another thread writing to one of our blocks would change its mark
+                for(auto& object : objects)
+                {
+                    if(*static_cast<int*>(object) != mark)
+                    {
+                        ++failures[thread];
+                    }
+                    m_slabPool->Free(object);
+                }
+            }
+        }));
+    }
+    for(auto& thread : threads)
+    {
+        thread.join();
+    }
+    for(int thread = 0; thread < threadCount; ++thread)
+    {
+        ASSERT_EQ(0, failures[thread]);
+    }
+}
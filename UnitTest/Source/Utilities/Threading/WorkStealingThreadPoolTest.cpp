@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+#include <Utility/Utilities/Include/Threading/WorkStealingThreadPool.hpp>
+
+#include <atomic>
+#include <vector>
+
+using namespace Doremi::Utilities::Threading;
+
+TEST(WorkStealingThreadPoolTest, runsAllJobs)
+{
+    WorkStealingThreadPool pool(4);
+    ASSERT_EQ(4, pool.GetThreadCount());
+    ASSERT_EQ(pool.GetThreadCount(), pool.GetCurrentWorkerIndex());
+
+    std::atomic<uint32_t> counter(0);
+    for(uint32_t i = 0; i < 1000; ++i)
+    {
+        pool.Submit([&counter]() { counter.fetch_add(1); });
+    }
+    pool.WaitUntilIdle();
+    ASSERT_EQ(1000, counter.load());
+}
+
+TEST(WorkStealingThreadPoolTest, jobsSubmittedFromWorkers)
+{
+    WorkStealingThreadPool pool(3);
+    std::atomic<uint32_t> counter(0);
+    std::vector<std::atomic<uint32_t>> jobsPerWorker(3);
+    for(auto& jobs : jobsPerWorker)
+    {
+        jobs.store(0);
+    }
+
+    // Every job spawns children from inside the worker, which the other workers have to steal to help out
+    for(uint32_t i = 0; i < 10; ++i)
+    {
+        pool.Submit([&pool, &counter, &jobsPerWorker]()
+                    {
+                        for(uint32_t j = 0; j < 100; ++j)
+                        {
+                            pool.Submit([&pool, &counter, &jobsPerWorker]()
+                                        {
+                                            jobsPerWorker[pool.GetCurrentWorkerIndex()].fetch_add(1);
+                                            counter.fetch_add(1);
+                                        });
+                        }
+                    });
+    }
+    pool.WaitUntilIdle();
+    ASSERT_EQ(1000, counter.load());
+
+    uint32_t total = 0;
+    for(auto& jobs : jobsPerWorker)
+    {
+        total += jobs.load();
+    }
+    ASSERT_EQ(1000, total);
+}
+
+TEST(WorkStealingThreadPoolTest, destructorFinishesJobs)
+{
+    std::atomic<uint32_t> counter(0);
+    {
+        WorkStealingThreadPool pool(2);
+        for(uint32_t i = 0; i < 100; ++i)
+        {
+            pool.Submit([&counter]() { counter.fetch_add(1); });
+        }
+    }
+    ASSERT_EQ(100, counter.load());
+}
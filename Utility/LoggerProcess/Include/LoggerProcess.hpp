@@ -3,10 +3,13 @@
 #include <SpecificLogFile.hpp>
 #include <Utility/Utilities/Include/Logging/LogTag.hpp>
 
-#include <Utility/Utilities/Include/Memory/Circlebuffer/ArbitrarySizeCirclebuffer.hpp>
+#include <Utility/Utilities/Include/Memory/Circlebuffer/SPSCArbitrarySizeCirclebuffer.hpp>
 #include <Utility/Utilities/Include/Logging/LogTextData.hpp>
+#include <Utility/Utilities/Include/Logging/TelemetryFile.hpp>
 #include <Utility/Utilities/Include/Chrono/Timer.hpp>
 #include <map>
+#include <string>
+#include <vector>
 
 namespace Doremi
 {
@@ -15,7 +18,6 @@ namespace Doremi
         namespace IO
         {
             class FileMap;
-            class Mutex;
         }
     }
 }
@@ -51,14 +53,45 @@ public:
 private:
     void* InitializeFileMap(const std::size_t& p_size);
     void SetupCircleBuffer();
-    Doremi::Utilities::IO::Mutex* CreateFileMapMutex();
     void SetupFolderStructure();
     void BuildLogFiles();
 
+    /**
+    Keeps the call site of binary text, the game sends it once before the first text using it
+    */
+    void RegisterFormatSite(void* p_data);
+
+    /**
+    Formats binary text with the format string of its call site and writes it to the logfile of its tag
+    */
+    void WriteBinaryText(void* p_data);
+
+    /**
+    Adds the layout of telemetry records to the telemetry file, the game sends it once before the first record using it
+    */
+    void RegisterDataSchema(void* p_data, const uint32_t& p_size);
+
+    /**
+    Adds a telemetry record to the telemetry file, it is written at the next flush or when enough records of its schema
+    have been collected
+    */
+    void WriteData(void* p_data);
+
+    struct FormatSite
+    {
+        std::string function;
+        std::string format;
+        uint16_t line;
+    };
+
     Doremi::Utilities::Chrono::Timer m_timer;
     Doremi::Utilities::IO::FileMap* m_fileMap;
-    Doremi::Utilities::Memory::ArbitrarySizeCirclebuffer* m_ingoingBuffer;
+    Doremi::Utilities::Memory::SPSCArbitrarySizeCirclebuffer* m_ingoingBuffer;
     std::map<Doremi::Utilities::Logging::LogTag, SpecificLogFile> m_logfiles;
+    // Indexed by site id - 1
+    std::vector<FormatSite> m_formatSites;
+    Doremi::Utilities::Logging::TelemetryFileWriter m_telemetryFile;
+    // Records not matching a schema, reported once when the game stops
+    uint32_t m_droppedDataCount;
     int m_processIdOfGame;
-    Doremi::Utilities::IO::Mutex* m_mutex;
 };
\ No newline at end of file
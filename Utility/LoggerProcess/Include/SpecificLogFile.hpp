@@ -12,6 +12,7 @@ namespace Doremi
         namespace Logging
         {
             enum class LogTag : uint8_t;
+            enum class LogLevel : uint8_t;
             struct LogTextData;
         }
     }
@@ -40,6 +41,11 @@ public:
     */
     void Write(void*& p_data);
 
+    /**
+    Writes an already built message, used for text formatted in this process.
+    */
+    void Write(const Doremi::Utilities::Logging::LogLevel& p_logLevel, const char* p_message);
+
     /**
     Forcily flushes the data in the buffer to a file on the disk.
     */
@@ -48,6 +54,7 @@ public:
 private:
     void BuildLogFile(const std::string& p_fileName);
     void OpenFileStream(const std::string& p_fileName);
+    Doremi::Utilities::Logging::LogTag m_logTag;
     std::ofstream* m_fileStream;
     Doremi::Utilities::Chrono::Timer* m_timer;
     double m_flushTimerLimit;
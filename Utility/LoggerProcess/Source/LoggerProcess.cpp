@@ -5,6 +5,10 @@
 #include <Utility/Utilities/Include/Constants/LoggerConstants.hpp>
 #include <Utility/Utilities/Include/Chrono/Timer.hpp>
 #include <Utility/Utilities/Include/Logging/HelpFunctions.hpp>
+#include <Utility/Utilities/Include/Logging/BinaryLogData.hpp>
+#include <Utility/Utilities/Include/Logging/BinaryTextFormatter.hpp>
+#include <Utility/Utilities/Include/Logging/TelemetryData.hpp>
+#include <Utility/Utilities/Include/PointerArithmetic/PointerArithmetic.hpp>
 
 #include <time.h>
 #include <Windows.h>
@@ -13,7 +17,9 @@
 
 using namespace Doremi::Utilities;
 
-LoggerProcess::LoggerProcess() : m_fileMap(nullptr), m_ingoingBuffer(nullptr), m_mutex(nullptr) {}
+LoggerProcess::LoggerProcess() : m_fileMap(nullptr), m_ingoingBuffer(nullptr), m_telemetryFile(Constants::TELEMETRY_CHUNK_ROWS), m_droppedDataCount(0)
+{
+}
 
 LoggerProcess::~LoggerProcess()
 {
@@ -26,11 +32,6 @@ LoggerProcess::~LoggerProcess()
     {
         delete m_ingoingBuffer;
     }
-
-    if(m_mutex != nullptr)
-    {
-        delete m_mutex;
-    }
 }
 
 void LoggerProcess::Initialize(const int& p_uniqueId)
@@ -38,18 +39,22 @@ void LoggerProcess::Initialize(const int& p_uniqueId)
     m_processIdOfGame = p_uniqueId;
     SetupFolderStructure();
     BuildLogFiles();
+    if(!m_telemetryFile.Open(Constants::TELEMETRY_FILE_NAME))
+    {
+        throw std::runtime_error("Failed to create telemetry file.");
+    }
     SetupCircleBuffer();
     void* fileMapMemory = InitializeFileMap(Constants::IPC_FILEMAP_SIZE);
-    m_mutex = CreateFileMapMutex();
-    m_ingoingBuffer->Initialize(fileMapMemory, Constants::IPC_FILEMAP_SIZE, m_mutex);
+    // The game reset the buffer before it started this process
+    m_ingoingBuffer->Initialize(fileMapMemory, Constants::IPC_FILEMAP_SIZE, false, Logging::BuildFileMapWakeupName(m_processIdOfGame));
 }
 
 void LoggerProcess::Run()
 {
     using namespace Doremi::Utilities;
 
-    // Create temporary data/header memory
-    const uint32_t sizeOfBuffer = 1000;
+    // Create temporary data/header memory, anything that fit in the filemap fits here
+    const uint32_t sizeOfBuffer = Constants::IPC_FILEMAP_SIZE;
     void* buffer = malloc(sizeOfBuffer);
     Memory::CircleBufferHeader* header = new Memory::CircleBufferHeader();
 
@@ -62,7 +67,6 @@ void LoggerProcess::Run()
     {
         // Consume data from shared memory
         messageExist = m_ingoingBuffer->Consume(header, buffer, sizeOfBuffer);
-        gameIsRunning = IsGameRunning();
 
         // If any data existed
         if(messageExist)
@@ -74,9 +78,21 @@ void LoggerProcess::Run()
                 // Send data to logfile
                 m_logfiles[textMetaData->logTag].Write(buffer);
             }
+            else if(header->packageType == Memory::CircleBufferTypeEnum::FORMAT_SITE)
+            {
+                RegisterFormatSite(buffer);
+            }
+            else if(header->packageType == Memory::CircleBufferTypeEnum::BINARY_TEXT)
+            {
+                WriteBinaryText(buffer);
+            }
+            else if(header->packageType == Memory::CircleBufferTypeEnum::DATA_SCHEMA)
+            {
+                RegisterDataSchema(buffer, header->packageSize);
+            }
             else if(header->packageType == Memory::CircleBufferTypeEnum::DATA)
             {
-                // TODORT
+                WriteData(buffer);
             }
 
             // Reset elapsed time
@@ -84,10 +100,9 @@ void LoggerProcess::Run()
         }
         else
         {
-            using namespace std::literals;
-            // TODORT
-            // TODOXX is 10ms good?
-            std::this_thread::sleep_for(Constants::LOGGING_CONSUME_TIME_WAIT);
+            // Sleeps until the game logs something, waking up now and then to flush and to see if the game is still running
+            m_ingoingBuffer->WaitForData(Constants::LOGGING_CONSUME_WAKEUP_TIMEOUT);
+            gameIsRunning = IsGameRunning();
         }
 
         // Compute delta time
@@ -102,6 +117,8 @@ void LoggerProcess::Run()
             {
                 logfile.second.Flush();
             }
+            m_telemetryFile.Flush();
+            flushTimer = 0;
         }
 
         // If elapsed time since last log is greater than a timeout
@@ -113,6 +130,13 @@ void LoggerProcess::Run()
         }
     }
 
+    if(m_droppedDataCount > 0)
+    {
+        const std::string message = std::to_string(m_droppedDataCount) + " telemetry records didn't match their schema and were dropped";
+        m_logfiles[Logging::LogTag::GENERAL].Write(Logging::LogLevel::WARNING, message.c_str());
+    }
+    m_telemetryFile.Close();
+
     // Release temporary memory
     free(buffer);
     delete header;
@@ -144,22 +168,7 @@ void* LoggerProcess::InitializeFileMap(const std::size_t& p_size)
     }
 }
 
-void LoggerProcess::SetupCircleBuffer() { m_ingoingBuffer = new Memory::ArbitrarySizeCirclebuffer(); }
-
-IO::Mutex* LoggerProcess::CreateFileMapMutex()
-{
-    IO::Mutex* mutex = new IO::FileMapMutex();
-    const bool success = mutex->Initialize(Logging::BuildFileMapMutexName(m_processIdOfGame));
-    if(success)
-    {
-        return mutex;
-    }
-    else
-    {
-        delete mutex;
-        throw std::runtime_error("Failed to initialize filemap mutex.");
-    }
-}
+void LoggerProcess::SetupCircleBuffer() { m_ingoingBuffer = new Memory::SPSCArbitrarySizeCirclebuffer(); }
 
 void LoggerProcess::SetupFolderStructure()
 {
@@ -185,6 +194,58 @@ void LoggerProcess::BuildLogFiles()
     }
 }
 
+void LoggerProcess::RegisterFormatSite(void* p_data)
+{
+    const Logging::FormatSiteMetaData* metaData = static_cast<Logging::FormatSiteMetaData*>(p_data);
+    const char* function = static_cast<char*>(PointerArithmetic::Addition(p_data, sizeof(Logging::FormatSiteMetaData)));
+    const char* format = function + metaData->functionLength;
+
+    if(m_formatSites.size() < metaData->siteId)
+    {
+        m_formatSites.resize(metaData->siteId);
+    }
+    FormatSite& site = m_formatSites[metaData->siteId - 1];
+    site.function = function;
+    site.format = format;
+    site.line = metaData->line;
+}
+
+void LoggerProcess::WriteBinaryText(void* p_data)
+{
+    const Logging::BinaryTextMetaData* metaData = static_cast<Logging::BinaryTextMetaData*>(p_data);
+    const void* arguments = PointerArithmetic::Addition(p_data, sizeof(Logging::BinaryTextMetaData));
+
+    std::string message;
+    if(metaData->siteId == 0 || metaData->siteId > m_formatSites.size())
+    {
+        message = "Binary text from unknown call site " + std::to_string(metaData->siteId);
+    }
+    else
+    {
+        message = Logging::FormatBinaryText(m_formatSites[metaData->siteId - 1].format.c_str(), arguments, metaData->argumentSize);
+    }
+    m_logfiles[metaData->logTag].Write(metaData->logLevel, message.c_str());
+}
+
+void LoggerProcess::RegisterDataSchema(void* p_data, const uint32_t& p_size)
+{
+    Logging::TelemetrySchema schema;
+    if(Logging::ReadDataSchema(p_data, p_size, schema))
+    {
+        m_telemetryFile.AddSchema(schema);
+    }
+}
+
+void LoggerProcess::WriteData(void* p_data)
+{
+    const Logging::DataMetaData* metaData = static_cast<Logging::DataMetaData*>(p_data);
+    const void* values = PointerArithmetic::Addition(p_data, sizeof(Logging::DataMetaData));
+    if(!m_telemetryFile.AddRow(metaData->schemaId, metaData->timestamp, values, metaData->valueSize))
+    {
+        ++m_droppedDataCount;
+    }
+}
+
 bool LoggerProcess::IsGameRunning()
 {
     bool returnValue = false;
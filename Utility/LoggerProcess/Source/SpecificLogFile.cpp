@@ -17,7 +17,10 @@
 
 using namespace Doremi::Utilities;
 
-SpecificLogFile::SpecificLogFile() : m_fileStream(nullptr), m_timer(nullptr), m_flushTimerLimit(0), m_elapsedTime(0) {}
+SpecificLogFile::SpecificLogFile()
+    : m_logTag(Logging::LogTag::NOTAG), m_fileStream(nullptr), m_timer(nullptr), m_flushTimerLimit(0), m_elapsedTime(0)
+{
+}
 
 SpecificLogFile::~SpecificLogFile()
 {
@@ -35,6 +38,7 @@ SpecificLogFile::~SpecificLogFile()
 
 void SpecificLogFile::Initialize(const Logging::LogTag& p_logTag)
 {
+    m_logTag = p_logTag;
     m_flushTimerLimit = 1.0;
     m_timer = new Chrono::Timer();
     Logging::LogTagInfo fileNameInfo = Logging::LogTagConverter::convert(p_logTag);
@@ -70,24 +74,27 @@ void SpecificLogFile::Write(void*& p_data)
     // Rebuilddata
     const Logging::TextMetaData* textMetaData = static_cast<Logging::TextMetaData*>(p_data);
 
-    // Fetch pointer to function text
-    void* function = PointerArithmetic::Addition(p_data, sizeof(Logging::TextMetaData));
-
     // Fetch pointer to messagetext
     void* message = PointerArithmetic::Addition(p_data, sizeof(Logging::TextMetaData) + textMetaData->functionLength);
 
-    auto& logtag = LogTagConverter::convert(textMetaData->logTag).name;
-    auto& logLevel = LogLevelConverter::convert(textMetaData->logLevel).name;
+    Write(textMetaData->logLevel, static_cast<char*>(message));
+}
+
+void SpecificLogFile::Write(const Logging::LogLevel& p_logLevel, const char* p_message)
+{
+    using namespace Logging;
+    auto& logtag = LogTagConverter::convert(m_logTag).name;
+    auto& logLevel = LogLevelConverter::convert(p_logLevel).name;
 
     // Actually cout the data to a file
-    *m_fileStream << "[" << logtag << ":" << logLevel << "] " << static_cast<char*>(message) << "\n";
-    if(textMetaData->logLevel == Logging::LogLevel::INFO)
+    *m_fileStream << "[" << logtag << ":" << logLevel << "] " << p_message << "\n";
+    if(p_logLevel == Logging::LogLevel::INFO)
     {
-        if(textMetaData->logLevel == LogLevel::WARNING)
+        if(p_logLevel == LogLevel::WARNING)
         {
             SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), Console::ConsoleColor(Console::ConsoleColorEnum::DARK_YELLOW).value);
         }
-        else if(textMetaData->logLevel == LogLevel::FATAL_ERROR)
+        else if(p_logLevel == LogLevel::FATAL_ERROR)
         {
             SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), Console::ConsoleColor(Console::ConsoleColorEnum::DARK_RED).value);
         }
@@ -95,7 +102,7 @@ void SpecificLogFile::Write(void*& p_data)
         {
             SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), Console::ConsoleColor(Console::ConsoleColorEnum::DARK_WHITE).value);
         }
-        std::cout << "[" << logtag << ":" << logLevel << "] " << static_cast<char*>(message) << "\n";
+        std::cout << "[" << logtag << ":" << logLevel << "] " << p_message << "\n";
     }
 
     // If called often, flush
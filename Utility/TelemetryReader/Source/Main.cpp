@@ -0,0 +1,104 @@
+#include <Utility/Utilities/Include/Logging/TelemetryFile.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+
+using namespace Doremi::Utilities::Logging;
+
+namespace
+{
+    void PrintUsage()
+    {
+        std::cout << "Usage: TelemetryReader <telemetry.drmt> [output folder]" << std::endl
+                  << "Writes the records of every schema in the telemetry file to <schema name>.csv, the first column is the timestamp in"
+                  << " microseconds." << std::endl;
+    }
+
+    // Opens the CSV of a schema and writes its header. Schemas registered twice with the same name get the id in the file name
+    std::unique_ptr<std::ofstream> OpenCsv(const std::string& p_folder, const TelemetrySchema& p_schema, std::set<std::string>& p_usedNames)
+    {
+        std::string name = p_schema.name;
+        if(!p_usedNames.insert(name).second)
+        {
+            name += "_" + std::to_string(p_schema.id);
+            p_usedNames.insert(name);
+        }
+        std::unique_ptr<std::ofstream> file(new std::ofstream(p_folder + name + ".csv", std::ofstream::out | std::ofstream::trunc));
+        if(!file->is_open())
+        {
+            throw std::runtime_error("Failed to create " + p_folder + name + ".csv");
+        }
+        *file << "timestamp";
+        for(const auto& field : p_schema.fields)
+        {
+            *file << "," << field.name;
+        }
+        *file << "\n";
+        return file;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if(argc < 2 || argc > 3)
+    {
+        PrintUsage();
+        return 1;
+    }
+
+    std::string folder = argc == 3 ? argv[2] : "";
+    if(!folder.empty() && folder.back() != '/' && folder.back() != '\\')
+    {
+        folder += "/";
+    }
+
+    try
+    {
+        TelemetryFileReader reader;
+        if(!reader.Open(argv[1]))
+        {
+            std::cout << "Not a telemetry file: " << argv[1] << std::endl;
+            return 1;
+        }
+
+        std::map<uint32_t, std::unique_ptr<std::ofstream>> files;
+        std::set<std::string> usedNames;
+        std::map<uint32_t, uint64_t> rowCounts;
+        TelemetryChunk chunk;
+        while(reader.ReadChunk(chunk))
+        {
+            const TelemetrySchema& schema = *reader.GetSchema(chunk.schemaId);
+            std::unique_ptr<std::ofstream>& file = files[chunk.schemaId];
+            if(file == nullptr)
+            {
+                file = OpenCsv(folder, schema, usedNames);
+            }
+            for(uint32_t row = 0; row < chunk.rowCount; ++row)
+            {
+                *file << chunk.timestamps[row];
+                for(size_t field = 0; field < schema.fields.size(); ++field)
+                {
+                    *file << "," << TelemetryFileReader::FormatValue(schema.fields[field].type, chunk.GetValue(schema, field, row));
+                }
+                *file << "\n";
+            }
+            rowCounts[chunk.schemaId] += chunk.rowCount;
+        }
+
+        for(const auto& rowCount : rowCounts)
+        {
+            std::cout << reader.GetSchema(rowCount.first)->name << ": " << rowCount.second << " records" << std::endl;
+        }
+    }
+    catch(const std::exception& e)
+    {
+        std::cout << "Unhandled exception: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <chrono>
 
@@ -10,8 +11,9 @@ namespace Doremi
         {
             using namespace std::literals;
             const std::string IPC_DEFAULT_FILEMAP_NAME = std::string("doremi_filemap");
-            const size_t IPC_FILEMAP_SIZE = 1024;
-            const std::string IPC_FILEMAP_MUTEX_NAME = std::string("doremi_filemap_mutex");
+            // Nothing locks the filemap anymore, so this is what absorbs bursts while the loggerprocess catches up
+            const size_t IPC_FILEMAP_SIZE = 1024 * 1024;
+            const std::string IPC_FILEMAP_WAKEUP_NAME = std::string("doremi_filemap_wakeup");
             const double IPC_FILEMAP_TIMEOUT = 120;
 
             const size_t LONGEST_FUNCTION_NAME = 256;
@@ -19,8 +21,19 @@ namespace Doremi
             const size_t LONGEST_LINE_NAME = 256;
             const std::string LOGGING_PROCESS_NAME = std::string("LoggerProcess.exe");
             const double LOGFILE_FLUSH_INTERVAL = 3.0;
+            // Buffer per thread that logs, between it and the thread sending to the loggerprocess
+            const size_t LOGGING_STAGING_BUFFER_SIZE = 256 * 1024;
+            // Largest size of the arguments of one LogTextFast call, the rest is cut
+            const size_t LONGEST_BINARY_ARGUMENTS = 256;
+            // Largest size of the values of one telemetry record
+            const size_t LONGEST_DATA_RECORD = 256;
+            // Written by the loggerprocess next to the logfiles, TelemetryReader turns it into CSV
+            const std::string TELEMETRY_FILE_NAME = std::string("telemetry.drmt");
+            // Rows of a telemetry schema kept by the loggerprocess before they are written, they are also written every flush
+            const uint32_t TELEMETRY_CHUNK_ROWS = 1024;
             const std::chrono::milliseconds LOGGING_PRODUCE_TIME_WAIT = 5ms;
-            const std::chrono::milliseconds LOGGING_CONSUME_TIME_WAIT = 10ms;
+            // Consumers are woken when there is something to read, this is only how often they check if they should stop
+            const std::chrono::milliseconds LOGGING_CONSUME_WAKEUP_TIMEOUT = 100ms;
         }
     }
 }
\ No newline at end of file
@@ -9,6 +9,10 @@ namespace Doremi
     {
         namespace IO
         {
+            /**
+            Named shared memory that several processes can map. A pagefile backed file mapping on Windows and a POSIX shared memory
+            object (shm_open) elsewhere. New memory is zeroed.
+            */
             class FileMap
             {
             public:
@@ -37,6 +41,11 @@ namespace Doremi
                 std::string m_name;
                 size_t m_fileMapSize;
                 void* m_rawMemoryOfMappedFile;
+#if !defined(_WIN32)
+                int m_fileDescriptor;
+                // The shared memory object outlives the processes on POSIX, the process that created it removes the name again
+                bool m_createdSharedMemory;
+#endif
             };
         }
     }
@@ -10,6 +10,10 @@ namespace Doremi
     {
         namespace IO
         {
+            /**
+            Named mutex shared between processes. A Windows mutex object, or a named POSIX semaphore (sem_open) used as a binary
+            semaphore elsewhere. POSIX has no abandoned state, a process dying while holding the lock leaves it locked.
+            */
             class FileMapMutex : public Mutex
             {
             public:
@@ -46,7 +50,12 @@ namespace Doremi
                 bool InitializeExternalMutex();
 
                 std::string m_name;
+                // HANDLE on Windows, sem_t* elsewhere
                 void* m_handle;
+#if !defined(_WIN32)
+                // A semaphore can be posted by anyone, remember if this instance holds it so unlocking twice doesn't free two waiters
+                bool m_locked;
+#endif
             };
         }
     }
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <string>
+#include <cstdint>
+
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace IO
+        {
+            /**
+            Maps a file on disk into memory so it can be read in place without copying it.
+            The mapping is copy on write, writes to the memory are private to the process and never reach the file.
+            */
+            class MappedFile
+            {
+            public:
+                MappedFile();
+
+                virtual ~MappedFile();
+
+                /**
+                Maps the whole file into memory. Returns the adress of the mapped memory, nullptr if the file couldn't be mapped
+                */
+                void* Initialize(const std::string& p_fileName);
+
+                /**
+                Unmaps the file, all pointers into the memory are invalid after this
+                */
+                void Close();
+
+                /**
+                Returns the adress of the mapped memory, nullptr if nothing is mapped
+                */
+                void* GetMemory() const { return m_memory; }
+
+                /**
+                Returns the size of the mapped file in bytes
+                */
+                size_t GetSize() const { return m_size; }
+
+            private:
+                MappedFile(const MappedFile&) = delete;
+                void operator=(const MappedFile&) = delete;
+
+                void* m_memory;
+                size_t m_size;
+#if defined(_WIN32)
+                void* m_fileHandle;
+                void* m_mapHandle;
+#else
+                int m_fileDescriptor;
+#endif
+            };
+        }
+    }
+}
@@ -0,0 +1,176 @@
+#pragma once
+#include <Utility/Utilities/Include/Logging/LogTag.hpp>
+#include <Utility/Utilities/Include/Logging/LogLevel.hpp>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace Logging
+        {
+            /**
+            One call site of LogTextFast. Lives as a static in the calling function, so the format string is never copied.
+            */
+            struct LogFormatSite
+            {
+                LogFormatSite(const char* p_function, const uint16_t& p_line, const char* p_format)
+                    : function(p_function), line(p_line), format(p_format), id(0)
+                {
+                }
+                const char* function;
+                uint16_t line;
+                const char* format;
+                // Given by the logger the first time the site logs, zero until then
+                std::atomic<uint32_t> id;
+            };
+
+            /**
+            Sent to the loggerprocess once per call site, before the first record using it. Followed by the function name and
+            the format string, both null terminated.
+            */
+            struct FormatSiteMetaData
+            {
+                FormatSiteMetaData(uint32_t p_siteId, uint16_t p_line, uint16_t p_functionLength, uint16_t p_formatLength)
+                    : siteId(p_siteId), line(p_line), functionLength(p_functionLength), formatLength(p_formatLength)
+                {
+                }
+                uint32_t siteId;
+                uint16_t line;
+                uint16_t functionLength;
+                uint16_t formatLength;
+            };
+
+            /**
+            One LogTextFast call. Followed by argumentSize bytes written by BinaryArgumentWriter.
+            */
+            struct BinaryTextMetaData
+            {
+                BinaryTextMetaData(uint32_t p_siteId, LogTag p_logTag, LogLevel p_logLevel, uint16_t p_argumentSize)
+                    : siteId(p_siteId), logTag(p_logTag), logLevel(p_logLevel), argumentSize(p_argumentSize)
+                {
+                }
+                uint32_t siteId;
+                LogTag logTag;
+                LogLevel logLevel;
+                uint16_t argumentSize;
+            };
+
+            /**
+            Type of an argument in a binary record. Integers are widened to 32 or 64 bits and floats to double like varargs
+            are. Strings are copied with a 16 bit length and no null terminator.
+            */
+            enum class BinaryArgumentType : uint8_t
+            {
+                INT32,
+                UINT32,
+                INT64,
+                UINT64,
+                DOUBLE,
+                STRING,
+                POINTER,
+            };
+
+            /**
+            Writes the arguments of a LogTextFast call as a type byte followed by the raw value. Never allocates. Arguments
+            which don't fit are left out and strings are cut, the formatter prints what is there.
+            */
+            class BinaryArgumentWriter
+            {
+            public:
+                BinaryArgumentWriter(void* p_buffer, const uint16_t& p_bufferSize)
+                    : m_buffer(static_cast<char*>(p_buffer)), m_bufferSize(p_bufferSize), m_size(0)
+                {
+                }
+
+                void Write() {}
+
+                template <typename T, typename... Rest> void Write(const T& p_first, const Rest&... p_rest)
+                {
+                    Put(p_first);
+                    Write(p_rest...);
+                }
+
+                uint16_t GetSize() const { return m_size; }
+
+            private:
+                template <typename T> typename std::enable_if<std::is_integral<T>::value>::type Put(const T& p_value)
+                {
+                    if(std::is_signed<T>::value && sizeof(T) <= sizeof(int32_t))
+                    {
+                        PutValue(BinaryArgumentType::INT32, static_cast<int32_t>(p_value));
+                    }
+                    else if(std::is_signed<T>::value)
+                    {
+                        PutValue(BinaryArgumentType::INT64, static_cast<int64_t>(p_value));
+                    }
+                    else if(sizeof(T) <= sizeof(uint32_t))
+                    {
+                        PutValue(BinaryArgumentType::UINT32, static_cast<uint32_t>(p_value));
+                    }
+                    else
+                    {
+                        PutValue(BinaryArgumentType::UINT64, static_cast<uint64_t>(p_value));
+                    }
+                }
+
+                template <typename T> typename std::enable_if<std::is_enum<T>::value>::type Put(const T& p_value)
+                {
+                    Put(static_cast<typename std::underlying_type<T>::type>(p_value));
+                }
+
+                template <typename T> typename std::enable_if<std::is_floating_point<T>::value>::type Put(const T& p_value)
+                {
+                    PutValue(BinaryArgumentType::DOUBLE, static_cast<double>(p_value));
+                }
+
+                template <typename T> void Put(T* const& p_value) { PutValue(BinaryArgumentType::POINTER, reinterpret_cast<uint64_t>(p_value)); }
+
+                void Put(const char* const& p_value) { PutString(p_value != nullptr ? p_value : "(null)", p_value != nullptr ? strlen(p_value) : 6); }
+
+                void Put(char* const& p_value) { Put(static_cast<const char*>(p_value)); }
+
+                void Put(const std::string& p_value) { PutString(p_value.c_str(), p_value.size()); }
+
+                template <typename T> void PutValue(const BinaryArgumentType& p_type, const T& p_value)
+                {
+                    if(m_size + sizeof(uint8_t) + sizeof(T) > m_bufferSize)
+                    {
+                        m_size = m_bufferSize;
+                        return;
+                    }
+                    m_buffer[m_size] = static_cast<char>(p_type);
+                    memcpy(m_buffer + m_size + sizeof(uint8_t), &p_value, sizeof(T));
+                    m_size += sizeof(uint8_t) + sizeof(T);
+                }
+
+                void PutString(const char* p_value, size_t p_length)
+                {
+                    const size_t headerSize = sizeof(uint8_t) + sizeof(uint16_t);
+                    if(m_size + headerSize > m_bufferSize)
+                    {
+                        m_size = m_bufferSize;
+                        return;
+                    }
+                    if(p_length > m_bufferSize - m_size - headerSize)
+                    {
+                        p_length = m_bufferSize - m_size - headerSize;
+                    }
+                    const uint16_t length = static_cast<uint16_t>(p_length);
+                    m_buffer[m_size] = static_cast<char>(BinaryArgumentType::STRING);
+                    memcpy(m_buffer + m_size + sizeof(uint8_t), &length, sizeof(uint16_t));
+                    memcpy(m_buffer + m_size + headerSize, p_value, length);
+                    m_size += static_cast<uint16_t>(headerSize + length);
+                }
+
+                char* m_buffer;
+                uint16_t m_bufferSize;
+                uint16_t m_size;
+            };
+        }
+    }
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace Logging
+        {
+            /**
+            Formats the arguments written by BinaryArgumentWriter with a printf format string. Flags, width, precision and
+            conversions are used as given, length modifiers in the format are replaced by the size of the stored argument.
+            '*' width and precision aren't supported. Missing arguments are printed as "<?>".
+            */
+            std::string FormatBinaryText(const char* p_format, const void* p_arguments, const size_t& p_argumentSize);
+        }
+    }
+}
@@ -22,12 +22,12 @@ namespace Doremi
 
             /**
             TODORT, can move to cpp
-            TODORT, docs
+            Name of the event the loggerprocess sleeps on while the filemap is empty
             */
-            static std::string BuildFileMapMutexName(const uint32_t& p_uniqueId)
+            static std::string BuildFileMapWakeupName(const uint32_t& p_uniqueId)
             {
                 using namespace std;
-                return string(Constants::IPC_FILEMAP_MUTEX_NAME + to_string(p_uniqueId));
+                return string(Constants::IPC_FILEMAP_WAKEUP_NAME + to_string(p_uniqueId));
             }
 
             /**
@@ -0,0 +1,206 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace Logging
+        {
+            /**
+            Type of a column in a telemetry record
+            */
+            enum class TelemetryFieldType : uint8_t
+            {
+                INT32,
+                UINT32,
+                INT64,
+                UINT64,
+                FLOAT,
+                DOUBLE,
+            };
+
+            /**
+            Size in bytes of one value of the type, zero for an unknown type
+            */
+            inline uint32_t GetTelemetryFieldSize(const TelemetryFieldType& p_type)
+            {
+                switch(p_type)
+                {
+                    case TelemetryFieldType::INT32:
+                    case TelemetryFieldType::UINT32:
+                    case TelemetryFieldType::FLOAT:
+                        return 4;
+                    case TelemetryFieldType::INT64:
+                    case TelemetryFieldType::UINT64:
+                    case TelemetryFieldType::DOUBLE:
+                        return 8;
+                    default:
+                        return 0;
+                }
+            }
+
+            struct TelemetryField
+            {
+                std::string name;
+                TelemetryFieldType type;
+            };
+
+            /**
+            Layout of one kind of telemetry record, e.g. the timings of a tick. Every record also gets a timestamp which
+            isn't part of the fields.
+            */
+            struct TelemetrySchema
+            {
+                uint32_t id = 0;
+                std::string name;
+                std::vector<TelemetryField> fields;
+
+                /**
+                Size of the values of one record, packed in field order without padding
+                */
+                uint32_t GetRowSize() const
+                {
+                    uint32_t size = 0;
+                    for(const auto& field : fields)
+                    {
+                        size += GetTelemetryFieldSize(field.type);
+                    }
+                    return size;
+                }
+            };
+
+            /**
+            Sent to the loggerprocess once per schema, before the first record using it. Followed by the schema name and
+            then by each field as a type byte and a name, all names null terminated. Schema blocks of telemetry files are
+            the same bytes.
+            */
+            struct DataSchemaMetaData
+            {
+                DataSchemaMetaData(uint32_t p_schemaId, uint16_t p_fieldCount) : schemaId(p_schemaId), fieldCount(p_fieldCount) {}
+                uint32_t schemaId;
+                uint16_t fieldCount;
+            };
+
+            /**
+            One LogData call. Followed by valueSize bytes of values packed in field order.
+            */
+            struct DataMetaData
+            {
+                DataMetaData(uint64_t p_timestamp, uint32_t p_schemaId, uint16_t p_valueSize)
+                    : timestamp(p_timestamp), schemaId(p_schemaId), valueSize(p_valueSize)
+                {
+                }
+                // Microseconds of the steady clock of the game when the record was logged
+                uint64_t timestamp;
+                uint32_t schemaId;
+                uint16_t valueSize;
+            };
+
+            /**
+            Appends the schema as the bytes of a DataSchemaMetaData and what follows it
+            */
+            inline void WriteDataSchema(const TelemetrySchema& p_schema, std::vector<char>& o_bytes)
+            {
+                const DataSchemaMetaData metaData(p_schema.id, static_cast<uint16_t>(p_schema.fields.size()));
+                const char* metaDataBytes = reinterpret_cast<const char*>(&metaData);
+                o_bytes.insert(o_bytes.end(), metaDataBytes, metaDataBytes + sizeof(DataSchemaMetaData));
+                o_bytes.insert(o_bytes.end(), p_schema.name.c_str(), p_schema.name.c_str() + p_schema.name.size() + 1);
+                for(const auto& field : p_schema.fields)
+                {
+                    o_bytes.push_back(static_cast<char>(field.type));
+                    o_bytes.insert(o_bytes.end(), field.name.c_str(), field.name.c_str() + field.name.size() + 1);
+                }
+            }
+
+            /**
+            Reads bytes written by WriteDataSchema. Returns false if they are cut short or have an unknown field type
+            */
+            inline bool ReadDataSchema(const void* p_bytes, const size_t& p_size, TelemetrySchema& o_schema)
+            {
+                if(p_size < sizeof(DataSchemaMetaData))
+                {
+                    return false;
+                }
+                const DataSchemaMetaData* metaData = static_cast<const DataSchemaMetaData*>(p_bytes);
+                const char* position = static_cast<const char*>(p_bytes) + sizeof(DataSchemaMetaData);
+                const char* end = static_cast<const char*>(p_bytes) + p_size;
+
+                // Reads a null terminated name, false if the terminator is missing
+                auto readName = [&position, end](std::string& o_name) -> bool
+                {
+                    const char* terminator = static_cast<const char*>(memchr(position, 0, end - position));
+                    if(terminator == nullptr)
+                    {
+                        return false;
+                    }
+                    o_name.assign(position, terminator);
+                    position = terminator + 1;
+                    return true;
+                };
+
+                o_schema.id = metaData->schemaId;
+                o_schema.fields.resize(metaData->fieldCount);
+                if(!readName(o_schema.name))
+                {
+                    return false;
+                }
+                for(auto& field : o_schema.fields)
+                {
+                    if(position == end)
+                    {
+                        return false;
+                    }
+                    field.type = static_cast<TelemetryFieldType>(*position);
+                    ++position;
+                    if(GetTelemetryFieldSize(field.type) == 0 || !readName(field.name))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            /**
+            Packs the values of a LogData call. Values are copied as they are, so their types must match the fields of
+            the schema, e.g. a uint32_t for UINT32 and a float for FLOAT. If the values don't fit the size is set to the
+            whole buffer, which no schema matches, so the record is dropped.
+            */
+            class TelemetryValueWriter
+            {
+            public:
+                TelemetryValueWriter(void* p_buffer, const uint16_t& p_bufferSize)
+                    : m_buffer(static_cast<char*>(p_buffer)), m_bufferSize(p_bufferSize), m_size(0)
+                {
+                }
+
+                void Write() {}
+
+                template <typename T, typename... Rest> void Write(const T& p_first, const Rest&... p_rest)
+                {
+                    static_assert(std::is_arithmetic<T>::value && (sizeof(T) == 4 || sizeof(T) == 8),
+                                  "Telemetry values are 32 or 64 bit integers or floats");
+                    if(m_size + sizeof(T) > m_bufferSize)
+                    {
+                        m_size = m_bufferSize;
+                        return;
+                    }
+                    memcpy(m_buffer + m_size, &p_first, sizeof(T));
+                    m_size += sizeof(T);
+                    Write(p_rest...);
+                }
+
+                uint16_t GetSize() const { return m_size; }
+
+            private:
+                char* m_buffer;
+                uint16_t m_bufferSize;
+                uint16_t m_size;
+            };
+        }
+    }
+}
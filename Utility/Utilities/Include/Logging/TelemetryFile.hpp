@@ -0,0 +1,157 @@
+#pragma once
+#include <Utility/Utilities/Include/Logging/TelemetryData.hpp>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace Logging
+        {
+            /**
+            Telemetry file layout. A header followed by blocks, each a type byte and a 32 bit size before its content.
+            A schema block holds the bytes of WriteDataSchema and comes before the first chunk of the schema. A chunk block
+            holds DataChunkMetaData followed by rowCount timestamps and then, for each field in order, rowCount values.
+            Readers skip blocks of unknown type, and stop at a block cut short by a crash.
+            */
+            const char TELEMETRY_FILE_MAGIC[4] = {'D', 'R', 'M', 'T'};
+            const uint32_t TELEMETRY_FILE_VERSION = 1;
+
+            enum class TelemetryBlockType : uint8_t
+            {
+                SCHEMA,
+                CHUNK,
+            };
+
+            struct DataChunkMetaData
+            {
+                uint32_t schemaId;
+                uint32_t rowCount;
+            };
+
+            /**
+            Rows of one schema read from a chunk, stored by column
+            */
+            struct TelemetryChunk
+            {
+                uint32_t schemaId = 0;
+                uint32_t rowCount = 0;
+                std::vector<uint64_t> timestamps;
+                // Indexed by field, rowCount values each
+                std::vector<std::vector<char>> columns;
+
+                /**
+                Pointer to one value, GetTelemetryFieldSize of the field type bytes long
+                */
+                const void* GetValue(const TelemetrySchema& p_schema, const size_t& p_field, const uint32_t& p_row) const
+                {
+                    return columns[p_field].data() + p_row * GetTelemetryFieldSize(p_schema.fields[p_field].type);
+                }
+            };
+
+            /**
+            Collects telemetry records by column and writes them as chunks, when a schema has enough rows or when flushed
+            */
+            class TelemetryFileWriter
+            {
+            public:
+                /**
+                p_chunkRows is how many rows of a schema are kept before they are written
+                */
+                explicit TelemetryFileWriter(const uint32_t& p_chunkRows = 1024);
+
+                /**
+                Writes what is left and closes the file
+                */
+                virtual ~TelemetryFileWriter();
+
+                /**
+                Creates the file, an existing file is replaced. Returns false if it couldn't be created
+                */
+                bool Open(const std::string& p_fileName);
+
+                /**
+                Adds a schema, rows can be added for it after this. A schema with the same id replaces the old one after
+                the rows of the old one have been written
+                */
+                void AddSchema(const TelemetrySchema& p_schema);
+
+                /**
+                Adds one row. Returns false and drops it if the schema is unknown or the values don't have its row size
+                */
+                bool AddRow(const uint32_t& p_schemaId, const uint64_t& p_timestamp, const void* p_values, const uint32_t& p_valueSize);
+
+                /**
+                Writes the rows of every schema and flushes the file
+                */
+                void Flush();
+
+                /**
+                Flushes and closes the file
+                */
+                void Close();
+
+            private:
+                struct SchemaColumns
+                {
+                    TelemetrySchema schema;
+                    // Offset of each field in a row of values
+                    std::vector<uint32_t> fieldOffsets;
+                    std::vector<uint64_t> timestamps;
+                    std::vector<std::vector<char>> columns;
+                };
+
+                void WriteChunk(SchemaColumns& p_schema);
+                void WriteBlock(const TelemetryBlockType& p_type, const void* p_data, const uint32_t& p_size);
+
+                std::ofstream m_file;
+                std::map<uint32_t, SchemaColumns> m_schemas;
+                // Reused when building blocks
+                std::vector<char> m_block;
+                uint32_t m_chunkRows;
+            };
+
+            /**
+            Reads a telemetry file one chunk at a time
+            */
+            class TelemetryFileReader
+            {
+            public:
+                TelemetryFileReader();
+
+                virtual ~TelemetryFileReader();
+
+                /**
+                Returns false if the file can't be opened or isn't a telemetry file
+                */
+                bool Open(const std::string& p_fileName);
+
+                /**
+                Reads until the next chunk, keeping the schemas on the way. Returns false at the end of the file
+                */
+                bool ReadChunk(TelemetryChunk& o_chunk);
+
+                /**
+                Returns nullptr if no schema with the id has been read
+                */
+                const TelemetrySchema* GetSchema(const uint32_t& p_schemaId) const;
+
+                /**
+                Prints one value as text
+                */
+                static std::string FormatValue(const TelemetryFieldType& p_type, const void* p_value);
+
+            private:
+                bool ReadChunkBlock(const std::vector<char>& p_block, TelemetryChunk& o_chunk) const;
+
+                std::ifstream m_file;
+                std::map<uint32_t, TelemetrySchema> m_schemas;
+                std::vector<char> m_block;
+            };
+        }
+    }
+}
@@ -8,7 +8,10 @@ namespace Doremi
             enum class CircleBufferTypeEnum : int8_t
             {
                 TEXT,
-                DATA,
+                DATA, // One telemetry record
+                FORMAT_SITE, // Call site of binary text, sent once
+                BINARY_TEXT, // Site id and unformatted arguments
+                DATA_SCHEMA, // Layout of telemetry records, sent once
                 UNKNOWN,
             };
 
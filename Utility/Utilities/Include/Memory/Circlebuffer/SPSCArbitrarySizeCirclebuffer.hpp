@@ -0,0 +1,101 @@
+#pragma once
+#include <Utility/Utilities/Include/Memory/Circlebuffer/CircleBufferHeader.hpp>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace Memory
+        {
+            struct SPSCStaticData;
+
+            /**
+            Circlebuffer for one producer and one consumer which never locks. Head and tail are atomic byte counters in the
+            buffer memory, so the buffer can be placed in memory shared between two processes. Records of any size are written
+            as a CircleBufferHeader followed by the data and are split over the end of the buffer when needed.
+            The consumer can sleep in WaitForData until the producer has written something, instead of polling.
+            */
+            class SPSCArbitrarySizeCirclebuffer
+            {
+            public:
+                SPSCArbitrarySizeCirclebuffer();
+
+                virtual ~SPSCArbitrarySizeCirclebuffer();
+
+                /**
+                Allocates the buffer, for a producer and a consumer in the same process.
+                The useable size of the buffer will be p_bufferSize - sizeof(SPSCStaticData).
+                */
+                void Initialize(const uint32_t& p_bufferSize);
+
+                /**
+                Uses memory owned by someone else, e.g. a FileMap. Exactly one side should reset the metadata, before the other
+                side starts using the buffer. p_wakeupName names the event the consumer sleeps on where that needs a name
+                (Windows), the producer and consumer process must use the same name.
+                The useable size of the buffer will be p_bufferSize - sizeof(SPSCStaticData).
+                */
+                void Initialize(void* const p_preAllocatedBuffer, const uint32_t& p_bufferSize, const bool& p_resetMetaData,
+                                const std::string& p_wakeupName = "");
+
+                /**
+                Only called by the producer. Returns false if the record doesn't fit right now.
+                */
+                bool Produce(const CircleBufferHeader& p_header, const void* const p_data);
+
+                /**
+                Only called by the consumer. Returns false if there was nothing to read. A record larger than p_outbufferSize is
+                skipped and counted in GetDroppedCount.
+                */
+                bool Consume(CircleBufferHeader*& o_header, void* o_dataBuffer, const uint32_t& p_outbufferSize);
+
+                /**
+                Only called by the consumer. Sleeps until there is something to consume or p_timeout has passed.
+                Returns true if there is something to consume.
+                */
+                bool WaitForData(const std::chrono::milliseconds& p_timeout);
+
+                /**
+                Only called by the consumer. Returns true if there is something to consume, never sleeps.
+                */
+                bool HasData() const;
+
+                /**
+                Returns the number of records the consumer has skipped since they didn't fit its buffer
+                */
+                uint32_t GetDroppedCount() const { return m_droppedCount; }
+
+            private:
+                SPSCArbitrarySizeCirclebuffer(const SPSCArbitrarySizeCirclebuffer&) = delete;
+                void operator=(const SPSCArbitrarySizeCirclebuffer&) = delete;
+
+                void AssertInitialize(const uint32_t& p_bufferSize);
+                void SetupVariables(const bool& p_resetMetaData, const std::string& p_wakeupName);
+
+                // Copies to and from a position in the buffer, wrapping around the end
+                void CopyIn(const uint64_t& p_position, const void* p_source, const size_t& p_size);
+                void CopyOut(const uint64_t& p_position, void* p_destination, const size_t& p_size) const;
+
+                void WakeConsumer();
+
+                SPSCStaticData* m_data;
+                void* m_rawBufferPointerStart;
+                char* m_dataStart;
+                uint64_t m_capacity;
+                uint32_t m_rawBufferSize;
+                bool m_internalMemoryManagement;
+                bool m_alreadyInitialized;
+
+                // Last seen value of the other side's counter, only reloaded from shared memory when it isn't enough
+                uint64_t m_cachedTail;
+                uint64_t m_cachedHead;
+                uint32_t m_droppedCount;
+#if defined(_WIN32)
+                void* m_wakeupEvent;
+#endif
+            };
+        }
+    }
+}
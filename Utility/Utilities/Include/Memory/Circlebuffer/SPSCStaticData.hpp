@@ -0,0 +1,28 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace Memory
+        {
+            /**
+            Shared state of a SPSCArbitrarySizeCirclebuffer, placed first in the buffer memory. Zeroed memory is an empty buffer.
+            The producer and consumer fields are on separate cache lines so the two sides don't invalidate each other.
+            */
+            struct SPSCStaticData
+            {
+                SPSCStaticData() : head(0), tail(0), wakeupSequence(0), consumerWaiting(0) {}
+                // Bytes produced since the buffer was reset, only changed by the producer
+                alignas(64) std::atomic<uint64_t> head;
+                // Bytes consumed since the buffer was reset, only changed by the consumer
+                alignas(64) std::atomic<uint64_t> tail;
+                // Changed by the producer when it wakes the consumer, the consumer sleeps on it
+                alignas(64) std::atomic<uint32_t> wakeupSequence;
+                // Set by the consumer while it sleeps, the producer only wakes it then
+                std::atomic<uint32_t> consumerWaiting;
+            };
+        }
+    }
+}
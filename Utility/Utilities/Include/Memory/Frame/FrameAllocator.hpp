@@ -0,0 +1,57 @@
+#pragma once
+#include <Utility/Utilities/Include/Memory/Frame/FrameArena.hpp>
+#include <functional>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace Memory
+        {
+            /**
+            Standard allocator on top of a FrameArena, lets the std containers keep their temporaries in it. Deallocating does
+            nothing, the memory comes back when the arena reuses the frame. A container using it must not outlive the next frame.
+            */
+            template <typename T> class FrameAllocator
+            {
+            public:
+                typedef T value_type;
+
+                /**
+                Not explicit so a container can be built straight from the arena
+                */
+                FrameAllocator(FrameArena& p_arena) : m_arena(&p_arena) {}
+
+                template <typename U> FrameAllocator(const FrameAllocator<U>& p_other) : m_arena(p_other.GetArena()) {}
+
+                T* allocate(const size_t p_count) { return static_cast<T*>(m_arena->Allocate(p_count * sizeof(T), alignof(T))); }
+
+                void deallocate(T* /*p_pointer*/, const size_t /*p_count*/) {}
+
+                FrameArena* GetArena() const { return m_arena; }
+
+            private:
+                FrameArena* m_arena;
+            };
+
+            template <typename T, typename U> bool operator==(const FrameAllocator<T>& p_first, const FrameAllocator<U>& p_second)
+            {
+                return p_first.GetArena() == p_second.GetArena();
+            }
+
+            template <typename T, typename U> bool operator!=(const FrameAllocator<T>& p_first, const FrameAllocator<U>& p_second)
+            {
+                return p_first.GetArena() != p_second.GetArena();
+            }
+
+            template <typename T> using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+            template <typename Key, typename T> using FrameMap = std::map<Key, T, std::less<Key>, FrameAllocator<std::pair<const Key, T>>>;
+
+            template <typename Key> using FrameSet = std::set<Key, std::less<Key>, FrameAllocator<Key>>;
+        }
+    }
+}
@@ -0,0 +1,106 @@
+#pragma once
+#include <Utility/Utilities/Include/Memory/MemoryAllocator.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace Memory
+        {
+            /**
+            What a FrameArena handed out during one frame
+            */
+            struct FrameArenaStatistics
+            {
+                FrameArenaStatistics() : allocations(0), allocatedBytes(0), overflowAllocations(0), overflowBytes(0) {}
+                size_t allocations;
+                size_t allocatedBytes;
+                // Allocations which did not fit in the frame and went to the heap
+                size_t overflowAllocations;
+                size_t overflowBytes;
+            };
+
+            /**
+            Linear allocator for temporaries which live at most until the end of the next frame. Allocating moves a pointer
+            forward, nothing is freed on its own. The memory is split in two halves, SwapFrames starts the next frame in the
+            other half, so what was allocated in the frame before stays valid for one more frame.
+            If a frame runs out of memory the allocation goes to the heap instead and is freed along with the frame.
+            Not thread safe, use it from one thread only.
+            */
+            class FrameArena : public MemoryAllocator
+            {
+            public:
+                /**
+                    Constructor
+                */
+                FrameArena();
+
+                /**
+                    Destructor, frees the allocations which went to the heap
+                */
+                virtual ~FrameArena();
+
+                /**
+                    Initializes the arena with the memory of one frame, twice that is allocated. Should not be called twice.
+                */
+                void Initialize(const size_t& p_frameMemorySize);
+
+                /**
+                Returns p_memorySize bytes aligned to p_alignment, which must be a power of two. Valid until the second SwapFrames
+                */
+                void* Allocate(const size_t& p_memorySize, const size_t& p_alignment);
+
+                /**
+                Ends the current frame. The memory of the frame before it is reused by the next one
+                */
+                void SwapFrames();
+
+                /**
+                    Clears both frames, does -NOT- call any destructors.
+                */
+                void Clear() override;
+
+                /**
+                    What was allocated in the frame ended by the last SwapFrames
+                */
+                const FrameArenaStatistics& GetLastFrameStatistics() const { return m_lastStatistics; }
+
+                /**
+                    Most bytes allocated by any frame so far, including those that went to the heap
+                */
+                size_t GetPeakFrameBytes() const { return m_peakFrameBytes; }
+
+                /**
+                    Allocations which went to the heap since the arena was initialized
+                */
+                uint64_t GetTotalOverflowAllocations() const { return m_totalOverflowAllocations; }
+
+                size_t GetFrameMemorySize() const { return m_frameMemorySize; }
+
+            private:
+                void* AllocateOverflow(const size_t& p_memorySize, const size_t& p_alignment);
+                void FreeOverflow(const uint32_t& p_frame);
+                void ResetFrame(const uint32_t& p_frame);
+
+                size_t m_frameMemorySize;
+
+                // Half of the memory used by the current frame, 0 or 1
+                uint32_t m_currentFrame;
+                size_t m_top;
+                size_t m_frameEnd;
+                // Bytes used in each half
+                size_t m_frameOccupied[2];
+
+                // Heap allocations of each frame, freed when the frame is reused
+                std::vector<void*> m_overflow[2];
+
+                FrameArenaStatistics m_currentStatistics;
+                FrameArenaStatistics m_lastStatistics;
+                size_t m_peakFrameBytes;
+                uint64_t m_totalOverflowAllocations;
+            };
+        }
+    }
+}
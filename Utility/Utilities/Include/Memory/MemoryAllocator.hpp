@@ -1,6 +1,7 @@
 #pragma once
 #include <Utility/Utilities/Include/Memory/MemoryAllocator.hpp>
 #include <Utility/Utilities/Include/Memory/MemorySpecification.hpp>
+#include <Utility/Utilities/Include/Memory/PageSpecification.hpp>
 #include <cstdint>
 
 namespace Doremi
@@ -32,9 +33,35 @@ namespace Doremi
                 */
                 Doremi::Utilities::Memory::MemorySpecification GetMemorySpecification();
 
+                /**
+                    Allocates p_size bytes of zeroed pages straight from the system, for big arrays which are walked every frame.
+                    Large pages and the NUMA node of p_options are used if the system allows it, regular pages otherwise.
+                    Large pages need the "Lock pages in memory" right on Windows and reserved huge pages on Linux.
+                    Throws if no memory could be allocated.
+                */
+                static PageAllocation AllocatePages(const size_t& p_size, const PageOptions& p_options);
+
+                static void FreePages(const PageAllocation& p_allocation);
+
+                /**
+                    Size of a large page, 0 if the process can't use them
+                */
+                static size_t GetLargePageSize();
+
+                /**
+                    Options the big arrays of the game are allocated with, set at startup before they are created.
+                    Every module has its own.
+                */
+                static void SetDefaultPageOptions(const PageOptions& p_options);
+                static const PageOptions& GetDefaultPageOptions();
 
             protected:
                 void Initialize(const size_t& p_memorySize, const uint8_t& p_alignment);
+
+                /**
+                    Takes the chunk from AllocatePages instead of the heap
+                */
+                void Initialize(const size_t& p_memorySize, const uint8_t& p_alignment, const PageOptions& p_pageOptions);
                 void AllocateFirstTime();
 
                 /**
@@ -82,6 +109,13 @@ namespace Doremi
                 The global adjustment for this specific allocator, only used to allocate the entire chunk.
                 */
                 uint8_t m_adjustment;
+
+                /**
+                Whether the chunk comes from AllocatePages, and how.
+                */
+                bool m_usePages;
+                PageOptions m_pageOptions;
+                PageAllocation m_pages;
             };
         }
     }
@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace Memory
+        {
+            /**
+            How memory straight from the system should be placed, see MemoryAllocator::AllocatePages
+            */
+            struct PageOptions
+            {
+                // Large pages, 2 MB on x64, for blocks of at least half a large page
+                bool largePages;
+                // NUMA node the pages are placed on, -1 leaves it to the system
+                int32_t numaNode;
+                PageOptions() : largePages(false), numaNode(-1) {}
+                PageOptions(const bool& p_largePages, const int32_t& p_numaNode) : largePages(p_largePages), numaNode(p_numaNode) {}
+            };
+
+            /**
+            Memory from MemoryAllocator::AllocatePages, given back with MemoryAllocator::FreePages
+            */
+            struct PageAllocation
+            {
+                void* memory;
+                // The size asked for rounded up to whole pages
+                size_t size;
+                // False if large pages were not asked for or the system had none to give
+                bool largePages;
+                PageAllocation() : memory(nullptr), size(0), largePages(false) {}
+            };
+        }
+    }
+}
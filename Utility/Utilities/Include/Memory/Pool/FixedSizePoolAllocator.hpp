@@ -1,6 +1,7 @@
 #pragma once
 #include <Utility/Utilities/Include/Memory/MemoryAllocator.hpp>
 #include <exception>
+#include <new>
 #include <cstdint>
 
 namespace Doremi
@@ -47,9 +48,8 @@ namespace Doremi
                         ++m_currentObjectCount;
                         m_occupiedMemory += sizeof(T);
 
-                        // Run default constructor for the object
-                        *returnPointer = T();
-                        return returnPointer;
+                        // Run default constructor for the object, in place since the block holds no object yet
+                        return new(returnPointer) T();
                     }
                     else
                     {
@@ -0,0 +1,170 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace Memory
+        {
+            /**
+            Thread safe pool of equally sized blocks which grows a slab at a time instead of running out.
+            Every thread keeps two magazines of free blocks, so allocating and freeing is usually a push or pop on memory only
+            that thread touches. Full and empty magazines are traded with a lock free depot shared by all threads, the lock is
+            only taken when the pool grows.
+            A block can be freed on another thread than it was allocated on. Nothing is returned to the system until the pool
+            is destroyed, and the magazines of a thread which has exited stay with it.
+            */
+            class SlabPoolAllocator
+            {
+            public:
+                /**
+                    Constructor
+                */
+                SlabPoolAllocator();
+
+                /**
+                    Destructor, frees every slab. Blocks still in use are freed too, without their destructors
+                */
+                virtual ~SlabPoolAllocator();
+
+                SlabPoolAllocator(const SlabPoolAllocator&) = delete;
+                void operator=(const SlabPoolAllocator&) = delete;
+
+                /**
+                Blocks of p_blockSize aligned to p_alignment, which must be a power of two. Each slab holds at least p_blocksPerSlab
+                blocks, rounded up to whole magazines. Should not be called twice.
+                */
+                void Initialize(const size_t& p_blockSize, const size_t& p_alignment, const size_t& p_blocksPerSlab);
+
+                /**
+                Returns a free block, allocates a new slab if there is none.
+                Throws if the pool can't grow any more.
+                */
+                void* Allocate();
+
+                /**
+                Gives a block back to the pool. Must come from this pool
+                */
+                void Free(void* p_block);
+
+                size_t GetBlockSize() const { return m_blockSize; }
+
+                /**
+                    Slabs allocated so far
+                */
+                size_t GetSlabCount() const { return m_slabCount.load(std::memory_order_relaxed); }
+
+                /**
+                    Blocks in all slabs, free or not
+                */
+                size_t GetCapacity() const { return GetSlabCount() * m_blocksPerSlab; }
+
+                // Blocks a magazine holds
+                static const uint32_t MAGAZINE_SIZE = 32;
+                // The magazines are allocated in chunks, which limits the pool to MAX_MAGAZINE_CHUNKS * MAGAZINES_PER_CHUNK magazines
+                static const uint32_t MAGAZINES_PER_CHUNK = 64;
+                static const uint32_t MAX_MAGAZINE_CHUNKS = 1024;
+
+            private:
+                struct Magazine
+                {
+                    uint32_t count;
+                    // Index + 1 of the magazine below it in a depot stack, 0 ends the stack
+                    std::atomic<uint32_t> next;
+                    void* blocks[MAGAZINE_SIZE];
+                };
+
+                /**
+                Magazines of one thread, loaded is the one used first. Only touched by that thread
+                */
+                struct ThreadCache
+                {
+                    uint32_t loaded;
+                    uint32_t previous;
+                };
+
+                ThreadCache& GetThreadCache();
+                Magazine& GetMagazine(const uint32_t& p_index) const;
+
+                // Depot stacks, the head is the index + 1 of the top magazine in the low bits and a tag against ABA in the high bits
+                void Push(std::atomic<uint64_t>& p_stack, const uint32_t& p_magazine);
+                // Returns the index + 1 of the magazine, 0 if the stack is empty
+                uint32_t Pop(std::atomic<uint64_t>& p_stack);
+
+                // Called with m_growLock held, returns the index of a new empty magazine
+                uint32_t CreateMagazine();
+                // Adds a slab of full magazines to the depot, unless another thread already did
+                void Grow();
+
+                // Swaps the empty loaded magazine of p_cache for a full one from the depot
+                void RefillLoaded(ThreadCache& p_cache);
+                // Swaps the full loaded magazine of p_cache for an empty one from the depot
+                void EmptyLoaded(ThreadCache& p_cache);
+
+                size_t m_blockSize;
+                size_t m_alignment;
+                size_t m_blocksPerSlab;
+
+                std::atomic<uint64_t> m_fullMagazines;
+                std::atomic<uint64_t> m_emptyMagazines;
+
+                std::atomic<Magazine*> m_magazineChunks[MAX_MAGAZINE_CHUNKS];
+                uint32_t m_magazineCount;
+
+                std::mutex m_growLock;
+                std::vector<void*> m_slabs;
+                std::atomic<size_t> m_slabCount;
+                std::vector<ThreadCache*> m_threadCaches;
+
+                // Tells the thread caches of a destroyed pool from those of one created at the same address
+                const uint64_t m_instance;
+            };
+
+            /**
+            SlabPoolAllocator for objects of T, constructed in place
+            */
+            template <typename T> class ObjectPool
+            {
+            public:
+                /**
+                Each slab holds at least p_objectsPerSlab objects
+                */
+                explicit ObjectPool(const size_t& p_objectsPerSlab) { m_pool.Initialize(sizeof(T), alignof(T), p_objectsPerSlab); }
+
+                template <typename... Args> T* Create(Args&&... p_arguments)
+                {
+                    void* block = m_pool.Allocate();
+                    try
+                    {
+                        return new(block) T(std::forward<Args>(p_arguments)...);
+                    }
+                    catch(...)
+                    {
+                        m_pool.Free(block);
+                        throw;
+                    }
+                }
+
+                void Destroy(T* p_object)
+                {
+                    if(p_object != nullptr)
+                    {
+                        p_object->~T();
+                        m_pool.Free(p_object);
+                    }
+                }
+
+                const SlabPoolAllocator& GetPool() const { return m_pool; }
+
+            private:
+                SlabPoolAllocator m_pool;
+            };
+        }
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <Utility/Utilities/Include/Memory/Pool/SlabPoolAllocator.hpp>
+#include <cstdint>
+
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace Memory
+        {
+            /**
+            Thread safe allocator for small objects of different sizes, e.g. behind the operator new of a class hierarchy.
+            Each size is rounded up to a power of two and given a block from the SlabPoolAllocator of that size. Anything larger
+            than LARGEST_SIZE goes to the heap. Deallocate must be given the same size as Allocate.
+            */
+            class SlabPoolResource
+            {
+            public:
+                /**
+                Each slab of each size holds at least p_blocksPerSlab blocks
+                */
+                explicit SlabPoolResource(const size_t& p_blocksPerSlab);
+
+                void* Allocate(const size_t& p_memorySize);
+
+                void Deallocate(void* p_memory, const size_t& p_memorySize);
+
+                /**
+                    Pool of the size a block of p_memorySize comes from, nullptr if it goes to the heap
+                */
+                const SlabPoolAllocator* GetPool(const size_t& p_memorySize) const;
+
+                // Blocks are aligned to the smallest size
+                static const size_t SMALLEST_SIZE = 16;
+                static const size_t NUMBER_OF_SIZES = 5;
+                static const size_t LARGEST_SIZE = SMALLEST_SIZE << (NUMBER_OF_SIZES - 1);
+
+            private:
+                static size_t GetSizeIndex(const size_t& p_memorySize);
+
+                SlabPoolAllocator m_pools[NUMBER_OF_SIZES];
+            };
+        }
+    }
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace Threading
+        {
+            /**
+            Thread pool where every worker has its own queue of jobs. Jobs submitted from a worker are put in the workers own queue,
+            jobs submitted from other threads are spread over the queues. A worker without jobs steals from the other queues.
+            The functions are virtual so calls from other .dll run the code of the .dll which created the pool.
+            */
+            class WorkStealingThreadPool
+            {
+            public:
+                /**
+                Starts the given number of worker threads, 0 uses one thread less than the number of hardware threads
+                */
+                explicit WorkStealingThreadPool(const uint32_t& p_threadCount);
+
+                /**
+                Finishes all submitted jobs and stops the workers
+                */
+                virtual ~WorkStealingThreadPool();
+
+                /**
+                Submits a job to be run by one of the workers
+                */
+                virtual void Submit(std::function<void()> p_job);
+
+                /**
+                Blocks until every submitted job has finished. Must not be called from a worker
+                */
+                virtual void WaitUntilIdle();
+
+                /**
+                Returns the number of worker threads
+                */
+                virtual uint32_t GetThreadCount() const { return static_cast<uint32_t>(m_threads.size()); }
+
+                /**
+                Returns the index of the calling worker, or GetThreadCount() if not called from a worker of this pool
+                */
+                virtual uint32_t GetCurrentWorkerIndex() const;
+
+            private:
+                WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+                void operator=(const WorkStealingThreadPool&) = delete;
+
+                struct WorkerQueue
+                {
+                    std::mutex mutex;
+                    std::deque<std::function<void()>> jobs;
+                };
+
+                void WorkerLoop(const uint32_t& p_workerIndex);
+
+                /**
+                Pops the newest job from the workers own queue, or steals the oldest job from another queue
+                */
+                bool PopOrSteal(const uint32_t& p_workerIndex, std::function<void()>& o_job);
+
+                std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+                std::vector<std::thread> m_threads;
+
+                // Jobs in the queues, and jobs which are queued or running
+                std::atomic<uint32_t> m_queuedJobs;
+                std::atomic<uint32_t> m_pendingJobs;
+                std::atomic<uint32_t> m_nextQueue;
+
+                std::mutex m_sleepMutex;
+                std::condition_variable m_sleepCondition;
+                std::condition_variable m_idleCondition;
+                bool m_running;
+            };
+        }
+    }
+}
@@ -1,7 +1,15 @@
 #include <IO/FileMap/FileMap.hpp>
-#include <Utility/Utilities/Include/String/StringHelper.hpp>
 
+#if defined(_WIN32)
+#include <Utility/Utilities/Include/String/StringHelper.hpp>
 #include <Windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 namespace Doremi
 {
@@ -9,6 +17,7 @@ namespace Doremi
     {
         namespace IO
         {
+#if defined(_WIN32)
             FileMap::FileMap() : m_mapHandle(nullptr), m_fileMapSize(0), m_rawMemoryOfMappedFile(nullptr) {}
 
             FileMap::~FileMap()
@@ -18,6 +27,28 @@ namespace Doremi
                     CloseHandle(m_mapHandle);
                 }
             }
+#else
+            FileMap::FileMap()
+                : m_mapHandle(nullptr), m_fileMapSize(0), m_rawMemoryOfMappedFile(nullptr), m_fileDescriptor(-1), m_createdSharedMemory(false)
+            {
+            }
+
+            FileMap::~FileMap()
+            {
+                if(m_rawMemoryOfMappedFile != nullptr)
+                {
+                    munmap(m_rawMemoryOfMappedFile, m_fileMapSize);
+                }
+                if(m_fileDescriptor != -1)
+                {
+                    close(m_fileDescriptor);
+                }
+                if(m_createdSharedMemory)
+                {
+                    shm_unlink(m_name.c_str());
+                }
+            }
+#endif
 
             void* FileMap::Initialize(const std::string& p_name, const size_t& p_fileMapSize)
             {
@@ -42,6 +73,7 @@ namespace Doremi
                 return m_rawMemoryOfMappedFile;
             }
 
+#if defined(_WIN32)
             bool FileMap::OpenFileMap()
             {
                 m_mapHandle = CreateFileMapping(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, (DWORD)0, m_fileMapSize, String::s2ws(m_name).c_str());
@@ -61,6 +93,51 @@ namespace Doremi
                 }
                 return false;
             }
+#else
+            bool FileMap::OpenFileMap()
+            {
+                // POSIX names start with a slash and contain no other slashes
+                m_name = "/" + m_name;
+
+                // Try to create it first to know if this process owns the name, otherwise open the existing one
+                m_fileDescriptor = shm_open(m_name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+                if(m_fileDescriptor != -1)
+                {
+                    m_createdSharedMemory = true;
+                }
+                else if(errno == EEXIST)
+                {
+                    m_fileDescriptor = shm_open(m_name.c_str(), O_RDWR, 0600);
+                }
+                if(m_fileDescriptor == -1)
+                {
+                    return false;
+                }
+
+                // Like CreateFileMapping the object only grows, the added memory is zeroed
+                struct stat fileStatus;
+                if(fstat(m_fileDescriptor, &fileStatus) != 0)
+                {
+                    return false;
+                }
+                if(static_cast<size_t>(fileStatus.st_size) < m_fileMapSize && ftruncate(m_fileDescriptor, m_fileMapSize) != 0)
+                {
+                    return false;
+                }
+                return true;
+            }
+
+            bool FileMap::MapFileMapIntoMemory()
+            {
+                void* memory = mmap(nullptr, m_fileMapSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_fileDescriptor, 0);
+                if(memory != MAP_FAILED)
+                {
+                    m_rawMemoryOfMappedFile = memory;
+                    return true;
+                }
+                return false;
+            }
+#endif
         }
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,128 @@
+#include <IO/MappedFile/MappedFile.hpp>
+
+#if defined(_WIN32)
+#include <Utility/Utilities/Include/String/StringHelper.hpp>
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace IO
+        {
+#if defined(_WIN32)
+            MappedFile::MappedFile() : m_memory(nullptr), m_size(0), m_fileHandle(nullptr), m_mapHandle(nullptr) {}
+#else
+            MappedFile::MappedFile() : m_memory(nullptr), m_size(0), m_fileDescriptor(-1) {}
+#endif
+
+            MappedFile::~MappedFile() { Close(); }
+
+#if defined(_WIN32)
+            void* MappedFile::Initialize(const std::string& p_fileName)
+            {
+                Close();
+                m_fileHandle = CreateFile(String::s2ws(p_fileName).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                          FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+                if(m_fileHandle == INVALID_HANDLE_VALUE)
+                {
+                    m_fileHandle = nullptr;
+                    return nullptr;
+                }
+                LARGE_INTEGER fileSize;
+                if(!GetFileSizeEx(m_fileHandle, &fileSize) || fileSize.QuadPart == 0)
+                {
+                    Close();
+                    return nullptr;
+                }
+                m_size = static_cast<size_t>(fileSize.QuadPart);
+
+                // PAGE_WRITECOPY together with FILE_MAP_COPY gives private copy on write pages
+                m_mapHandle = CreateFileMapping(m_fileHandle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+                if(m_mapHandle == NULL)
+                {
+                    m_mapHandle = nullptr;
+                    Close();
+                    return nullptr;
+                }
+                m_memory = MapViewOfFile(m_mapHandle, FILE_MAP_COPY, 0, 0, 0);
+                if(m_memory == NULL)
+                {
+                    m_memory = nullptr;
+                    Close();
+                    return nullptr;
+                }
+                return m_memory;
+            }
+
+            void MappedFile::Close()
+            {
+                if(m_memory != nullptr)
+                {
+                    UnmapViewOfFile(m_memory);
+                    m_memory = nullptr;
+                }
+                if(m_mapHandle != nullptr)
+                {
+                    CloseHandle(m_mapHandle);
+                    m_mapHandle = nullptr;
+                }
+                if(m_fileHandle != nullptr)
+                {
+                    CloseHandle(m_fileHandle);
+                    m_fileHandle = nullptr;
+                }
+                m_size = 0;
+            }
+#else
+            void* MappedFile::Initialize(const std::string& p_fileName)
+            {
+                Close();
+                m_fileDescriptor = open(p_fileName.c_str(), O_RDONLY);
+                if(m_fileDescriptor == -1)
+                {
+                    return nullptr;
+                }
+                struct stat fileStatus;
+                if(fstat(m_fileDescriptor, &fileStatus) != 0 || fileStatus.st_size == 0)
+                {
+                    Close();
+                    return nullptr;
+                }
+                m_size = static_cast<size_t>(fileStatus.st_size);
+
+                // MAP_PRIVATE gives private copy on write pages
+                void* memory = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, m_fileDescriptor, 0);
+                if(memory == MAP_FAILED)
+                {
+                    Close();
+                    return nullptr;
+                }
+                m_memory = memory;
+                return m_memory;
+            }
+
+            void MappedFile::Close()
+            {
+                if(m_memory != nullptr)
+                {
+                    munmap(m_memory, m_size);
+                    m_memory = nullptr;
+                }
+                if(m_fileDescriptor != -1)
+                {
+                    close(m_fileDescriptor);
+                    m_fileDescriptor = -1;
+                }
+                m_size = 0;
+            }
+#endif
+        }
+    }
+}
@@ -1,7 +1,17 @@
 #include <IO/FileMap/FileMapMutex.hpp>
 
+#include <stdexcept>
+#include <string>
+
+#if defined(_WIN32)
 #include <Windows.h>
 #include <Utility/Utilities/Include/String/StringHelper.hpp>
+#else
+#include <cerrno>
+#include <ctime>
+#include <fcntl.h>
+#include <semaphore.h>
+#endif
 
 namespace Doremi
 {
@@ -12,6 +22,7 @@ namespace Doremi
             // TODORT Define better than 1000?
             const uint32_t DEFAULT_TIMEOUT = 1000;
 
+#if defined(_WIN32)
             FileMapMutex::FileMapMutex() : m_handle(nullptr) {}
 
             FileMapMutex::~FileMapMutex()
@@ -19,6 +30,18 @@ namespace Doremi
                 ReleaseMutex(m_handle);
                 CloseHandle(m_handle);
             }
+#else
+            FileMapMutex::FileMapMutex() : m_handle(nullptr), m_locked(false) {}
+
+            FileMapMutex::~FileMapMutex()
+            {
+                if(m_handle != nullptr)
+                {
+                    unlock();
+                    sem_close(static_cast<sem_t*>(m_handle));
+                }
+            }
+#endif
 
             bool FileMapMutex::Initialize(const std::string& p_name)
             {
@@ -40,6 +63,7 @@ namespace Doremi
 
             bool FileMapMutex::try_lock() { return try_lock(DEFAULT_TIMEOUT); }
 
+#if defined(_WIN32)
             bool FileMapMutex::try_lock(const uint32_t& p_timeout)
             {
                 DWORD check;
@@ -99,6 +123,64 @@ namespace Doremi
                 }
                 return false;
             }
+#else
+            bool FileMapMutex::try_lock(const uint32_t& p_timeout)
+            {
+                // sem_timedwait takes an absolute time on the realtime clock
+                timespec deadline;
+                clock_gettime(CLOCK_REALTIME, &deadline);
+                deadline.tv_sec += p_timeout / 1000;
+                deadline.tv_nsec += static_cast<long>(p_timeout % 1000) * 1000000;
+                if(deadline.tv_nsec >= 1000000000)
+                {
+                    deadline.tv_sec += 1;
+                    deadline.tv_nsec -= 1000000000;
+                }
+
+                while(sem_timedwait(static_cast<sem_t*>(m_handle), &deadline) != 0)
+                {
+                    if(errno != EINTR)
+                    {
+                        return false; // Timeouted or did not get mutex
+                    }
+                }
+                m_locked = true;
+                return true;
+            }
+
+            void FileMapMutex::lock()
+            {
+                while(sem_wait(static_cast<sem_t*>(m_handle)) != 0)
+                {
+                    if(errno != EINTR)
+                    {
+                        throw std::runtime_error("Failed to lock filemapmutex. Errorcode: " + std::to_string(errno));
+                    }
+                }
+                m_locked = true;
+            }
+
+            void FileMapMutex::unlock()
+            {
+                if(m_locked)
+                {
+                    m_locked = false;
+                    sem_post(static_cast<sem_t*>(m_handle));
+                }
+            }
+
+            bool FileMapMutex::InitializeExternalMutex()
+            {
+                // POSIX names start with a slash, the initial count of one makes it an unlocked mutex
+                sem_t* semaphore = sem_open(("/" + m_name).c_str(), O_CREAT, 0600, 1);
+                if(semaphore != SEM_FAILED)
+                {
+                    m_handle = semaphore;
+                    return true;
+                }
+                return false;
+            }
+#endif
         }
     }
-}
\ No newline at end of file
+}
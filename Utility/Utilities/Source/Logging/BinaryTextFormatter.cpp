@@ -0,0 +1,219 @@
+#include <Logging/BinaryTextFormatter.hpp>
+#include <Logging/BinaryLogData.hpp>
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace Logging
+        {
+            namespace
+            {
+                const char* const MISSING_ARGUMENT = "<?>";
+
+                /**
+                Reads the next argument, returns false if there are no more
+                */
+                class BinaryArgumentReader
+                {
+                public:
+                    BinaryArgumentReader(const void* p_arguments, const size_t& p_size)
+                        : m_cursor(static_cast<const char*>(p_arguments)), m_end(static_cast<const char*>(p_arguments) + p_size)
+                    {
+                    }
+
+                    bool Next(BinaryArgumentType& o_type, const char*& o_value, size_t& o_size)
+                    {
+                        if(m_cursor >= m_end)
+                        {
+                            return false;
+                        }
+                        o_type = static_cast<BinaryArgumentType>(*m_cursor);
+                        const char* value = m_cursor + sizeof(uint8_t);
+                        switch(o_type)
+                        {
+                            case BinaryArgumentType::INT32:
+                            case BinaryArgumentType::UINT32:
+                                o_size = sizeof(uint32_t);
+                                break;
+                            case BinaryArgumentType::INT64:
+                            case BinaryArgumentType::UINT64:
+                            case BinaryArgumentType::DOUBLE:
+                            case BinaryArgumentType::POINTER:
+                                o_size = sizeof(uint64_t);
+                                break;
+                            case BinaryArgumentType::STRING:
+                            {
+                                if(value + sizeof(uint16_t) > m_end)
+                                {
+                                    return false;
+                                }
+                                uint16_t length;
+                                memcpy(&length, value, sizeof(uint16_t));
+                                value += sizeof(uint16_t);
+                                o_size = length;
+                                break;
+                            }
+                            default:
+                                return false;
+                        }
+                        if(value + o_size > m_end)
+                        {
+                            return false;
+                        }
+                        o_value = value;
+                        m_cursor = value + o_size;
+                        return true;
+                    }
+
+                private:
+                    const char* m_cursor;
+                    const char* m_end;
+                };
+
+                template <typename T> T Read(const char* p_value)
+                {
+                    T value;
+                    memcpy(&value, p_value, sizeof(T));
+                    return value;
+                }
+
+                bool IsIntegerConversion(const char& p_conversion) { return strchr("diouxXc", p_conversion) != nullptr; }
+
+                bool IsFloatConversion(const char& p_conversion) { return strchr("fFeEgGaA", p_conversion) != nullptr; }
+
+                /**
+                Formats one argument with p_spec, which is the conversion without length modifier and conversion character
+                */
+                void AppendArgument(std::string& o_text, const std::string& p_spec, const char& p_conversion, const BinaryArgumentType& p_type,
+                                    const char* p_value, const size_t& p_size)
+                {
+                    char formatted[512];
+                    std::string spec = p_spec;
+                    int length = 0;
+                    switch(p_type)
+                    {
+                        case BinaryArgumentType::INT32:
+                        case BinaryArgumentType::UINT32:
+                        {
+                            const bool isSigned = p_type == BinaryArgumentType::INT32;
+                            // The stored sign decides if the conversion doesn't fit the argument
+                            spec += IsIntegerConversion(p_conversion) ? p_conversion : (isSigned ? 'd' : 'u');
+                            length = isSigned ? snprintf(formatted, sizeof(formatted), spec.c_str(), Read<int32_t>(p_value))
+                                              : snprintf(formatted, sizeof(formatted), spec.c_str(), Read<uint32_t>(p_value));
+                            break;
+                        }
+                        case BinaryArgumentType::INT64:
+                        case BinaryArgumentType::UINT64:
+                        {
+                            const bool isSigned = p_type == BinaryArgumentType::INT64;
+                            spec += "ll";
+                            spec += IsIntegerConversion(p_conversion) && p_conversion != 'c' ? p_conversion : (isSigned ? 'd' : 'u');
+                            length = isSigned ? snprintf(formatted, sizeof(formatted), spec.c_str(), static_cast<long long>(Read<int64_t>(p_value)))
+                                              : snprintf(formatted, sizeof(formatted), spec.c_str(),
+                                                         static_cast<unsigned long long>(Read<uint64_t>(p_value)));
+                            break;
+                        }
+                        case BinaryArgumentType::DOUBLE:
+                            spec += IsFloatConversion(p_conversion) ? p_conversion : 'f';
+                            length = snprintf(formatted, sizeof(formatted), spec.c_str(), Read<double>(p_value));
+                            break;
+                        case BinaryArgumentType::POINTER:
+                            spec += 'p';
+                            length = snprintf(formatted, sizeof(formatted), spec.c_str(), reinterpret_cast<void*>(static_cast<uintptr_t>(Read<uint64_t>(p_value))));
+                            break;
+                        case BinaryArgumentType::STRING:
+                        {
+                            // The string isn't null terminated, precision limits how much is read
+                            const int stringLength = static_cast<int>(p_size);
+                            const size_t precision = spec.find('.');
+                            if(precision == std::string::npos)
+                            {
+                                spec += ".*s";
+                                length = snprintf(formatted, sizeof(formatted), spec.c_str(), stringLength, p_value);
+                            }
+                            else
+                            {
+                                const int givenPrecision = atoi(spec.c_str() + precision + 1);
+                                spec = spec.substr(0, precision) + ".*s";
+                                length = snprintf(formatted, sizeof(formatted), spec.c_str(), givenPrecision < stringLength ? givenPrecision : stringLength,
+                                                  p_value);
+                            }
+                            if(length >= static_cast<int>(sizeof(formatted)) && spec == "%.*s")
+                            {
+                                // Plain long strings are appended directly instead of cut at the local buffer
+                                o_text.append(p_value, p_size);
+                                return;
+                            }
+                            break;
+                        }
+                    }
+                    if(length > 0)
+                    {
+                        o_text.append(formatted, length < static_cast<int>(sizeof(formatted)) ? length : sizeof(formatted) - 1);
+                    }
+                }
+            }
+
+            std::string FormatBinaryText(const char* p_format, const void* p_arguments, const size_t& p_argumentSize)
+            {
+                std::string text;
+                text.reserve(strlen(p_format) + p_argumentSize);
+                BinaryArgumentReader reader(p_arguments, p_argumentSize);
+
+                const char* cursor = p_format;
+                while(*cursor != '\0')
+                {
+                    if(*cursor != '%')
+                    {
+                        const char* nextSpec = strchr(cursor, '%');
+                        const size_t literalLength = nextSpec != nullptr ? nextSpec - cursor : strlen(cursor);
+                        text.append(cursor, literalLength);
+                        cursor += literalLength;
+                        continue;
+                    }
+                    if(cursor[1] == '%')
+                    {
+                        text += '%';
+                        cursor += 2;
+                        continue;
+                    }
+
+                    // Flags, width and precision are kept, length modifiers are dropped
+                    std::string spec = "%";
+                    ++cursor;
+                    while(*cursor != '\0' && strchr("-+ #0123456789.", *cursor) != nullptr)
+                    {
+                        spec += *cursor++;
+                    }
+                    while(*cursor != '\0' && strchr("hljztLIq", *cursor) != nullptr)
+                    {
+                        // I64 and I32 from MSVC
+                        cursor += *cursor == 'I' && (strncmp(cursor, "I64", 3) == 0 || strncmp(cursor, "I32", 3) == 0) ? 3 : 1;
+                    }
+                    if(*cursor == '\0')
+                    {
+                        break;
+                    }
+                    const char conversion = *cursor++;
+
+                    BinaryArgumentType type;
+                    const char* value;
+                    size_t size;
+                    if(conversion == 'n' || !reader.Next(type, value, size))
+                    {
+                        text += MISSING_ARGUMENT;
+                        continue;
+                    }
+                    AppendArgument(text, spec, conversion, type, value, size);
+                }
+                return text;
+            }
+        }
+    }
+}
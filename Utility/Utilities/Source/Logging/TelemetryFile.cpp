@@ -0,0 +1,280 @@
+#include <Utility/Utilities/Include/Logging/TelemetryFile.hpp>
+
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace Logging
+        {
+            TelemetryFileWriter::TelemetryFileWriter(const uint32_t& p_chunkRows) : m_chunkRows(p_chunkRows > 0 ? p_chunkRows : 1) {}
+
+            TelemetryFileWriter::~TelemetryFileWriter() { Close(); }
+
+            bool TelemetryFileWriter::Open(const std::string& p_fileName)
+            {
+                m_file.open(p_fileName, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+                if(!m_file.is_open())
+                {
+                    return false;
+                }
+                m_file.write(TELEMETRY_FILE_MAGIC, sizeof(TELEMETRY_FILE_MAGIC));
+                m_file.write(reinterpret_cast<const char*>(&TELEMETRY_FILE_VERSION), sizeof(TELEMETRY_FILE_VERSION));
+                return true;
+            }
+
+            void TelemetryFileWriter::AddSchema(const TelemetrySchema& p_schema)
+            {
+                auto existing = m_schemas.find(p_schema.id);
+                if(existing != m_schemas.end())
+                {
+                    WriteChunk(existing->second);
+                }
+
+                SchemaColumns& columns = m_schemas[p_schema.id];
+                columns.schema = p_schema;
+                columns.fieldOffsets.clear();
+                columns.timestamps.clear();
+                columns.columns.assign(p_schema.fields.size(), std::vector<char>());
+                uint32_t offset = 0;
+                for(const auto& field : p_schema.fields)
+                {
+                    columns.fieldOffsets.push_back(offset);
+                    offset += GetTelemetryFieldSize(field.type);
+                }
+
+                m_block.clear();
+                WriteDataSchema(p_schema, m_block);
+                WriteBlock(TelemetryBlockType::SCHEMA, m_block.data(), static_cast<uint32_t>(m_block.size()));
+            }
+
+            bool TelemetryFileWriter::AddRow(const uint32_t& p_schemaId, const uint64_t& p_timestamp, const void* p_values,
+                                             const uint32_t& p_valueSize)
+            {
+                auto found = m_schemas.find(p_schemaId);
+                if(found == m_schemas.end() || found->second.schema.GetRowSize() != p_valueSize)
+                {
+                    return false;
+                }
+
+                SchemaColumns& columns = found->second;
+                const char* values = static_cast<const char*>(p_values);
+                columns.timestamps.push_back(p_timestamp);
+                for(size_t i = 0; i < columns.columns.size(); ++i)
+                {
+                    const char* value = values + columns.fieldOffsets[i];
+                    columns.columns[i].insert(columns.columns[i].end(), value, value + GetTelemetryFieldSize(columns.schema.fields[i].type));
+                }
+
+                if(columns.timestamps.size() >= m_chunkRows)
+                {
+                    WriteChunk(columns);
+                }
+                return true;
+            }
+
+            void TelemetryFileWriter::Flush()
+            {
+                for(auto& schema : m_schemas)
+                {
+                    WriteChunk(schema.second);
+                }
+                if(m_file.is_open())
+                {
+                    m_file.flush();
+                }
+            }
+
+            void TelemetryFileWriter::Close()
+            {
+                Flush();
+                if(m_file.is_open())
+                {
+                    m_file.close();
+                }
+            }
+
+            void TelemetryFileWriter::WriteChunk(SchemaColumns& p_schema)
+            {
+                if(p_schema.timestamps.empty())
+                {
+                    return;
+                }
+
+                DataChunkMetaData metaData;
+                metaData.schemaId = p_schema.schema.id;
+                metaData.rowCount = static_cast<uint32_t>(p_schema.timestamps.size());
+                const char* metaDataBytes = reinterpret_cast<const char*>(&metaData);
+                const char* timestampBytes = reinterpret_cast<const char*>(p_schema.timestamps.data());
+
+                m_block.clear();
+                m_block.insert(m_block.end(), metaDataBytes, metaDataBytes + sizeof(DataChunkMetaData));
+                m_block.insert(m_block.end(), timestampBytes, timestampBytes + p_schema.timestamps.size() * sizeof(uint64_t));
+                for(auto& column : p_schema.columns)
+                {
+                    m_block.insert(m_block.end(), column.begin(), column.end());
+                    column.clear();
+                }
+                p_schema.timestamps.clear();
+
+                WriteBlock(TelemetryBlockType::CHUNK, m_block.data(), static_cast<uint32_t>(m_block.size()));
+            }
+
+            void TelemetryFileWriter::WriteBlock(const TelemetryBlockType& p_type, const void* p_data, const uint32_t& p_size)
+            {
+                if(!m_file.is_open())
+                {
+                    return;
+                }
+                m_file.put(static_cast<char>(p_type));
+                m_file.write(reinterpret_cast<const char*>(&p_size), sizeof(p_size));
+                m_file.write(static_cast<const char*>(p_data), p_size);
+            }
+
+            TelemetryFileReader::TelemetryFileReader() {}
+
+            TelemetryFileReader::~TelemetryFileReader() {}
+
+            bool TelemetryFileReader::Open(const std::string& p_fileName)
+            {
+                m_file.open(p_fileName, std::ifstream::in | std::ifstream::binary);
+                if(!m_file.is_open())
+                {
+                    return false;
+                }
+                char magic[sizeof(TELEMETRY_FILE_MAGIC)];
+                uint32_t version = 0;
+                m_file.read(magic, sizeof(magic));
+                m_file.read(reinterpret_cast<char*>(&version), sizeof(version));
+                return m_file.good() && memcmp(magic, TELEMETRY_FILE_MAGIC, sizeof(magic)) == 0 && version == TELEMETRY_FILE_VERSION;
+            }
+
+            bool TelemetryFileReader::ReadChunk(TelemetryChunk& o_chunk)
+            {
+                while(true)
+                {
+                    const int type = m_file.get();
+                    uint32_t size = 0;
+                    m_file.read(reinterpret_cast<char*>(&size), sizeof(size));
+                    if(!m_file.good())
+                    {
+                        return false;
+                    }
+                    m_block.resize(size);
+                    m_file.read(m_block.data(), size);
+                    if(!m_file.good())
+                    {
+                        return false;
+                    }
+
+                    if(type == static_cast<int>(TelemetryBlockType::SCHEMA))
+                    {
+                        TelemetrySchema schema;
+                        if(ReadDataSchema(m_block.data(), m_block.size(), schema))
+                        {
+                            m_schemas[schema.id] = schema;
+                        }
+                    }
+                    else if(type == static_cast<int>(TelemetryBlockType::CHUNK) && ReadChunkBlock(m_block, o_chunk))
+                    {
+                        return true;
+                    }
+                }
+            }
+
+            const TelemetrySchema* TelemetryFileReader::GetSchema(const uint32_t& p_schemaId) const
+            {
+                auto found = m_schemas.find(p_schemaId);
+                return found != m_schemas.end() ? &found->second : nullptr;
+            }
+
+            std::string TelemetryFileReader::FormatValue(const TelemetryFieldType& p_type, const void* p_value)
+            {
+                switch(p_type)
+                {
+                    case TelemetryFieldType::INT32:
+                    {
+                        int32_t value;
+                        memcpy(&value, p_value, sizeof(value));
+                        return std::to_string(value);
+                    }
+                    case TelemetryFieldType::UINT32:
+                    {
+                        uint32_t value;
+                        memcpy(&value, p_value, sizeof(value));
+                        return std::to_string(value);
+                    }
+                    case TelemetryFieldType::INT64:
+                    {
+                        int64_t value;
+                        memcpy(&value, p_value, sizeof(value));
+                        return std::to_string(value);
+                    }
+                    case TelemetryFieldType::UINT64:
+                    {
+                        uint64_t value;
+                        memcpy(&value, p_value, sizeof(value));
+                        return std::to_string(value);
+                    }
+                    case TelemetryFieldType::FLOAT:
+                    {
+                        float value;
+                        memcpy(&value, p_value, sizeof(value));
+                        std::ostringstream stream;
+                        stream << std::setprecision(9) << value;
+                        return stream.str();
+                    }
+                    case TelemetryFieldType::DOUBLE:
+                    {
+                        double value;
+                        memcpy(&value, p_value, sizeof(value));
+                        std::ostringstream stream;
+                        stream << std::setprecision(17) << value;
+                        return stream.str();
+                    }
+                    default:
+                        return std::string();
+                }
+            }
+
+            bool TelemetryFileReader::ReadChunkBlock(const std::vector<char>& p_block, TelemetryChunk& o_chunk) const
+            {
+                if(p_block.size() < sizeof(DataChunkMetaData))
+                {
+                    return false;
+                }
+                DataChunkMetaData metaData;
+                memcpy(&metaData, p_block.data(), sizeof(metaData));
+                const TelemetrySchema* schema = GetSchema(metaData.schemaId);
+                if(schema == nullptr)
+                {
+                    // A chunk without its schema can't be read
+                    return false;
+                }
+                const uint64_t rowSize = sizeof(uint64_t) + schema->GetRowSize();
+                if(p_block.size() != sizeof(DataChunkMetaData) + metaData.rowCount * rowSize)
+                {
+                    return false;
+                }
+
+                o_chunk.schemaId = metaData.schemaId;
+                o_chunk.rowCount = metaData.rowCount;
+                const char* position = p_block.data() + sizeof(DataChunkMetaData);
+                o_chunk.timestamps.resize(metaData.rowCount);
+                memcpy(o_chunk.timestamps.data(), position, metaData.rowCount * sizeof(uint64_t));
+                position += metaData.rowCount * sizeof(uint64_t);
+                o_chunk.columns.resize(schema->fields.size());
+                for(size_t i = 0; i < schema->fields.size(); ++i)
+                {
+                    const size_t columnSize = metaData.rowCount * GetTelemetryFieldSize(schema->fields[i].type);
+                    o_chunk.columns[i].assign(position, position + columnSize);
+                    position += columnSize;
+                }
+                return true;
+            }
+        }
+    }
+}
@@ -0,0 +1,268 @@
+#include <Memory/Circlebuffer/SPSCArbitrarySizeCirclebuffer.hpp>
+#include <Memory/Circlebuffer/SPSCStaticData.hpp>
+#include <Utility/Utilities/Include/PointerArithmetic/PointerArithmetic.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <thread>
+
+#if defined(_WIN32)
+#include <Utility/Utilities/Include/String/StringHelper.hpp>
+#include <Windows.h>
+#elif defined(__linux__)
+#include <climits>
+#include <ctime>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace Memory
+        {
+            namespace
+            {
+                // Records start on this alignment so headers are never read unaligned
+                const uint64_t RECORD_ALIGNMENT = 8;
+
+                uint64_t AlignRecordSize(const uint64_t& p_size) { return (p_size + RECORD_ALIGNMENT - 1) & ~(RECORD_ALIGNMENT - 1); }
+            }
+
+            SPSCArbitrarySizeCirclebuffer::SPSCArbitrarySizeCirclebuffer()
+                : m_data(nullptr),
+                  m_rawBufferPointerStart(nullptr),
+                  m_dataStart(nullptr),
+                  m_capacity(0),
+                  m_rawBufferSize(0),
+                  m_internalMemoryManagement(true),
+                  m_alreadyInitialized(false),
+                  m_cachedTail(0),
+                  m_cachedHead(0),
+                  m_droppedCount(0)
+#if defined(_WIN32)
+                  ,
+                  m_wakeupEvent(nullptr)
+#endif
+            {
+            }
+
+            SPSCArbitrarySizeCirclebuffer::~SPSCArbitrarySizeCirclebuffer()
+            {
+#if defined(_WIN32)
+                if(m_wakeupEvent != nullptr)
+                {
+                    CloseHandle(m_wakeupEvent);
+                }
+#endif
+                if(m_internalMemoryManagement)
+                {
+                    free(m_rawBufferPointerStart);
+                }
+            }
+
+            void SPSCArbitrarySizeCirclebuffer::Initialize(const uint32_t& p_bufferSize)
+            {
+                AssertInitialize(p_bufferSize);
+                m_rawBufferSize = p_bufferSize;
+                m_rawBufferPointerStart = malloc(m_rawBufferSize);
+                SetupVariables(true, "");
+            }
+
+            void SPSCArbitrarySizeCirclebuffer::Initialize(void* const p_preAllocatedBuffer, const uint32_t& p_bufferSize, const bool& p_resetMetaData,
+                                                           const std::string& p_wakeupName)
+            {
+                AssertInitialize(p_bufferSize);
+                m_rawBufferSize = p_bufferSize;
+                m_rawBufferPointerStart = p_preAllocatedBuffer;
+                m_internalMemoryManagement = false;
+                SetupVariables(p_resetMetaData, p_wakeupName);
+            }
+
+            bool SPSCArbitrarySizeCirclebuffer::Produce(const CircleBufferHeader& p_header, const void* const p_data)
+            {
+                if(p_header.packageSize < 0)
+                {
+                    return false;
+                }
+                const uint64_t recordSize = AlignRecordSize(sizeof(CircleBufferHeader) + p_header.packageSize);
+
+                // Only this side writes the head
+                const uint64_t head = m_data->head.load(std::memory_order_relaxed);
+                if(head + recordSize - m_cachedTail > m_capacity)
+                {
+                    // Acquire so the consumer is done reading the space before it is overwritten
+                    m_cachedTail = m_data->tail.load(std::memory_order_acquire);
+                    if(head + recordSize - m_cachedTail > m_capacity)
+                    {
+                        return false;
+                    }
+                }
+
+                CopyIn(head, &p_header, sizeof(CircleBufferHeader));
+                CopyIn(head + sizeof(CircleBufferHeader), p_data, p_header.packageSize);
+
+                // Publishes the record. Sequentially consistent together with the load of consumerWaiting in WakeConsumer,
+                // otherwise the consumer could go to sleep on a record it didn't see while the producer thinks it's awake
+                m_data->head.store(head + recordSize, std::memory_order_seq_cst);
+                WakeConsumer();
+                return true;
+            }
+
+            bool SPSCArbitrarySizeCirclebuffer::Consume(CircleBufferHeader*& o_header, void* o_dataBuffer, const uint32_t& p_outbufferSize)
+            {
+                while(true)
+                {
+                    // Only this side writes the tail
+                    const uint64_t tail = m_data->tail.load(std::memory_order_relaxed);
+                    if(tail == m_cachedHead)
+                    {
+                        // Acquire so the record is visible before it is read
+                        m_cachedHead = m_data->head.load(std::memory_order_acquire);
+                        if(tail == m_cachedHead)
+                        {
+                            return false;
+                        }
+                    }
+
+                    CopyOut(tail, o_header, sizeof(CircleBufferHeader));
+                    const uint64_t recordSize = AlignRecordSize(sizeof(CircleBufferHeader) + o_header->packageSize);
+                    const bool fits = static_cast<uint32_t>(o_header->packageSize) <= p_outbufferSize;
+                    if(fits)
+                    {
+                        CopyOut(tail + sizeof(CircleBufferHeader), o_dataBuffer, o_header->packageSize);
+                    }
+                    else
+                    {
+                        ++m_droppedCount;
+                    }
+
+                    // Release so the producer doesn't overwrite the record before it has been read
+                    m_data->tail.store(tail + recordSize, std::memory_order_release);
+                    if(fits)
+                    {
+                        return true;
+                    }
+                }
+            }
+
+            bool SPSCArbitrarySizeCirclebuffer::WaitForData(const std::chrono::milliseconds& p_timeout)
+            {
+                const uint64_t tail = m_data->tail.load(std::memory_order_relaxed);
+                if(m_data->head.load(std::memory_order_acquire) != tail)
+                {
+                    return true;
+                }
+
+                // Read the sequence before announcing the wait, a wakeup between here and the sleep changes it and the sleep
+                // returns at once
+                const uint32_t sequence = m_data->wakeupSequence.load(std::memory_order_acquire);
+                m_data->consumerWaiting.store(1, std::memory_order_seq_cst);
+                if(m_data->head.load(std::memory_order_seq_cst) == tail)
+                {
+#if defined(_WIN32)
+                    WaitForSingleObject(m_wakeupEvent, static_cast<DWORD>(p_timeout.count()));
+#elif defined(__linux__)
+                    // Not a private futex, the word may be shared with another process
+                    timespec timeout;
+                    timeout.tv_sec = static_cast<time_t>(p_timeout.count() / 1000);
+                    timeout.tv_nsec = static_cast<long>(p_timeout.count() % 1000) * 1000000;
+                    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&m_data->wakeupSequence), FUTEX_WAIT, sequence, &timeout, nullptr, 0);
+#else
+                    (void)sequence;
+                    std::this_thread::sleep_for(std::min(p_timeout, std::chrono::milliseconds(1)));
+#endif
+                }
+                m_data->consumerWaiting.store(0, std::memory_order_relaxed);
+                return m_data->head.load(std::memory_order_acquire) != tail;
+            }
+
+            bool SPSCArbitrarySizeCirclebuffer::HasData() const
+            {
+                return m_data->head.load(std::memory_order_seq_cst) != m_data->tail.load(std::memory_order_relaxed);
+            }
+
+            void SPSCArbitrarySizeCirclebuffer::AssertInitialize(const uint32_t& p_bufferSize)
+            {
+                if(m_alreadyInitialized)
+                {
+                    throw std::runtime_error("Already initialized.");
+                }
+
+                const uint32_t minimumSize = sizeof(SPSCStaticData) + sizeof(CircleBufferHeader) + RECORD_ALIGNMENT;
+                if(p_bufferSize < minimumSize)
+                {
+                    const std::string errorMessage = std::string("Not enough space. Minimumsize is " + std::to_string(minimumSize) + " bytes.");
+                    throw std::runtime_error(errorMessage);
+                }
+            }
+
+            void SPSCArbitrarySizeCirclebuffer::SetupVariables(const bool& p_resetMetaData, const std::string& p_wakeupName)
+            {
+                m_alreadyInitialized = true;
+                m_data = static_cast<SPSCStaticData*>(m_rawBufferPointerStart);
+                if(!m_data->head.is_lock_free() || !m_data->wakeupSequence.is_lock_free())
+                {
+                    // A locking atomic would keep its lock in this process only
+                    throw std::runtime_error("Atomics in shared memory need to be lock free.");
+                }
+                if(p_resetMetaData)
+                {
+                    new(m_data) SPSCStaticData();
+                }
+
+                m_dataStart = PointerArithmetic::Addition(static_cast<char*>(m_rawBufferPointerStart), sizeof(SPSCStaticData));
+                m_capacity = (m_rawBufferSize - sizeof(SPSCStaticData)) & ~(RECORD_ALIGNMENT - 1);
+                m_cachedTail = m_data->tail.load(std::memory_order_acquire);
+                m_cachedHead = m_data->head.load(std::memory_order_acquire);
+
+#if defined(_WIN32)
+                // Auto reset, a set event only wakes the consumer once
+                const std::wstring wakeupName = String::s2ws(p_wakeupName);
+                m_wakeupEvent = CreateEvent(nullptr, FALSE, FALSE, p_wakeupName.empty() ? nullptr : wakeupName.c_str());
+                if(m_wakeupEvent == NULL)
+                {
+                    throw std::runtime_error("Failed to create circlebuffer wakeup event. Errorcode: " + std::to_string(GetLastError()));
+                }
+#else
+                (void)p_wakeupName;
+#endif
+            }
+
+            void SPSCArbitrarySizeCirclebuffer::CopyIn(const uint64_t& p_position, const void* p_source, const size_t& p_size)
+            {
+                const uint64_t offset = p_position % m_capacity;
+                const size_t firstPart = static_cast<size_t>(std::min<uint64_t>(p_size, m_capacity - offset));
+                memcpy(m_dataStart + offset, p_source, firstPart);
+                memcpy(m_dataStart, static_cast<const char*>(p_source) + firstPart, p_size - firstPart);
+            }
+
+            void SPSCArbitrarySizeCirclebuffer::CopyOut(const uint64_t& p_position, void* p_destination, const size_t& p_size) const
+            {
+                const uint64_t offset = p_position % m_capacity;
+                const size_t firstPart = static_cast<size_t>(std::min<uint64_t>(p_size, m_capacity - offset));
+                memcpy(p_destination, m_dataStart + offset, firstPart);
+                memcpy(static_cast<char*>(p_destination) + firstPart, m_dataStart, p_size - firstPart);
+            }
+
+            void SPSCArbitrarySizeCirclebuffer::WakeConsumer()
+            {
+                if(m_data->consumerWaiting.load(std::memory_order_seq_cst) == 0)
+                {
+                    return;
+                }
+                m_data->wakeupSequence.fetch_add(1, std::memory_order_release);
+#if defined(_WIN32)
+                SetEvent(m_wakeupEvent);
+#elif defined(__linux__)
+                syscall(SYS_futex, reinterpret_cast<uint32_t*>(&m_data->wakeupSequence), FUTEX_WAKE, 1, nullptr, nullptr, 0);
+#endif
+            }
+        }
+    }
+}
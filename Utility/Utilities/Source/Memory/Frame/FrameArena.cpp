@@ -0,0 +1,124 @@
+#include <Memory/Frame/FrameArena.hpp>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace Memory
+        {
+            namespace
+            {
+                // Alignment of each half, allocations with a larger alignment are padded
+                const uint8_t FRAME_ALIGNMENT = 16;
+            }
+
+            FrameArena::FrameArena()
+                : m_frameMemorySize(0), m_currentFrame(0), m_top(0), m_frameEnd(0), m_peakFrameBytes(0), m_totalOverflowAllocations(0)
+            {
+                m_frameOccupied[0] = 0;
+                m_frameOccupied[1] = 0;
+            }
+
+            FrameArena::~FrameArena()
+            {
+                FreeOverflow(0);
+                FreeOverflow(1);
+            }
+
+            void FrameArena::Initialize(const size_t& p_frameMemorySize)
+            {
+                // Each half starts aligned as long as the frame size is a multiple of the alignment
+                m_frameMemorySize = (p_frameMemorySize + FRAME_ALIGNMENT - 1) & ~static_cast<size_t>(FRAME_ALIGNMENT - 1);
+                MemoryAllocator::Initialize(m_frameMemorySize * 2, FRAME_ALIGNMENT);
+                Clear();
+            }
+
+            void* FrameArena::Allocate(const size_t& p_memorySize, const size_t& p_alignment)
+            {
+                if(p_alignment == 0 || (p_alignment & (p_alignment - 1)) != 0)
+                {
+                    // TODO logging
+                    throw std::runtime_error("Alignment must be a power of 2.");
+                }
+
+                ++m_currentStatistics.allocations;
+                m_currentStatistics.allocatedBytes += p_memorySize;
+
+                const size_t alignedAdress = (m_top + p_alignment - 1) & ~(p_alignment - 1);
+                if(alignedAdress + p_memorySize > m_frameEnd)
+                {
+                    return AllocateOverflow(p_memorySize, p_alignment);
+                }
+
+                // Padding counts as occupied, it is not usable until the frame is reused
+                const size_t newTop = alignedAdress + p_memorySize;
+                m_frameOccupied[m_currentFrame] += newTop - m_top;
+                m_occupiedMemory += newTop - m_top;
+                m_top = newTop;
+                return reinterpret_cast<void*>(alignedAdress);
+            }
+
+            void FrameArena::SwapFrames()
+            {
+                if(m_currentStatistics.allocatedBytes > m_peakFrameBytes)
+                {
+                    m_peakFrameBytes = m_currentStatistics.allocatedBytes;
+                }
+                m_lastStatistics = m_currentStatistics;
+                m_currentStatistics = FrameArenaStatistics();
+
+                // The frame before the one that just ended is done with its memory
+                m_currentFrame = 1 - m_currentFrame;
+                ResetFrame(m_currentFrame);
+            }
+
+            void FrameArena::Clear()
+            {
+                ResetFrame(1 - m_currentFrame);
+                ResetFrame(m_currentFrame);
+                m_currentStatistics = FrameArenaStatistics();
+            }
+
+            void* FrameArena::AllocateOverflow(const size_t& p_memorySize, const size_t& p_alignment)
+            {
+                // The raw pointer is kept to be freed, the aligned one is handed out
+                void* rawAdress = std::malloc(p_memorySize + p_alignment);
+                if(rawAdress == nullptr)
+                {
+                    throw std::runtime_error("Error allocating - Frame arena is full and the heap allocation failed.");
+                }
+                m_overflow[m_currentFrame].push_back(rawAdress);
+
+                ++m_currentStatistics.overflowAllocations;
+                m_currentStatistics.overflowBytes += p_memorySize;
+                ++m_totalOverflowAllocations;
+
+                const size_t alignedAdress = (reinterpret_cast<size_t>(rawAdress) + p_alignment - 1) & ~(p_alignment - 1);
+                return reinterpret_cast<void*>(alignedAdress);
+            }
+
+            void FrameArena::FreeOverflow(const uint32_t& p_frame)
+            {
+                for(auto& rawAdress : m_overflow[p_frame])
+                {
+                    std::free(rawAdress);
+                }
+                m_overflow[p_frame].clear();
+            }
+
+            void FrameArena::ResetFrame(const uint32_t& p_frame)
+            {
+                FreeOverflow(p_frame);
+                m_occupiedMemory -= m_frameOccupied[p_frame];
+                m_frameOccupied[p_frame] = 0;
+                if(p_frame == m_currentFrame)
+                {
+                    m_top = reinterpret_cast<size_t>(GetAdressStartAligned()) + m_frameMemorySize * p_frame;
+                    m_frameEnd = m_top + m_frameMemorySize;
+                }
+            }
+        }
+    }
+}
@@ -1,5 +1,14 @@
 #include <Memory/MemoryAllocator.hpp>
 #include <memory>
+#include <stdexcept>
+
+#if defined(_WIN32)
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 namespace Doremi
 {
@@ -7,12 +16,160 @@ namespace Doremi
     {
         namespace Memory
         {
+            namespace
+            {
+                PageOptions s_defaultPageOptions;
+
+                size_t RoundUp(const size_t& p_size, const size_t& p_granularity)
+                {
+                    return (p_size + p_granularity - 1) / p_granularity * p_granularity;
+                }
+
+#if defined(_WIN32)
+                // Large pages are locked in memory, the process needs the right to do it enabled in its token
+                size_t ComputeLargePageSize()
+                {
+                    const size_t largePageSize = GetLargePageMinimum();
+                    if(largePageSize == 0)
+                    {
+                        return 0;
+                    }
+                    HANDLE token;
+                    if(!OpenProcessToken(GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token))
+                    {
+                        return 0;
+                    }
+                    TOKEN_PRIVILEGES privileges;
+                    privileges.PrivilegeCount = 1;
+                    privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+                    bool enabled = LookupPrivilegeValue(nullptr, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid) &&
+                                   AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr);
+                    // Succeeds without enabling anything if the user lacks the right
+                    enabled = enabled && GetLastError() == ERROR_SUCCESS;
+                    CloseHandle(token);
+                    return enabled ? largePageSize : 0;
+                }
+
+                size_t GetPageSize()
+                {
+                    SYSTEM_INFO systemInfo;
+                    GetSystemInfo(&systemInfo);
+                    return systemInfo.dwPageSize;
+                }
+
+                void* AllocateSystemPages(const size_t& p_size, const bool& p_largePages, const int32_t& p_numaNode)
+                {
+                    const DWORD allocationType = MEM_RESERVE | MEM_COMMIT | (p_largePages ? MEM_LARGE_PAGES : 0);
+                    if(p_numaNode >= 0)
+                    {
+                        void* memory = VirtualAllocExNuma(GetCurrentProcess(), nullptr, p_size, allocationType, PAGE_READWRITE, p_numaNode);
+                        if(memory != nullptr)
+                        {
+                            return memory;
+                        }
+                    }
+                    return VirtualAlloc(nullptr, p_size, allocationType, PAGE_READWRITE);
+                }
+
+                void FreeSystemPages(void* p_memory, const size_t& p_size) { VirtualFree(p_memory, 0, MEM_RELEASE); }
+#else
+                // The usual huge page size on x64, the kernel refuses MAP_HUGETLB if none are reserved
+                size_t ComputeLargePageSize() { return 2 * 1024 * 1024; }
+
+                size_t GetPageSize() { return static_cast<size_t>(sysconf(_SC_PAGESIZE)); }
+
+                void* AllocateSystemPages(const size_t& p_size, const bool& p_largePages, const int32_t& p_numaNode)
+                {
+                    const int flags = MAP_PRIVATE | MAP_ANONYMOUS | (p_largePages ? MAP_HUGETLB : 0);
+                    void* memory = mmap(nullptr, p_size, PROT_READ | PROT_WRITE, flags, -1, 0);
+                    if(memory == MAP_FAILED)
+                    {
+                        return nullptr;
+                    }
+                    if(p_numaNode >= 0 && p_numaNode < 63)
+                    {
+                        // Preferred rather than bound, so the pages go elsewhere if the node is full. Nothing is touched yet
+                        const int MPOL_PREFERRED = 1;
+                        const unsigned long nodeMask = 1ul << p_numaNode;
+                        syscall(SYS_mbind, memory, p_size, MPOL_PREFERRED, &nodeMask, sizeof(nodeMask) * 8, 0);
+                    }
+                    return memory;
+                }
+
+                void FreeSystemPages(void* p_memory, const size_t& p_size) { munmap(p_memory, p_size); }
+#endif
+            }
+
             MemoryAllocator::MemoryAllocator()
-                : m_occupiedMemory(0), m_totalMemory(0), m_memoryStartRaw(nullptr), m_memoryEndRaw(nullptr), m_memoryStartAligned(nullptr), m_alignment(0), m_adjustment(0)
+                : m_occupiedMemory(0),
+                  m_totalMemory(0),
+                  m_memoryStartRaw(nullptr),
+                  m_memoryEndRaw(nullptr),
+                  m_memoryStartAligned(nullptr),
+                  m_alignment(0),
+                  m_adjustment(0),
+                  m_usePages(false)
+            {
+            }
+
+            MemoryAllocator::~MemoryAllocator()
+            {
+                if(m_usePages)
+                {
+                    FreePages(m_pages);
+                }
+                else
+                {
+                    std::free(m_memoryStartRaw);
+                }
+            }
+
+            PageAllocation MemoryAllocator::AllocatePages(const size_t& p_size, const PageOptions& p_options)
+            {
+                PageAllocation allocation;
+                const size_t largePageSize = GetLargePageSize();
+                if(p_options.largePages && largePageSize != 0 && p_size >= largePageSize / 2)
+                {
+                    allocation.size = RoundUp(p_size, largePageSize);
+                    allocation.memory = AllocateSystemPages(allocation.size, true, p_options.numaNode);
+                    allocation.largePages = allocation.memory != nullptr;
+                }
+                if(allocation.memory == nullptr)
+                {
+                    allocation.size = RoundUp(p_size, GetPageSize());
+                    allocation.memory = AllocateSystemPages(allocation.size, false, p_options.numaNode);
+#if !defined(_WIN32) && defined(MADV_HUGEPAGE)
+                    if(allocation.memory != nullptr && p_options.largePages)
+                    {
+                        // No reserved huge pages, transparent ones may still back the aligned parts of the block
+                        madvise(allocation.memory, allocation.size, MADV_HUGEPAGE);
+                    }
+#endif
+                }
+                if(allocation.memory == nullptr)
+                {
+                    throw std::runtime_error("Error allocating - Could not allocate pages.");
+                }
+                return allocation;
+            }
+
+            void MemoryAllocator::FreePages(const PageAllocation& p_allocation)
+            {
+                if(p_allocation.memory != nullptr)
+                {
+                    FreeSystemPages(p_allocation.memory, p_allocation.size);
+                }
+            }
+
+            size_t MemoryAllocator::GetLargePageSize()
             {
+                static const size_t largePageSize = ComputeLargePageSize();
+                return largePageSize;
             }
 
-            MemoryAllocator::~MemoryAllocator() { std::free(m_memoryStartRaw); }
+            void MemoryAllocator::SetDefaultPageOptions(const PageOptions& p_options) { s_defaultPageOptions = p_options; }
+
+            const PageOptions& MemoryAllocator::GetDefaultPageOptions() { return s_defaultPageOptions; }
 
 
             void MemoryAllocator::Initialize(const size_t& p_memorySize, const uint8_t& p_alignment)
@@ -22,6 +179,13 @@ namespace Doremi
                 AllocateFirstTime();
             }
 
+            void MemoryAllocator::Initialize(const size_t& p_memorySize, const uint8_t& p_alignment, const PageOptions& p_pageOptions)
+            {
+                m_usePages = true;
+                m_pageOptions = p_pageOptions;
+                Initialize(p_memorySize, p_alignment);
+            }
+
             MemorySpecification MemoryAllocator::GetMemorySpecification()
             {
                 return MemorySpecification(m_totalMemory - m_occupiedMemory, m_totalMemory, m_occupiedMemory);
@@ -30,13 +194,25 @@ namespace Doremi
             void MemoryAllocator::AllocateFirstTime()
             {
                 // Allocate a chunk of memory and save the raw pointer
-                m_memoryStartRaw = std::malloc(m_totalMemory);
+                if(m_usePages)
+                {
+                    // Pages come zeroed
+                    m_pages = AllocatePages(m_totalMemory, m_pageOptions);
+                    m_memoryStartRaw = m_pages.memory;
+                }
+                else
+                {
+                    m_memoryStartRaw = std::malloc(m_totalMemory);
+                }
 
                 // Adress to end of memory chunk
                 m_memoryEndRaw = reinterpret_cast<void*>(reinterpret_cast<size_t>(m_memoryStartRaw) + m_totalMemory);
 
                 // Set entire chunk to zero
-                memset(m_memoryStartRaw, 0, m_totalMemory); // TODORT could be removed in the future
+                if(!m_usePages)
+                {
+                    memset(m_memoryStartRaw, 0, m_totalMemory); // TODORT could be removed in the future
+                }
 
                 // Compute the adjustment basd on alignment
                 m_adjustment = ComputeAdjustment(m_memoryStartRaw, m_alignment);
@@ -0,0 +1,260 @@
+#include <Memory/Pool/SlabPoolAllocator.hpp>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace Memory
+        {
+            namespace
+            {
+                /**
+                Cache of one pool on the calling thread
+                */
+                struct ThreadCacheOfPool
+                {
+                    uint64_t instance;
+                    void* cache;
+                };
+
+                thread_local std::vector<ThreadCacheOfPool> t_threadCaches;
+
+                std::atomic<uint64_t> s_nextInstance(1);
+
+                const uint64_t STACK_INDEX_MASK = 0xffffffff;
+            }
+
+            const uint32_t SlabPoolAllocator::MAGAZINE_SIZE;
+            const uint32_t SlabPoolAllocator::MAGAZINES_PER_CHUNK;
+            const uint32_t SlabPoolAllocator::MAX_MAGAZINE_CHUNKS;
+
+            SlabPoolAllocator::SlabPoolAllocator()
+                : m_blockSize(0),
+                  m_alignment(1),
+                  m_blocksPerSlab(0),
+                  m_fullMagazines(0),
+                  m_emptyMagazines(0),
+                  m_magazineCount(0),
+                  m_slabCount(0),
+                  m_instance(s_nextInstance.fetch_add(1))
+            {
+                for(auto& chunk : m_magazineChunks)
+                {
+                    chunk.store(nullptr, std::memory_order_relaxed);
+                }
+            }
+
+            SlabPoolAllocator::~SlabPoolAllocator()
+            {
+                for(auto& slab : m_slabs)
+                {
+                    std::free(slab);
+                }
+                for(auto& chunk : m_magazineChunks)
+                {
+                    delete[] chunk.load(std::memory_order_relaxed);
+                }
+                for(auto& cache : m_threadCaches)
+                {
+                    delete cache;
+                }
+            }
+
+            void SlabPoolAllocator::Initialize(const size_t& p_blockSize, const size_t& p_alignment, const size_t& p_blocksPerSlab)
+            {
+                if(p_alignment == 0 || (p_alignment & (p_alignment - 1)) != 0)
+                {
+                    // TODO logging
+                    throw std::runtime_error("Alignment must be a power of 2.");
+                }
+                m_alignment = p_alignment;
+                // Every block after the first is aligned as long as the size is a multiple of the alignment
+                m_blockSize = (p_blockSize + m_alignment - 1) & ~(m_alignment - 1);
+                const size_t magazinesPerSlab = p_blocksPerSlab > MAGAZINE_SIZE ? (p_blocksPerSlab + MAGAZINE_SIZE - 1) / MAGAZINE_SIZE : 1;
+                m_blocksPerSlab = magazinesPerSlab * MAGAZINE_SIZE;
+            }
+
+            void* SlabPoolAllocator::Allocate()
+            {
+                ThreadCache& cache = GetThreadCache();
+                Magazine* loaded = &GetMagazine(cache.loaded);
+                if(loaded->count == 0)
+                {
+                    RefillLoaded(cache);
+                    loaded = &GetMagazine(cache.loaded);
+                }
+                --loaded->count;
+                return loaded->blocks[loaded->count];
+            }
+
+            void SlabPoolAllocator::Free(void* p_block)
+            {
+                ThreadCache& cache = GetThreadCache();
+                Magazine* loaded = &GetMagazine(cache.loaded);
+                if(loaded->count == MAGAZINE_SIZE)
+                {
+                    EmptyLoaded(cache);
+                    loaded = &GetMagazine(cache.loaded);
+                }
+                loaded->blocks[loaded->count] = p_block;
+                ++loaded->count;
+            }
+
+            SlabPoolAllocator::ThreadCache& SlabPoolAllocator::GetThreadCache()
+            {
+                for(auto& threadCache : t_threadCaches)
+                {
+                    if(threadCache.instance == m_instance)
+                    {
+                        return *static_cast<ThreadCache*>(threadCache.cache);
+                    }
+                }
+
+                // First time this thread uses the pool, it starts with two empty magazines
+                ThreadCache* cache = new ThreadCache();
+                {
+                    std::lock_guard<std::mutex> lock(m_growLock);
+                    cache->loaded = CreateMagazine();
+                    cache->previous = CreateMagazine();
+                    m_threadCaches.push_back(cache);
+                }
+                ThreadCacheOfPool threadCache = {m_instance, cache};
+                t_threadCaches.push_back(threadCache);
+                return *cache;
+            }
+
+            SlabPoolAllocator::Magazine& SlabPoolAllocator::GetMagazine(const uint32_t& p_index) const
+            {
+                return m_magazineChunks[p_index / MAGAZINES_PER_CHUNK].load(std::memory_order_acquire)[p_index % MAGAZINES_PER_CHUNK];
+            }
+
+            void SlabPoolAllocator::Push(std::atomic<uint64_t>& p_stack, const uint32_t& p_magazine)
+            {
+                Magazine& magazine = GetMagazine(p_magazine);
+                uint64_t head = p_stack.load(std::memory_order_relaxed);
+                uint64_t newHead;
+                do
+                {
+                    magazine.next.store(static_cast<uint32_t>(head & STACK_INDEX_MASK), std::memory_order_relaxed);
+                    newHead = (((head >> 32) + 1) << 32) | (p_magazine + 1);
+                } while(!p_stack.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+            }
+
+            uint32_t SlabPoolAllocator::Pop(std::atomic<uint64_t>& p_stack)
+            {
+                uint64_t head = p_stack.load(std::memory_order_acquire);
+                while(true)
+                {
+                    const uint32_t top = static_cast<uint32_t>(head & STACK_INDEX_MASK);
+                    if(top == 0)
+                    {
+                        return 0;
+                    }
+                    // The magazine may be popped and pushed again meanwhile, the tag makes the exchange fail if so
+                    const uint32_t next = GetMagazine(top - 1).next.load(std::memory_order_relaxed);
+                    const uint64_t newHead = (((head >> 32) + 1) << 32) | next;
+                    if(p_stack.compare_exchange_weak(head, newHead, std::memory_order_acquire, std::memory_order_acquire))
+                    {
+                        return top;
+                    }
+                }
+            }
+
+            uint32_t SlabPoolAllocator::CreateMagazine()
+            {
+                const uint32_t index = m_magazineCount;
+                const uint32_t chunk = index / MAGAZINES_PER_CHUNK;
+                if(chunk >= MAX_MAGAZINE_CHUNKS)
+                {
+                    // TODO logging
+                    throw std::runtime_error("No more space in the pool.");
+                }
+                if(index % MAGAZINES_PER_CHUNK == 0)
+                {
+                    m_magazineChunks[chunk].store(new Magazine[MAGAZINES_PER_CHUNK], std::memory_order_release);
+                }
+                Magazine& magazine = GetMagazine(index);
+                magazine.count = 0;
+                magazine.next.store(0, std::memory_order_relaxed);
+                ++m_magazineCount;
+                return index;
+            }
+
+            void SlabPoolAllocator::Grow()
+            {
+                std::lock_guard<std::mutex> lock(m_growLock);
+                if((m_fullMagazines.load(std::memory_order_acquire) & STACK_INDEX_MASK) != 0)
+                {
+                    // Another thread grew the pool or blocks were freed while waiting for the lock
+                    return;
+                }
+
+                void* slab = std::malloc(m_blocksPerSlab * m_blockSize + m_alignment);
+                if(slab == nullptr)
+                {
+                    throw std::runtime_error("Error allocating - Could not allocate a new slab for the pool.");
+                }
+                m_slabs.push_back(slab);
+
+                size_t block = (reinterpret_cast<size_t>(slab) + m_alignment - 1) & ~(m_alignment - 1);
+                const size_t magazinesPerSlab = m_blocksPerSlab / MAGAZINE_SIZE;
+                for(size_t i = 0; i < magazinesPerSlab; ++i)
+                {
+                    const uint32_t index = CreateMagazine();
+                    Magazine& magazine = GetMagazine(index);
+                    for(uint32_t j = 0; j < MAGAZINE_SIZE; ++j)
+                    {
+                        magazine.blocks[j] = reinterpret_cast<void*>(block);
+                        block += m_blockSize;
+                    }
+                    magazine.count = MAGAZINE_SIZE;
+                    Push(m_fullMagazines, index);
+                }
+                m_slabCount.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void SlabPoolAllocator::RefillLoaded(ThreadCache& p_cache)
+            {
+                // The previous magazine is always either full or empty
+                if(GetMagazine(p_cache.previous).count > 0)
+                {
+                    std::swap(p_cache.loaded, p_cache.previous);
+                    return;
+                }
+
+                uint32_t full = Pop(m_fullMagazines);
+                while(full == 0)
+                {
+                    Grow();
+                    full = Pop(m_fullMagazines);
+                }
+                // Both magazines of the thread are empty, one of them goes back
+                Push(m_emptyMagazines, p_cache.previous);
+                p_cache.previous = p_cache.loaded;
+                p_cache.loaded = full - 1;
+            }
+
+            void SlabPoolAllocator::EmptyLoaded(ThreadCache& p_cache)
+            {
+                if(GetMagazine(p_cache.previous).count == 0)
+                {
+                    std::swap(p_cache.loaded, p_cache.previous);
+                    return;
+                }
+
+                uint32_t empty = Pop(m_emptyMagazines);
+                if(empty == 0)
+                {
+                    std::lock_guard<std::mutex> lock(m_growLock);
+                    empty = CreateMagazine() + 1;
+                }
+                // Both magazines of the thread are full, one of them goes to the depot
+                Push(m_fullMagazines, p_cache.previous);
+                p_cache.previous = p_cache.loaded;
+                p_cache.loaded = empty - 1;
+            }
+        }
+    }
+}
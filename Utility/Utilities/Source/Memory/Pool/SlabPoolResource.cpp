@@ -0,0 +1,61 @@
+#include <Memory/Pool/SlabPoolResource.hpp>
+#include <new>
+
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace Memory
+        {
+            const size_t SlabPoolResource::SMALLEST_SIZE;
+            const size_t SlabPoolResource::NUMBER_OF_SIZES;
+            const size_t SlabPoolResource::LARGEST_SIZE;
+
+            SlabPoolResource::SlabPoolResource(const size_t& p_blocksPerSlab)
+            {
+                for(size_t i = 0; i < NUMBER_OF_SIZES; ++i)
+                {
+                    m_pools[i].Initialize(SMALLEST_SIZE << i, SMALLEST_SIZE, p_blocksPerSlab);
+                }
+            }
+
+            void* SlabPoolResource::Allocate(const size_t& p_memorySize)
+            {
+                if(p_memorySize > LARGEST_SIZE)
+                {
+                    return ::operator new(p_memorySize);
+                }
+                return m_pools[GetSizeIndex(p_memorySize)].Allocate();
+            }
+
+            void SlabPoolResource::Deallocate(void* p_memory, const size_t& p_memorySize)
+            {
+                if(p_memory == nullptr)
+                {
+                    return;
+                }
+                if(p_memorySize > LARGEST_SIZE)
+                {
+                    ::operator delete(p_memory);
+                    return;
+                }
+                m_pools[GetSizeIndex(p_memorySize)].Free(p_memory);
+            }
+
+            const SlabPoolAllocator* SlabPoolResource::GetPool(const size_t& p_memorySize) const
+            {
+                return p_memorySize > LARGEST_SIZE ? nullptr : &m_pools[GetSizeIndex(p_memorySize)];
+            }
+
+            size_t SlabPoolResource::GetSizeIndex(const size_t& p_memorySize)
+            {
+                size_t index = 0;
+                while((SMALLEST_SIZE << index) < p_memorySize)
+                {
+                    ++index;
+                }
+                return index;
+            }
+        }
+    }
+}
@@ -0,0 +1,160 @@
+#include <Threading/WorkStealingThreadPool.hpp>
+
+#include <algorithm>
+
+namespace Doremi
+{
+    namespace Utilities
+    {
+        namespace Threading
+        {
+            namespace
+            {
+                // Pool and index of the worker running on this thread
+                thread_local const WorkStealingThreadPool* t_currentPool = nullptr;
+                thread_local uint32_t t_currentWorkerIndex = 0;
+            }
+
+            WorkStealingThreadPool::WorkStealingThreadPool(const uint32_t& p_threadCount)
+                : m_queuedJobs(0), m_pendingJobs(0), m_nextQueue(0), m_running(true)
+            {
+                uint32_t threadCount = p_threadCount;
+                if(threadCount == 0)
+                {
+                    const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+                    threadCount = std::max(hardwareThreads, 2u) - 1;
+                }
+
+                m_queues.reserve(threadCount);
+                for(uint32_t i = 0; i < threadCount; ++i)
+                {
+                    m_queues.push_back(std::unique_ptr<WorkerQueue>(new WorkerQueue()));
+                }
+                // Queues must exist before any worker starts stealing
+                m_threads.reserve(threadCount);
+                for(uint32_t i = 0; i < threadCount; ++i)
+                {
+                    m_threads.push_back(std::thread(&WorkStealingThreadPool::WorkerLoop, this, i));
+                }
+            }
+
+            WorkStealingThreadPool::~WorkStealingThreadPool()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_sleepMutex);
+                    m_running = false;
+                }
+                m_sleepCondition.notify_all();
+                for(auto& thread : m_threads)
+                {
+                    thread.join();
+                }
+            }
+
+            void WorkStealingThreadPool::Submit(std::function<void()> p_job)
+            {
+                const uint32_t queueCount = static_cast<uint32_t>(m_queues.size());
+                uint32_t queueIndex;
+                if(t_currentPool == this)
+                {
+                    queueIndex = t_currentWorkerIndex;
+                }
+                else
+                {
+                    queueIndex = m_nextQueue.fetch_add(1, std::memory_order_relaxed) % queueCount;
+                }
+
+                m_pendingJobs.fetch_add(1);
+                {
+                    WorkerQueue& queue = *m_queues[queueIndex];
+                    std::lock_guard<std::mutex> lock(queue.mutex);
+                    queue.jobs.push_back(std::move(p_job));
+                    m_queuedJobs.fetch_add(1);
+                }
+
+                // Taking the lock makes sure a worker which just saw no jobs is waiting before it is notified
+                {
+                    std::lock_guard<std::mutex> lock(m_sleepMutex);
+                }
+                m_sleepCondition.notify_one();
+            }
+
+            void WorkStealingThreadPool::WaitUntilIdle()
+            {
+                std::unique_lock<std::mutex> lock(m_sleepMutex);
+                m_idleCondition.wait(lock, [this]() { return m_pendingJobs.load() == 0; });
+            }
+
+            uint32_t WorkStealingThreadPool::GetCurrentWorkerIndex() const
+            {
+                if(t_currentPool == this)
+                {
+                    return t_currentWorkerIndex;
+                }
+                return GetThreadCount();
+            }
+
+            void WorkStealingThreadPool::WorkerLoop(const uint32_t& p_workerIndex)
+            {
+                t_currentPool = this;
+                t_currentWorkerIndex = p_workerIndex;
+
+                std::function<void()> job;
+                while(true)
+                {
+                    if(PopOrSteal(p_workerIndex, job))
+                    {
+                        job();
+                        job = nullptr;
+                        if(m_pendingJobs.fetch_sub(1) == 1)
+                        {
+                            std::lock_guard<std::mutex> lock(m_sleepMutex);
+                            m_idleCondition.notify_all();
+                        }
+                        continue;
+                    }
+
+                    std::unique_lock<std::mutex> lock(m_sleepMutex);
+                    m_sleepCondition.wait(lock, [this]() { return !m_running || m_queuedJobs.load() > 0; });
+                    // Jobs left in the queues are finished before shutting down
+                    if(!m_running && m_queuedJobs.load() == 0)
+                    {
+                        return;
+                    }
+                }
+            }
+
+            bool WorkStealingThreadPool::PopOrSteal(const uint32_t& p_workerIndex, std::function<void()>& o_job)
+            {
+                // Own queue is used as a stack, the newest job is most likely still in the cache
+                {
+                    WorkerQueue& queue = *m_queues[p_workerIndex];
+                    std::lock_guard<std::mutex> lock(queue.mutex);
+                    if(!queue.jobs.empty())
+                    {
+                        o_job = std::move(queue.jobs.back());
+                        queue.jobs.pop_back();
+                        m_queuedJobs.fetch_sub(1);
+                        return true;
+                    }
+                }
+
+                // Steal the oldest job of another worker
+                const uint32_t queueCount = static_cast<uint32_t>(m_queues.size());
+                for(uint32_t i = 1; i < queueCount; ++i)
+                {
+                    WorkerQueue& queue = *m_queues[(p_workerIndex + i) % queueCount];
+                    std::lock_guard<std::mutex> lock(queue.mutex);
+                    if(!queue.jobs.empty())
+                    {
+                        o_job = std::move(queue.jobs.front());
+                        queue.jobs.pop_front();
+                        m_queuedJobs.fetch_sub(1);
+                        return true;
+                    }
+                }
+                return false;
+            }
+        }
+    }
+}